@@ -46,6 +46,9 @@
 
 
 #define PARAMS_FILE_NAME DISK_NAME"Params.ini"
+#define EFFECT_SCRIPT_FILE_NAME DISK_NAME"Effect.vm" //   WS2812B_FX_SCRIPT
+#define CAPTURE_RGB_FILE_NAME   DISK_NAME"Capture.rgb" //   
+#define CAPTURE_LOG_FILE_NAME   DISK_NAME"Capture.csv" //    
 
 
 //#define USB_VT100  //      USB
@@ -75,6 +78,7 @@
 #define MQX_MFS   //    MQX MFS
 #define MQX_SHELL //    MQX SHELL   VT100
 #define MFS_TEST  //        MFS
+#define LEDSC_TEST //        
 
 
 #define MAIN_TASK_IDX           1
@@ -87,10 +91,12 @@
 #define SHELL_IDX               8
 #define FILELOG_IDX             9
 #define BACKGR_IDX              10
+#define WS2812B_RENDER_IDX      11
 
 
 //   
 //      .
+#define WS2812B_RENDER_PRIO     7  //     .     
 #define MAIN_TASK_PRIO          8
 #define CAN_RX_ID_PRIO          9
 #define CAN_TX_ID_PRIO          9
@@ -103,6 +109,14 @@
 #define TIMERS_ID_PRIO          7
 #define BACKGR_ID_PRIO          100
 
+//      .
+//    make stack  MK66/Host    : 616     
+//     (  stk[17]  WS2812B_vm_run,     T_WS2812B_vm_prog),   - 552,   - 464.
+//     -O2  x86-64,          .
+//        FPU (104 )    MQX     ( 200 )
+#define WS2812B_RENDER_STACK_MEASURED 616
+#define WS2812B_RENDER_STACK    (WS2812B_RENDER_STACK_MEASURED * 2 + 104 + 200)
+
 
 #define MAX_MQX_PRIO        BSP_DEFAULT_MQX_HARDWARE_INTERRUPT_LEVEL_MAX
 
@@ -114,6 +128,9 @@
 #define FTM3_ISR_PRIO       MAX_MQX_PRIO      //    PWM  
 #define FTM1_ISR_PRIO       MAX_MQX_PRIO + 1  //    
 #define CAN_ISR_PRIO        MAX_MQX_PRIO + 1  //      CAN 
+#define WS2812B_DMA_ISR_PRIO MAX_MQX_PRIO     //   DMA      
+#define PIT1_ISR_PRIO       MAX_MQX_PRIO + 1  //       
+#define PIT2_ISR_PRIO       MAX_MQX_PRIO      //       .   DMA,     
 
 #define SPI0_PRIO           MAX_MQX_PRIO + 1
 #define SPI1_PRIO           MAX_MQX_PRIO + 1
@@ -179,3 +196,6 @@ _mqx_int  TimeManInit(void);
 void      Get_time_counters(HWTIMER_TIME_STRUCT *t);
 uint32_t  Eval_meas_time(HWTIMER_TIME_STRUCT t1, HWTIMER_TIME_STRUCT t2);
 uint32_t  Get_usage_time(void);
+void      Cycles_counter_init(void);
+
+#define   Get_cycles_counter() (DWT_CYCCNT) //     
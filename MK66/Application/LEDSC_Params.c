@@ -1,13 +1,14 @@
 #include "App.h"
 
-const T_parmenu parmenu[2]=
+const T_parmenu parmenu[3]=
 {
   {MDC_v1_0,MDC_v1_main,"Parameters and settings","PARAMETERS", -1},//   
   {MDC_v1_main,MDC_v1_General,"General settings","GENERAL_SETTINGS", -1},//  
+  {MDC_v1_main,MDC_v1_LED_strip,"LED strip settings","LED_STRIP_SETTINGS", -1},//      ,   
 };
 
 
-const T_work_params dwvar[4]=
+const T_work_params dwvar[13]=
 {
   {
     " Product  name ",
@@ -69,4 +70,139 @@ const T_work_params dwvar[4]=
     0,
     sizeof(wvar.en_verbose_log),
   },
+  {
+    " LEDs number ",
+    "LEDSNUM",
+    (void*)&wvar.ws2812b_leds_num,
+    tint16u,
+    122,
+    1,
+    1024,
+    0,
+    MDC_v1_LED_strip,
+    "",
+    "%d",
+    0,
+    sizeof(wvar.ws2812b_leds_num),
+  },
+  {
+    " Strips number ",
+    "STRPNUM",
+    (void*)&wvar.ws2812b_strips_num,
+    tint8u,
+    1,
+    1,
+    8,
+    0,
+    MDC_v1_LED_strip,
+    "",
+    "%d",
+    0,
+    sizeof(wvar.ws2812b_strips_num),
+  },
+  {
+    " Color order (0-GRB, 1-RGB, 2-GRBW) ",
+    "COLORD",
+    (void*)&wvar.ws2812b_color_order,
+    tint8u,
+    0,
+    0,
+    2,
+    0,
+    MDC_v1_LED_strip,
+    "",
+    "%d",
+    0,
+    sizeof(wvar.ws2812b_color_order),
+  },
+  {
+    " Brightness ",
+    "BRIGHT",
+    (void*)&wvar.ws2812b_brightness,
+    tint8u,
+    255,
+    0,
+    255,
+    0,
+    MDC_v1_LED_strip,
+    "",
+    "%d",
+    WS2812B_update_output_lut,
+    sizeof(wvar.ws2812b_brightness),
+  },
+  {
+    " White balance red ",
+    "WBRED",
+    (void*)&wvar.ws2812b_wb_red,
+    tint8u,
+    255,
+    0,
+    255,
+    0,
+    MDC_v1_LED_strip,
+    "",
+    "%d",
+    WS2812B_update_output_lut,
+    sizeof(wvar.ws2812b_wb_red),
+  },
+  {
+    " White balance green ",
+    "WBGREEN",
+    (void*)&wvar.ws2812b_wb_green,
+    tint8u,
+    255,
+    0,
+    255,
+    0,
+    MDC_v1_LED_strip,
+    "",
+    "%d",
+    WS2812B_update_output_lut,
+    sizeof(wvar.ws2812b_wb_green),
+  },
+  {
+    " White balance blue ",
+    "WBBLUE",
+    (void*)&wvar.ws2812b_wb_blue,
+    tint8u,
+    255,
+    0,
+    255,
+    0,
+    MDC_v1_LED_strip,
+    "",
+    "%d",
+    WS2812B_update_output_lut,
+    sizeof(wvar.ws2812b_wb_blue),
+  },
+  {
+    " Particles level ADC sample (0-off, 1..16) ",
+    "PTADC",
+    (void*)&wvar.ws2812b_pt_adc,
+    tint8u,
+    0,
+    0,
+    16,
+    0,
+    MDC_v1_LED_strip,
+    "",
+    "%d",
+    0,
+    sizeof(wvar.ws2812b_pt_adc),
+  },
+  {
+    " Frame rate (0-after each frame sent) ",
+    "FPS",
+    (void*)&wvar.ws2812b_fps,
+    tint8u,
+    100,
+    0,
+    200,
+    0,
+    MDC_v1_LED_strip,
+    "",
+    "%d",
+    WS2812B_update_fps,
+    sizeof(wvar.ws2812b_fps),
+  },
 };
@@ -1,8 +1,8 @@
 #ifndef __PARAMS
   #define __PARAMS
 
-#define  DWVAR_SIZE        4
-#define  PARMNU_ITEM_NUM   2
+#define  DWVAR_SIZE        13
+#define  PARMNU_ITEM_NUM   3
 
 
 
@@ -31,6 +31,7 @@ enum enm_parmnlev
     MDC_v1_0,
     MDC_v1_main,
     MDC_v1_General,
+    MDC_v1_LED_strip,
 };
 
 
@@ -69,6 +70,15 @@ typedef struct
   uint8_t        en_verbose_log;                // Enable verbose log | def.val.= 0
   uint8_t        name[64];                      // Product  name | def.val.= MDC 1.0
   uint8_t        ver[64];                       // Firmware version | def.val.= ?
+  uint16_t       ws2812b_leds_num;              // LEDs number | def.val.= 122
+  uint8_t        ws2812b_strips_num;            // Strips number | def.val.= 1
+  uint8_t        ws2812b_color_order;           // Color order (0-GRB, 1-RGB, 2-GRBW) | def.val.= 0
+  uint8_t        ws2812b_brightness;            // Brightness | def.val.= 255
+  uint8_t        ws2812b_wb_red;                // White balance red | def.val.= 255
+  uint8_t        ws2812b_wb_green;              // White balance green | def.val.= 255
+  uint8_t        ws2812b_wb_blue;               // White balance blue | def.val.= 255
+  uint8_t        ws2812b_pt_adc;                // Particles level ADC sample (0-off, 1..16) | def.val.= 0
+  uint8_t        ws2812b_fps;                   // Frame rate (0-after each frame sent) | def.val.= 100
 } WVAR_TYPE;
 
 
@@ -4,7 +4,17 @@
 #define APPLICATION_TASK LEDSC_task
 
 #include   "LEDSC_main.h"
+#include   "LEDSC_script.h"
+#include   "LEDSC_WS2812B_vm.h"
+#include   "LEDSC_WS2812B_noise.h"
+#include   "LEDSC_WS2812B_fx.h"
+#include   "LEDSC_WS2812B_pt.h"
 #include   "LEDSC_WS2812B.h"
+#include   "LEDSC_capture.h"
+#include   "LEDSC_WS2812B_GPIO.h"
+#include   "LEDSC_WS2812B_SPI.h"
+#include   "LEDSC_WS2812B_hsv.h"
+#include   "LEDSC_WS2812B_blend.h"
 
 #endif // LEDSC__H
 
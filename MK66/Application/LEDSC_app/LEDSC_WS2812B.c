@@ -4,68 +4,293 @@
 // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 #include   "App.h"
 
-//#define RESET_BITS_CNT 50
-#define   COLRS          3
-#define   LEDS_NUM       122//78
-#define   WS2812B_BITS_NUM (8*COLRS*LEDS_NUM)
+//  ,        ws2812b_leds_num, ws2812b_strips_num, ws2812b_color_order
+//    .        
 
-#define   MAX_PTTRN_LEN 64 //       
+#define   MAX_PTTRN_LEN 64 //    
 
+#define   WS2812B_STREAM_MODE  //          DMA   RGB
+                               //        RAM  (48   )
+
+#define   WS2812B_OUTPUT  ws2812b_ftm_backend //   : ws2812b_ftm_backend -  FTM0,
+                                              // ws2812b_gpio_backend -   GPIO (LEDSC_WS2812B_GPIO.c), ws2812b_spi_backend -  DSPI (LEDSC_WS2812B_SPI.c)
+
+#define   WS2812B_EVT_FRAME_DONE  BIT(0) //        
+#define   WS2812B_EVT_RENDER      BIT(1) //    :        
+#define   WS2812B_EVT_STRIP_DONE(s) (1u << ((s) + 8)) //        s
+
+#define   WS2812B_DIRTY_WORDS(n)  (((n) + 31) / 32) //       
+#define   WS2812B_KEEPALIVE_TICKS 200 //          
+#define   WS2812B_CATCHUP_TICKS   50  //      .     
+
+#define   WS2812B_RAMP_ROUND(d)   (((d) > 0) ? 0xFFFF : 0) //    Q16       
+
+#define   SM_NONE                 0xFFFF //          
+#define   SM_BEFORE(a, b)         ((int32_t)((a) - (b)) < 0) //      
+
+#define   WS2812B_STRIP_INT_NUM(dma_ch) (INT_DMA0_DMA16 + ((dma_ch) & 0x0F)) //     DMA.  N  N+16   
 
 uint32_t  enable_led_strip;
 
-static   T_DMA_WS2812B_config  ws2812B_DMA_cfg;
+//    FTM0   DMA 
+typedef struct
+{
+  uint8_t   ftm_ch;
+  uint8_t   dma_ch;
+} T_WS2812B_strip_map;
+
+static const T_WS2812B_strip_map ws2812b_strip_map[WS2812B_STRIPS_MAX] =
+{
+  { FTM_CH_2, DMA_WS2812B_CH  }, // PTC3
+  { FTM_CH_0, DMA_WS2812B_CH1 }, // PTC1
+  { FTM_CH_1, DMA_WS2812B_CH2 }, // PTC2
+  { FTM_CH_3, DMA_WS2812B_CH3 }, //   3..7  K66BLEZ1_LEDSC_pins.h  
+  { FTM_CH_4, DMA_WS2812B_CH4 },
+  { FTM_CH_5, DMA_WS2812B_CH5 },
+  { FTM_CH_6, DMA_WS2812B_CH6 },
+  { FTM_CH_7, DMA_WS2812B_CH7 },
+};
+
+static   T_DMA_WS2812B_config  ws2812B_DMA_cfg[WS2812B_STRIPS_MAX];
+static   uint32_t              ws2812b_strips;  //   
+static volatile uint32_t       strips_busy;     //          
+static uint32_t                strips_t0;       //        
+static uint32_t                strips_bits;     //     .      
+static void                  (*strips_done)(void); //         
+
+#ifdef WS2812B_STREAM_MODE
+
+//       
+typedef struct
+{
+  uint16_t          *buf;          //         WS2812B_STREAM_LEDS .  DMA   ,    
+  const uint32_t    *frame;        //       
+  uint32_t           led_num;      //    
+  uint32_t           led_pos;      //       
+  uint32_t           half;         //       
+} T_WS2812B_stream_cbl;
+
+static T_WS2812B_stream_cbl scbl[WS2812B_STRIPS_MAX];
+static uint32_t             stream_words; //   PWM   
+static volatile uint32_t    stream_underrun; //      
+
+#define  WS2812B_TCD_NUM       1 //   
 
-//           DMA
+#else
+
+//          DMA.
+//        strip_words ,     DMA.
+//      ,        
 typedef struct
 {
-  uint16_t  buf[LEDS_NUM][COLRS][8];
-  uint16_t  bend;
+  uint16_t *buf;
+  uint32_t *dirty; //         .  DMA  
 } T_WS2812B_bits;
 
+static T_WS2812B_bits    WS2812B_bits[2]; //       
+static uint32_t          strip_words;     //   PWM   
+
+static T_WS2812B_bits   *front_bits; //    
+static T_WS2812B_bits   *back_bits;  //    
+
+//   DMA      :  ,      .
+//            scatter/gather   DLAST_SGA,
+//        .
+//          ,     .
+//       :  CnV = 0        DMA 
+#define  WS2812B_TCD_DATA      0 //  
+#define  WS2812B_TCD_LATCH     1 //    
+#define  WS2812B_TCD_CHAIN     2 //      
+#define  WS2812B_TCD_NUM       (2 * WS2812B_TCD_CHAIN)
+
+static uint16_t          ws2812b_latch_word; //    
+
+#endif
+
+#ifdef __ICCARM__
+#pragma data_alignment= 32 //    scatter/gather   32 
+#endif
+static T_DMA_TCD         ws2812b_tcd[WS2812B_STRIPS_MAX][WS2812B_TCD_NUM]; //   DMA 
+
+//      RGB.
+//       DMA,    .
+//                 ,
+//         
+static T_WS2812B_geometry ws2812b_geom; //  
+static uint32_t           ws2812b_ready; //    
+static uint32_t          *front_frame;
+static uint32_t          *back_frame;
+static volatile uint32_t  back_ready; //      
+static volatile uint32_t  out_busy;   //         
+
+static const T_WS2812B_backend *ws2812b_out = &WS2812B_OUTPUT; //   
+
+static LWEVENT_STRUCT     ws2812b_lwev;
+static T_WS2812B_stat     ws2812b_stat; //     
+
+//     PIT1    ws2812b_fps ,   ,   
+static volatile uint32_t  render_fps;   //   , 0 -     
+static uint32_t           render_pit;   //    PIT1 
+static volatile uint32_t  render_req;   //     
+
+static uint32_t           render_changed;   //       
+static uint32_t           render_converted; //   HSV -> RGB   
+static uint32_t           render_capture;   //         ,     
+
 //         WS2812B
 typedef struct
 {
-  uint32_t  cnt;         //   
-  uint32_t  *chain_ptr;  //      
-  uint32_t  *curr_ptr;   //      
-  uint32_t  code;
-  uint32_t  data;
+  uint32_t  deadline;    //     ,      
+  uint32_t  start;       //     
+  const uint8_t *chain_ptr; //      
+  const uint8_t *curr_ptr;  //      
+  uint32_t  data;        //      
   uint32_t  prev_hsv;
   uint32_t  hsv;
   uint32_t  duration;
-  uint32_t  jmp_done;    //      
+  uint32_t  phase;       //     
+  uint32_t  tscale;      //       Q16,   
+  uint32_t  out_key;     //   HSV  .       
+  T_WS2812B_ramp ramp;   //   
+  uint16_t  heap_pos;    //      SM_NONE
+  uint16_t  ramp_pos;    //       SM_NONE
+  uint8_t   loop_cnt;    //   WS2812B_OP_LOOP
 } T_WS2812B_sm_cbl;
 
-
-//        
-#define  B_JMP   BIT(31)
-#define  B_STOP  BIT(30)
-#define  B_RAMP  BIT(29)
-
+static T_WS2812B_sm_cbl *lcbl; //    
+
+//   .
+//           ,
+//           .
+//             
+static uint32_t         sm_tick;                     //    
+static uint16_t        *sm_heap;                     //  .  -    
+static uint32_t         sm_heap_len;
+static uint16_t        *sm_ramps;                    //     
+static uint32_t         sm_ramps_cnt;
+static uint16_t        *sm_jmps;                     //         
+static uint32_t         sm_jmps_cnt;
+static volatile uint32_t *sm_req;                    //         sm_slot
+
+//   .
+//   -         sm_batch_pub.
+//              sm_batch_done.
+//        ,   - ,     .
+//      sm_batch_open  LDREX/STREX,       
 typedef struct
 {
-  uint32_t  code;
-  //    code
-  //       
-  //  31             ,      data         
-  //  30             .        
-  //  29              .               data
-  //  24..0               [hue] - 0..360 (9 bit), [saturation] - 0..255 (8 bit),  [value] - 0..255 (8-bit)
-
-  uint32_t  data;  //             
-
-} T_pattrn_item;
-
-#pragma data_alignment= 64
-static T_WS2812B_bits WS2812B_bits; //         DMA
-
-static T_WS2812B_sm_cbl lcbl[LEDS_NUM]; //    
-static uint32_t g_atten; //  
+  const uint8_t *pattern; //   , 0 -  
+  uint32_t  phase;        //    
+  uint32_t  tscale;       //     Q16
+} T_WS2812B_sm_batch;
+
+static T_WS2812B_sm_batch *sm_batch;                 //    
+static uint32_t        *sm_batch_map;                //      
+static volatile uint32_t sm_batch_pub;               //   
+static volatile uint32_t sm_batch_done;              //    
+static volatile uint32_t sm_batch_open;              //  : WS2812B_Batch_begin ,    
+
+//    .
+//         seq      sm_req.
+//                  ,
+//             .    .
+//          LDREX/STREX,   sm_req.
+//     :   ,       ,  
+typedef struct
+{
+  volatile uint32_t  seq; //  .  -  
+  T_WS2812B_sm_batch a;   // 
+} T_WS2812B_sm_slot;
+
+static T_WS2812B_sm_slot *sm_slot;                   //   
+
+//    WS2812B_pattern_check.       ,
+//         .   
+static const uint8_t   *pat_checked[WS2812B_PATTERNS_MAX];
+static volatile uint32_t pat_checked_num;
+
+//    .  -,           .
+//      : 0 - , 1 - , 2 - , 3 - .
+//    ,        .
+//          ,         
+static uint8_t            out_luts[2][WS2812B_COLRS_MAX][256];
+const uint8_t           (*ws2812b_out_lut)[256] = out_luts[0];
+static volatile uint32_t  out_lut_changed; //   .     
+
+//    WS2812B_SRC_...          
+static volatile uint32_t  src_mode_req; //  
+static uint32_t           src_mode;     //  
+
+//  .         256 .
+//      ,        .
+//      ,    - 256     
+static uint8_t           *pal_idx;      //   
+static uint32_t           pal[256];     //    RGB
+static volatile uint32_t  pal_offs;     //      .     
+static volatile uint32_t  pal_changed;  //   ,   .    
+
+//  .           
+static T_WS2812B_fx         fx;
+static T_WS2812B_fx_params  fx_req_params; //   .    
+static volatile uint32_t    fx_req;        //    
+static uint8_t             *fx_heat;       //   
+static uint32_t             fx_ms;         //      
+static uint32_t             fx_ms_acc;     //     
+static uint32_t             ws2812b_tps;   //    
+static uint32_t             ws2812b_tick_us;  //    
+static uint32_t             ws2812b_hw_us;    //       
+//   WS2812B_FX_SCRIPT.           
+static T_WS2812B_vm_prog    fx_progs[2];
+static T_WS2812B_vm_prog * volatile fx_prog_req; //    , 0 -   
+
+//  .      WS2812B_PT_LAYER    .
+//        ,       
+#define  WS2812B_PT_REQ_NUM   8 //     
+static T_WS2812B_pt_pool     pt_pool;
+static uint32_t             *pt_frame;  //     RGB
+static T_WS2812B_pt_spawn    pt_req[WS2812B_PT_REQ_NUM];
+static volatile uint32_t     pt_req_wr; //    
+static volatile uint32_t     pt_req_rd; //    
+static T_WS2812B_pt_emitter  pt_em;     //    
+static volatile uint32_t     pt_em_seq; //   
+static volatile uint32_t     pt_level = 255; //    0..255
+static uint32_t              pt_ms_acc; //     
+static uint32_t              pt_on;     //    
+
+static uint32_t           demo_rnd = 1; //      
+
+//  .   ( ,   )    RGB,
+//       ,      .
+//    ,            .
+//         ,     
+static uint32_t          *src_frame;    //      RGB
+static uint32_t          *comp_frame;   //      RGB
+static T_WS2812B_layer    comp_layers[WS2812B_LAYERS_MAX]; // .    
+static uint32_t           comp_on;      //      
+
+//        .
+//        
+#define   DEMO_HUE1_OFFS  1
+#define   DEMO_HUE2_OFFS  9
+#define   DEMO_HUE3_OFFS  15
+
+static uint8_t demo_chain[MAX_PTTRN_LEN] =
+{
+  WS2812B_P_RAMPS(WS2812B_HUE8(120), 255, 400),  // 
+  WS2812B_P_RAMPS_SD(0, 0),                      // 
+  WS2812B_P_RAMPS_SD(WS2812B_HUE8(240), 255),    // 
+  WS2812B_P_RAMPS_SD(0, 0),
+  WS2812B_P_RAMPS_SD(WS2812B_HUE8(0), 255),      // 
+  WS2812B_P_RAMPS_SD(0, 0),
+  WS2812B_P_JMP(-23),                            //   
+};
 
-static uint32_t ptrns_arr[LEDS_NUM][MAX_PTTRN_LEN];  //   
+//      8   PWM.
+//  32-     16-   CnV     (  -   ),
+//     DMA ,   
+static uint32_t bits_lut[256][4];
 
-//     HSV -> RGB
+// -  .    
 const uint8_t         dim_curve[256] = {
   0, 1, 1, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3,
   3, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4,
@@ -86,482 +311,2544 @@ const uint8_t         dim_curve[256] = {
 };
 
 static void  WS2812B_state_automat(void);
+static void  WS2812B_src_switch(void);
+static void  WS2812B_batch_apply(void);
+static void  WS2812B_sm_assign(uint32_t n, const T_WS2812B_sm_batch *b, uint32_t start);
+static void  WS2812B_bits_set(volatile uint32_t *w, uint32_t m);
+static uint32_t WS2812B_bits_take(volatile uint32_t *w, uint32_t m);
+static uint32_t WS2812B_claim(volatile uint32_t *w);
+static uint32_t WS2812B_pattern_ok(const uint8_t *pattern);
+static uint32_t WS2812B_rd16(const uint8_t *ptr);
+static void  WS2812B_schedule(uint32_t n, uint32_t deadline);
+static void  WS2812B_ramp_remove(uint32_t n);
+static void  WS2812B_ramps_render(void);
+static void  WS2812B_pal_render(void);
+static void  WS2812B_fx_frame(uint32_t us);
+static void  WS2812B_comp_render(void);
+static void  WS2812B_pt_frame(uint32_t us);
+static uint32_t WS2812B_norm_hue(uint32_t hue);
+static void  WS2812B_output_start(void);
+
 /*-----------------------------------------------------------------------------------------------------
- 
- \param void 
+          PWM
 -----------------------------------------------------------------------------------------------------*/
-static void WS2812B_init_bits(void)
+static void WS2812B_init_bits_lut(void)
 {
-  uint32_t i, j, k;
+  uint32_t b, i;
+  uint32_t w0, w1;
 
-  for (i = 0; i < LEDS_NUM; i++)
+  for (b = 0; b < 256; b++)
   {
-    for (j = 0; j < COLRS; j++)
+    for (i = 0; i < 4; i++)
     {
-      for (k = 0; k < 8; k++)
-      {
-        WS2812B_bits.buf[i][j][k] = FTM_WS2812B_0;
-      }
+      //     
+      if ((b >> (7 - i * 2)) & 1) w0 = FTM_WS2812B_1;
+      else w0 = FTM_WS2812B_0;
+      if ((b >> (6 - i * 2)) & 1) w1 = FTM_WS2812B_1;
+      else w1 = FTM_WS2812B_0;
+      bits_lut[b][i] = w0 | (w1 << 16);
     }
   }
-  WS2812B_bits.bend = 0;
 }
 
+/*-----------------------------------------------------------------------------------------------------
+         PWM      ,
+   WS2812B - 24    G, R, B.        
+
+  dst -     ws2812b_geom.bits_per_led ,     4 
+  rgb -    RGB (WWWWWWWW RRRRRRRR GGGGGGGG BBBBBBBB)
+-----------------------------------------------------------------------------------------------------*/
+void WS2812B_encode_rgb(uint16_t *dst, uint32_t rgb)
+{
+  uint32_t       *d = (uint32_t *)dst;
+  const uint32_t *s;
+  const uint8_t (*lut)[256] = ws2812b_out_lut;
+  uint32_t        c;
+  uint32_t        sh;
+
+  for (c = 0; c < ws2812b_geom.colrs; c++)
+  {
+    sh = ws2812b_geom.shift[c];
+    s  = bits_lut[lut[sh >> 3][(rgb >> sh) & 0xFF]]; //     
+    d[0] = s[0];
+    d[1] = s[1];
+    d[2] = s[2];
+    d[3] = s[3];
+    d += 4;
+  }
+}
 
 /*-----------------------------------------------------------------------------------------------------
- 
- \param cfg 
+            .
+        
+
+     -,   256   .
+      -  ,   RGBW  
 -----------------------------------------------------------------------------------------------------*/
-static void WS2812B_init_DMA_TCD(T_DMA_WS2812B_config *cfg)
+void WS2812B_update_output_lut(void)
 {
-  DMA_MemMapPtr    DMA     = DMA_BASE_PTR;
+  uint8_t  (*lut)[256];
+  uint32_t   scale[WS2812B_COLRS_MAX];
+  uint32_t   bri = wvar.ws2812b_brightness;
+  uint32_t   c, i;
+
+  if (ws2812b_out_lut == (const uint8_t (*)[256])out_luts[0]) lut = out_luts[1];
+  else lut = out_luts[0];
+
+  scale[0] = wvar.ws2812b_wb_blue;
+  scale[1] = wvar.ws2812b_wb_green;
+  scale[2] = wvar.ws2812b_wb_red;
+  scale[3] = 255;
+  for (c = 0; c < WS2812B_COLRS_MAX; c++)
+  {
+    for (i = 0; i < 256; i++)
+    {
+      lut[c][i] = (dim_curve[(i * bri + 127) / 255] * scale[c] + 127) / 255;
+    }
+  }
+  ws2812b_out_lut = (const uint8_t (*)[256])lut;
+  out_lut_changed = 1;
+}
+
+/*-----------------------------------------------------------------------------------------------------
+      
+
+   0   
+-----------------------------------------------------------------------------------------------------*/
+static uint32_t WS2812B_init_geometry(void)
+{
+  T_WS2812B_geometry *g = &ws2812b_geom;
+  uint32_t            strips;
+
+  memset(g, 0, sizeof(T_WS2812B_geometry));
+  if ((wvar.ws2812b_leds_num == 0) || (wvar.ws2812b_leds_num > WS2812B_LEDS_MAX)) return 0;
+  strips = wvar.ws2812b_strips_num;
+  if (strips == 0) strips = 1;
+  if (strips > WS2812B_STRIPS_MAX) strips = WS2812B_STRIPS_MAX;
+
+  g->leds_num   = wvar.ws2812b_leds_num;
+  g->strip_leds = (g->leds_num + strips - 1) / strips;
+  g->strips_num = (g->leds_num + g->strip_leds - 1) / g->strip_leds; //      
+  g->order      = wvar.ws2812b_color_order;
+
+  switch (g->order)
+  {
+  case WS2812B_ORDER_GRB:
+    g->colrs    = 3;
+    g->shift[0] = 8;
+    g->shift[1] = 16;
+    g->shift[2] = 0;
+    break;
+  case WS2812B_ORDER_RGB:
+    g->colrs    = 3;
+    g->shift[0] = 16;
+    g->shift[1] = 8;
+    g->shift[2] = 0;
+    break;
+  case WS2812B_ORDER_GRBW:
+    g->colrs    = 4;
+    g->shift[0] = 8;
+    g->shift[1] = 16;
+    g->shift[2] = 0;
+    g->shift[3] = 24;
+    break;
+  default:
+    return 0;
+  }
+  g->bits_per_led = g->colrs * 8;
+  return 1;
+}
 
-  //   DMA      RAM     0  1    PWM
+/*-----------------------------------------------------------------------------------------------------
+          .     
+
+   0   
+-----------------------------------------------------------------------------------------------------*/
+static uint32_t WS2812B_init_bits(void)
+{
+  uint32_t n = ws2812b_geom.leds_num;
+
+  WS2812B_init_bits_lut();
+  WS2812B_update_output_lut();
+
+  front_frame = (uint32_t *)_mem_alloc_system_zero(2 * n * sizeof(uint32_t));
+  lcbl        = (T_WS2812B_sm_cbl *)_mem_alloc_system_zero(n * sizeof(T_WS2812B_sm_cbl));
+  sm_heap     = (uint16_t *)_mem_alloc_system_zero(n * sizeof(uint16_t));
+  sm_ramps    = (uint16_t *)_mem_alloc_system_zero(n * sizeof(uint16_t));
+  sm_jmps     = (uint16_t *)_mem_alloc_system_zero(n * sizeof(uint16_t));
+  sm_req      = (uint32_t *)_mem_alloc_system_zero(WS2812B_DIRTY_WORDS(n) * sizeof(uint32_t));
+  sm_slot     = (T_WS2812B_sm_slot *)_mem_alloc_system_zero(n * sizeof(T_WS2812B_sm_slot));
+  sm_batch    = (T_WS2812B_sm_batch *)_mem_alloc_system_zero(n * sizeof(T_WS2812B_sm_batch));
+  sm_batch_map = (uint32_t *)_mem_alloc_system_zero(WS2812B_DIRTY_WORDS(n) * sizeof(uint32_t));
+  pal_idx     = (uint8_t *)_mem_alloc_system_zero(n);
+  fx_heat     = (uint8_t *)_mem_alloc_system_zero(n);
+  src_frame   = (uint32_t *)_mem_alloc_system_zero(2 * n * sizeof(uint32_t));
+  pt_frame    = (uint32_t *)_mem_alloc_system_zero(n * sizeof(uint32_t));
+  if ((front_frame == 0) || (lcbl == 0) || (sm_heap == 0) || (sm_ramps == 0) || (sm_jmps == 0) || (sm_req == 0) || (sm_slot == 0) || (sm_batch == 0) || (sm_batch_map == 0) || (pal_idx == 0) || (fx_heat == 0) || (src_frame == 0) || (pt_frame == 0))
+  {
+    LOGs(__FUNCTION__, __LINE__, SEVERITY_RED, "Not enough memory for %d LEDs.", n);
+    return 0;
+  }
+  back_frame  = front_frame + n;
+  comp_frame  = src_frame + n;
+  WS2812B_pt_init(&pt_pool);
+  back_ready  = 0;
+  out_busy    = 0;
+  return 1;
+}
 
-  DMA->TCD[cfg->dma_ch].SADDR = cfg->saddr;                   //  -   
-  DMA->TCD[cfg->dma_ch].SOFF = 2;                             //     2    
-                                                              // DMA->TCD[cfg->dma_ch].SLAST = (uint32_t)(-cfg->arrsz * 2);    //          DMA (  )
-  DMA->TCD[cfg->dma_ch].SLAST = 0;
-  DMA->TCD[cfg->dma_ch].DADDR = cfg->daddr;                   //   -  PUSHR SPI
-  DMA->TCD[cfg->dma_ch].DOFF = 0;                             //       
-  DMA->TCD[cfg->dma_ch].DLAST_SGA = 0;                        //    
-  DMA->TCD[cfg->dma_ch].NBYTES_MLNO = 2;                      //       DMA (  )
 
-  DMA->TCD[cfg->dma_ch].BITER_ELINKNO = 0 //TCD Beginning Minor Loop Link
+/*-----------------------------------------------------------------------------------------------------
+    DMA   16-     CnV   
+   0  1    PWM.  SLAST, DLAST_SGA  CSR    
+
+ \param tcd   -   RAM
+ \param daddr -   CnV
+ \param saddr -  
+ \param soff  -      , 0 -   
+ \param cnt   -  
+-----------------------------------------------------------------------------------------------------*/
+static void WS2812B_init_TCD(T_DMA_TCD *tcd, uint32_t daddr, uint32_t saddr, uint32_t soff, uint32_t cnt)
+{
+  tcd->SADDR = saddr;                   //  -   
+  tcd->SOFF = soff;                     //      
+  tcd->SLAST = 0;
+  tcd->DADDR = daddr;                   //   -  CnV  
+  tcd->DOFF = 0;                        //       
+  tcd->DLAST_SGA = 0;
+  tcd->NBYTES_MLNO = 2;                 //       DMA (  )
+
+  tcd->BITER_ELINKNO = 0 //TCD Beginning Minor Loop Link
     + LSHIFT(0, 15)                  // ELINK  |   
-    + LSHIFT(cfg->arrsz, 0)          // BITER  | Starting Major Iteration Count (15 bit)   CITER     
+    + LSHIFT(cnt, 0)                 // BITER  | Starting Major Iteration Count (15 bit)   CITER     
   ;
-  DMA->TCD[cfg->dma_ch].CITER_ELINKNO = 0 //TCD Current Minor Loop Link
+  tcd->CITER_ELINKNO = 0 //TCD Current Minor Loop Link
     + LSHIFT(0, 15)                  // ELINK  |   
-    + LSHIFT(cfg->arrsz, 0)          // CITER  | Current Major Iteration Count (15 bit)
+    + LSHIFT(cnt, 0)                 // CITER  | Current Major Iteration Count (15 bit)
   ;
-  DMA->TCD[cfg->dma_ch].ATTR = 0
+  tcd->ATTR = 0
     + LSHIFT(0, 11) // SMOD  |     
     + LSHIFT(1, 8)  // SSIZE | 16-    
     + LSHIFT(0, 3)  // DMOD  |   
     + LSHIFT(1, 0)  // DSIZE | 16-    
   ;
-  DMA->TCD[cfg->dma_ch].CSR = 0
-    + LSHIFT(0, 14) // BWC         | Bandwidth Control. 00 No eDMA engine stalls
-    + LSHIFT(0, 8)  // MAJORLINKCH |   .        
-    + LSHIFT(0, 7)  // DONE        | This flag indicates the eDMA has completed the major loop.
-    + LSHIFT(0, 6)  // ACTIVE      | This flag signals the channel is currently in execution
-    + LSHIFT(0, 5)  // MAJORELINK  |   
-    + LSHIFT(0, 4)  // ESG         |    
-    + LSHIFT(1, 3)  // DREQ        | Disable Request. If this flag is set, the eDMA hardware automatically clears the corresponding ERQ bit when the current major iteration count reaches zero.
-    + LSHIFT(0, 2)  // INTHALF     | Enable an interrupt when major counter is half complete
-    + LSHIFT(0, 1)  // INTMAJOR    |      DMA
-    + LSHIFT(0, 0)  // START       | Channel Start. If this flag is set, the channel is requesting service.
-  ;
-  DMA->SERQ = cfg->dma_ch; //    DMA
-  DMA->SSRT = cfg->dma_ch; //    DMA,            0
+  tcd->CSR = 0;
 }
 
 /*-----------------------------------------------------------------------------------------------------
-       DMA  WS2812B
- 
-----------------------------------------------------------------------------------------------------*/
-static void WS2812B_init_DMA_stream(T_DMA_WS2812B_config *cfg)
-{
-  if (cfg->ftm_ch > 7) return;
-
-  cfg->DMAMUX->CHCFG[cfg->dma_ch] = cfg->dmux_src + BIT(7); //        (   SPI)     DMA
+    DMA .      
 
-  WS2812B_init_DMA_TCD(cfg);
+ \param cfg -   s
+ \param s   -  
+-----------------------------------------------------------------------------------------------------*/
+static void WS2812B_build_TCD(const T_DMA_WS2812B_config *cfg, uint32_t s)
+{
+  T_DMA_TCD  *tcd = ws2812b_tcd[s];
+#ifdef WS2812B_STREAM_MODE
 
-  cfg->FTM->OUTMASK &= ~LSHIFT(1, cfg->ftm_ch);             //   
-  cfg->FTM->CONTROLS[cfg->ftm_ch].CnSC |= 0
-    + LSHIFT(1, 6) // CHIE.
-    + LSHIFT(1, 0) // DMA.  1 Enable DMA transfers.
+  //    .           
+  WS2812B_init_TCD(tcd, cfg->daddr, cfg->saddr, 2, cfg->arrsz);
+  tcd->SLAST = (uint32_t)(-cfg->arrsz * 2);  //          DMA (  )
+  tcd->CSR = 0
+    + LSHIFT(0, 4)  // ESG         |    
+    + LSHIFT(0, 3)  // DREQ        |       
+    + LSHIFT(1, 2)  // INTHALF     |       
+    + LSHIFT(1, 1)  // INTMAJOR    |       
   ;
-}
+#else
+  uint32_t    b;
+  T_DMA_TCD  *c;
 
+  for (b = 0; b < 2; b++)
+  {
+    c = &tcd[b * WS2812B_TCD_CHAIN];
+
+    WS2812B_init_TCD(&c[WS2812B_TCD_DATA], cfg->daddr, (uint32_t)(WS2812B_bits[b].buf + s * strip_words), 2, strip_words);
+    c[WS2812B_TCD_DATA].DLAST_SGA = (uint32_t)&c[WS2812B_TCD_LATCH];
+    c[WS2812B_TCD_DATA].CSR = 0
+      + LSHIFT(1, 4)  // ESG         |       
+    ;
+
+    WS2812B_init_TCD(&c[WS2812B_TCD_LATCH], cfg->daddr, (uint32_t)&ws2812b_latch_word, 0, 1);
+    c[WS2812B_TCD_LATCH].DLAST_SGA = (uint32_t)&tcd[(b ^ 1) * WS2812B_TCD_CHAIN + WS2812B_TCD_DATA];
+    c[WS2812B_TCD_LATCH].CSR = 0
+      + LSHIFT(1, 4)  // ESG         |    .     
+      + LSHIFT(1, 3)  // DREQ        |     
+    ;
+  }
+#endif
+}
 
 /*-----------------------------------------------------------------------------------------------------
- 
- \param tid 
- \param data_ptr 
- \param secs 
- \param msecs 
+      DMA.  CSR  ,      DLAST_SGA
+
+ \param ch  -  DMA
+ \param tcd -   RAM
 -----------------------------------------------------------------------------------------------------*/
-static void  WS2812B_refresh(_timer_id tid, void *data_ptr, uint32_t secs, uint32_t msecs)
+static void WS2812B_load_TCD(uint32_t ch, const T_DMA_TCD *tcd)
 {
   DMA_MemMapPtr    DMA     = DMA_BASE_PTR;
-  DMA->INT = BIT(DMA_WS2812B_CH); //     
 
-  WS2812B_init_DMA_TCD(&ws2812B_DMA_cfg);
+  while (DMA->TCD[ch].CSR & BIT(6)); //        
+  DMA->CDNE = ch;                    //  DONE   ESG
+  DMA->TCD[ch].SADDR         = tcd->SADDR;
+  DMA->TCD[ch].SOFF          = tcd->SOFF;
+  DMA->TCD[ch].ATTR          = tcd->ATTR;
+  DMA->TCD[ch].NBYTES_MLNO   = tcd->NBYTES_MLNO;
+  DMA->TCD[ch].SLAST         = tcd->SLAST;
+  DMA->TCD[ch].DADDR         = tcd->DADDR;
+  DMA->TCD[ch].DOFF          = tcd->DOFF;
+  DMA->TCD[ch].CITER_ELINKNO = tcd->CITER_ELINKNO;
+  DMA->TCD[ch].BITER_ELINKNO = tcd->BITER_ELINKNO;
+  DMA->TCD[ch].DLAST_SGA     = tcd->DLAST_SGA;
+  DMA->TCD[ch].CSR           = tcd->CSR;
 }
 
 /*-----------------------------------------------------------------------------------------------------
- 
- \param void 
+     DMA  
+
+    DMA  CnV       PWM,
+          ,     .
+       ,         .
+           
 -----------------------------------------------------------------------------------------------------*/
-void WS2812B_periodic_refresh(void)
+static void WS2812B_start_strips(void)
 {
-  int32_t           n;
-  static uint32_t   color1;
-  static uint32_t   color2;
-  static uint32_t   color3;
-
-
   DMA_MemMapPtr    DMA     = DMA_BASE_PTR;
-  DMA->INT = BIT(DMA_WS2812B_CH); //     
+  uint32_t         s;
 
-  if (enable_led_strip==1)
+  while (ws2812B_DMA_cfg[0].FTM->CNT >= (FTM_WS2812B_MOD / 2));
+  for (s = 0; s < ws2812b_strips; s++)
+  {
+    DMA->SERQ = ws2812B_DMA_cfg[s].dma_ch; //    DMA
+  }
+  for (s = 0; s < ws2812b_strips; s++)
   {
+    DMA->SSRT = ws2812B_DMA_cfg[s].dma_ch; //    DMA,            0
+  }
+}
 
-    WS2812B_init_DMA_TCD(&ws2812B_DMA_cfg);
+#ifdef WS2812B_STREAM_MODE
+/*-----------------------------------------------------------------------------------------------------
+        .
+       .       DMA,
+     CnV 0      -  
+-----------------------------------------------------------------------------------------------------*/
+static void WS2812B_stream_fill_half(uint32_t s, uint32_t half)
+{
+  uint32_t              i;
+  T_WS2812B_stream_cbl *p = &scbl[s];
+  uint32_t              bpl = ws2812b_geom.bits_per_led;
+  uint16_t             *b = p->buf + half * (stream_words / 2);
 
-    WS2812B_state_automat();
+  if (p->led_pos >= p->led_num)
+  {
+    memset(b, 0, (stream_words / 2) * sizeof(uint16_t));
+    return;
+  }
 
-    //      
-    for (n = 0; n < LEDS_NUM; n++)
+  for (i = 0; i < WS2812B_STREAM_LEDS; i++)
+  {
+    if (p->led_pos < p->led_num)
     {
-      if (lcbl[n].jmp_done != 0)
-      {
-        if (n == 0)
-        {
-          //     0,   
-          //         [hue] - 0..360 (9 bit), [saturation] - 0..255 (8 bit),  [value] - 0..255 (8-bit)
-          color1 = (rand() & 0x1FF0000) + 0xFFFF;
-          color2 = (rand() & 0x1FF0000) + 0xFFFF;
-          color3 = (rand() & 0x1FF0000) + 0xFFFF;
-        }
-
-        //     
-        ptrns_arr[n][2] = color1 + B_RAMP;
-        ptrns_arr[n][3] = 400;
-        ptrns_arr[n][4] = HSV_NONE + B_RAMP;
-        ptrns_arr[n][5] = 400;
-        ptrns_arr[n][6] = color2 + B_RAMP;
-        ptrns_arr[n][7] = 400;
-        ptrns_arr[n][8] = HSV_NONE + B_RAMP;
-        ptrns_arr[n][9] = 400;
-        ptrns_arr[n][10] = color3 + B_RAMP;
-        ptrns_arr[n][11] = 400;
-        ptrns_arr[n][12] = HSV_NONE + B_RAMP;
-        ptrns_arr[n][13] = 400;
-
-        lcbl[n].jmp_done = 0;
-      }
+      WS2812B_encode_rgb(b, p->frame[p->led_pos]);
+      p->led_pos++;
+    }
+    else
+    {
+      memset(b, 0, bpl * sizeof(uint16_t));
     }
+    b += bpl;
   }
-
 }
 
-/*------------------------------------------------------------------------------
-    HSV  RGB   
- 
-   - HSV,       [hue] - 0..360 (9 bit), [saturation] - 0..255 (8 bit),  [value] - 0..255 (8-bit)
- ------------------------------------------------------------------------------*/
-uint32_t Convert_H_S_V_to_RGB(uint32_t hue, uint32_t sat, uint32_t val)
+#endif
+
+/*-----------------------------------------------------------------------------------------------------
+       
+-----------------------------------------------------------------------------------------------------*/
+static void WS2812B_swap_frames(void)
 {
-  uint32_t   r;
-  uint32_t   g;
-  uint32_t   b;
-  uint32_t   base;
-  uint32_t   rgb;
+  uint32_t        *p;
 
-  val = dim_curve[val];
-  sat = 255 - dim_curve[255 - sat];
+  p           = front_frame;
+  front_frame = back_frame;
+  back_frame  = p;
+  ws2812b_out->swap();
+}
 
-  if (sat == 0) // Acromatic color (gray). Hue doesn't mind.
+/*-----------------------------------------------------------------------------------------------------
+         .     .
+     ,         
+-----------------------------------------------------------------------------------------------------*/
+static void WS2812B_frame_end(void)
+{
+  ws2812b_stat.frames++;
+  if (back_ready != 0)
   {
-    rgb = val | (val << 8) | (val << 16);
+    WS2812B_swap_frames();
+    back_ready = 0;
+    WS2812B_output_start();
   }
   else
   {
-    base = ((255 - sat) * val) >> 8;
-    switch (hue / 60)
-    {
-    case 0:
-      r = val;
-      g = (((val - base) * hue) / 60) + base;
-      b = base;
-      break;
-    case 1:
-      r = (((val - base) * (60 - (hue % 60))) / 60) + base;
-      g = val;
-      b = base;
-      break;
-    case 2:
-      r = base;
-      g = val;
-      b = (((val - base) * (hue % 60)) / 60) + base;
-      break;
-    case 3:
-      r = base;
-      g = (((val - base) * (60 - (hue % 60))) / 60) + base;
-      b = val;
-      break;
-    case 4:
-      r = (((val - base) * (hue % 60)) / 60) + base;
-      g = base;
-      b = val;
-      break;
-    case 5:
-      r = val;
-      g = base;
-      b = (((val - base) * (60 - (hue % 60))) / 60) + base;
-      break;
-    }
-    rgb = ((r & 0xFF) << 16) | ((g & 0xFF) << 8) | (b & 0xFF);
+    out_busy = 0;
   }
-  return rgb;
+  _lwevent_set(&ws2812b_lwev, (render_fps == 0) ? (WS2812B_EVT_FRAME_DONE | WS2812B_EVT_RENDER) : WS2812B_EVT_FRAME_DONE);
+}
+
+/*-----------------------------------------------------------------------------------------------------
+            s.      .
+          
+-----------------------------------------------------------------------------------------------------*/
+static void WS2812B_strip_end(uint32_t s)
+{
+  uint32_t t;
+
+  t = Get_cycles_counter();
+  if (strips_busy == BIT(ws2812b_strips) - 1) strips_t0 = t; //    
+  strips_busy &= ~(1u << s);
+  ws2812b_stat.strip_frames[s]++;
+  _lwevent_set(&ws2812b_lwev, WS2812B_EVT_STRIP_DONE(s));
 
+  if (strips_busy == 0)
+  {
+    //         
+    t -= strips_t0;
+    if (t > ws2812b_stat.strips_skew_max_cycles) ws2812b_stat.strips_skew_max_cycles = t;
+    if (strips_done != 0) strips_done();
+  }
 }
 
+/*-----------------------------------------------------------------------------------------------------
+    .     PIT2,     DMA.
 
-/*------------------------------------------------------------------------------
-    HSV  RGB   
- 
-   - HSV,       [hue] - 0..360 (9 bit), [saturation] - 0..255 (8 bit),  [value] - 0..255 (8-bit)
- ------------------------------------------------------------------------------*/
-uint32_t Convert_HSV_to_RGB(uint32_t hsv)
+   CnV = 0         DMA,    
+        ,     DMA   .
+             ,
+             WS2812B_RESET_BITS .
+
+                   .
+    ,      
+         
+-----------------------------------------------------------------------------------------------------*/
+static void WS2812B_reset_end(void)
 {
-  uint32_t   hue;
-  uint32_t   sat;
-  uint32_t   val;
+  DMA_MemMapPtr    DMA     = DMA_BASE_PTR;
+  uint32_t         s;
 
-  hue = (hsv >> 16) & 0x1FF;
-  sat = (hsv >> 8) & 0xFF;
-  val = (hsv >> 0) & 0xFF;
-  return Convert_H_S_V_to_RGB(hue, sat, val);
+#ifdef WS2812B_STREAM_MODE
+  if (stream_underrun != 0)
+  {
+    stream_underrun = 0;
+    for (s = 0; s < ws2812b_strips; s++)
+    {
+      if ((strips_busy & (1u << s)) == 0) continue;
+      DMA->CERQ = ws2812B_DMA_cfg[s].dma_ch;
+      ws2812B_DMA_cfg[s].FTM->CONTROLS[ws2812B_DMA_cfg[s].ftm_ch].CnV = 0;
+    }
+    Start_PIT2((WS2812B_RESET_BITS + 1) * (FTM_WS2812B_MOD + 1));
+    return;
+  }
+#endif
+  for (s = 0; s < ws2812b_strips; s++)
+  {
+    if ((strips_busy & (1u << s)) == 0) continue;
+    DMA->CERQ = ws2812B_DMA_cfg[s].dma_ch; //      ,     
+    WS2812B_strip_end(s);
+  }
 }
 
-/*------------------------------------------------------------------------------
-     
-   color -    HSV
- ------------------------------------------------------------------------------*/
-void WS2812B_set_led_state(uint32_t ledn, uint32_t hue, uint32_t sat, uint32_t val, uint32_t attn)
+#ifdef WS2812B_STREAM_MODE
+/*-----------------------------------------------------------------------------------------------------
+   DMA.     DMA          ,
+           .
+         .
+
+       WS2812B_STREAM_LEDS * 24 * 76 / 60  = 121.6   4-  RGB,
+  ..  21900   180 .
+               ,  DMA
+      :   ,    
+    ,      WS2812B_reset_end.
+   (make -C MK66/Host sweep)   250     400    4- 
+   : 3.6    , 19.2   8-.          115 
+      120 , 8      30  -  85    90 .
+      K66  isr_max_cycles ( stat),   
+      -isr.
+-----------------------------------------------------------------------------------------------------*/
+static void WS2812B_DMA_isr(void *user_isr_ptr)
 {
-  uint32_t i;
-  uint8_t  c_red;
-  uint8_t  c_green;
-  uint8_t  c_blue;
-  uint32_t color;
-
-  color = Convert_H_S_V_to_RGB(hue, sat, val);
-  c_red   = ((color >> 16) & 0xFF) >> attn;
-  c_green = ((color >> 8) & 0xFF) >> attn;
-  c_blue  = ((color >> 0) & 0xFF) >> attn;
+  DMA_MemMapPtr    DMA     = DMA_BASE_PTR;
+  uint32_t         s;
+  uint32_t         ch;
+  uint32_t         pos;
+  uint32_t         t;
+  T_WS2812B_stream_cbl *p;
 
-  for (i = 0; i < 8; i++)
+  for (s = 0; s < ws2812b_strips; s++)
   {
+    ch = ws2812B_DMA_cfg[s].dma_ch;
+    if ((DMA->INT & (1u << ch)) == 0) continue;
+    DMA->INT = 1u << ch; //     
 
-    // 
-    if ((c_green >> (7 - i)) & 1) WS2812B_bits.buf[ledn][0][i] = FTM_WS2812B_1;
-    else WS2812B_bits.buf[ledn][0][i] = FTM_WS2812B_0;
-    // 
-    if ((c_red >> (7 - i)) & 1) WS2812B_bits.buf[ledn][1][i] = FTM_WS2812B_1;
-    else WS2812B_bits.buf[ledn][1][i] = FTM_WS2812B_0;
-    // 
-    if ((c_blue >> (7 - i)) & 1) WS2812B_bits.buf[ledn][2][i] = FTM_WS2812B_1;
-    else WS2812B_bits.buf[ledn][2][i] = FTM_WS2812B_0;
-  }
-}
+    if ((strips_busy & (1u << s)) == 0) continue;
 
+    p = &scbl[s];
+    t = Get_cycles_counter();
 
-/*-------------------------------------------------------------------------------------------------------------
-         
+    //         
+    pos = stream_words - (DMA->TCD[ch].CITER_ELINKNO & 0x7FFF);
+    if (((p->half == 0) && (pos < (stream_words / 2))) || ((p->half != 0) && (pos >= (stream_words / 2))))
+    {
+      ws2812b_stat.underruns++;
+      stream_underrun = 1;
+    }
 
-       .
-      -   
-      -      
-      0x00000000 -     
-      0xFFFFFFFF -   
+    WS2812B_stream_fill_half(s, p->half);
+    p->half ^= 1;
 
-  n -   0..(LEDS_CNT - 1)
--------------------------------------------------------------------------------------------------------------*/
-void WS2812B_Set_pattern(uint32_t *pattern, uint32_t n)
-{
+    t = Get_cycles_counter() - t;
+    if (t > ws2812b_stat.isr_max_cycles) ws2812b_stat.isr_max_cycles = t;
+  }
+}
+#endif
 
-  if (n >= LEDS_NUM) return;
+/*-----------------------------------------------------------------------------------------------------
+          FTM0
+           
 
-  _int_disable();
-  if ((pattern != 0) && (lcbl[n].chain_ptr != pattern))
+  frame -  .           
+-----------------------------------------------------------------------------------------------------*/
+static void WS2812B_ftm_start(const uint32_t *frame)
+{
+  uint32_t               s;
+#ifdef WS2812B_STREAM_MODE
+
+  strips_busy = BIT(ws2812b_strips) - 1;
+  stream_underrun = 0;
+  for (s = 0; s < ws2812b_strips; s++)
   {
-    lcbl[n].chain_ptr = pattern;
-    lcbl[n].curr_ptr = pattern;
-    lcbl[n].prev_hsv = HSV_NONE;
-    lcbl[n].hsv      = HSV_NONE;
-    lcbl[n].cnt      = 0;
+    scbl[s].frame        = frame + s * ws2812b_geom.strip_leds;
+    scbl[s].led_pos      = 0;
+    WS2812B_stream_fill_half(s, 0);
+    WS2812B_stream_fill_half(s, 1);
+    scbl[s].half         = 0;
+    WS2812B_load_TCD(ws2812B_DMA_cfg[s].dma_ch, ws2812b_tcd[s]); //     ,   
   }
-  _int_enable();
+#else
+  DMA_MemMapPtr          DMA     = DMA_BASE_PTR;
+  uint32_t               ch;
+  uint32_t               b;
+  T_DMA_TCD             *c;
+
+  b = (front_bits == &WS2812B_bits[0]) ? 0 : 1;
+  strips_busy = BIT(ws2812b_strips) - 1;
+  for (s = 0; s < ws2812b_strips; s++)
+  {
+    ch = ws2812B_DMA_cfg[s].dma_ch;
+    c  = &ws2812b_tcd[s][b * WS2812B_TCD_CHAIN];
+    //           ,       .
+    //        ,    
+    if (DMA->TCD[ch].DLAST_SGA != (uint32_t)&c[WS2812B_TCD_LATCH]) WS2812B_load_TCD(ch, c);
+  }
+#endif
+  WS2812B_start_strips();
+  Start_PIT2((strips_bits + WS2812B_RESET_BITS + 1) * (FTM_WS2812B_MOD + 1)); // PIT  FTM    ,     
 }
 
+/*-----------------------------------------------------------------------------------------------------
+         FTM0
+               
 
-/*------------------------------------------------------------------------------
-     
-      
- ------------------------------------------------------------------------------*/
-static void  WS2812B_state_automat(void)
+     
+-----------------------------------------------------------------------------------------------------*/
+static uint32_t WS2812B_ftm_prepare(const uint32_t *frame)
 {
-  uint32_t       n;
-  int32_t        res = -1;
-
-  for (n = 0; n < LEDS_NUM; n++)
+#ifdef WS2812B_STREAM_MODE
+  return ws2812b_geom.leds_num; //       
+#else
+  uint32_t n;
+  uint32_t cnt = 0;
+  uint32_t sl  = ws2812b_geom.strip_leds;
+
+  for (n = 0; n < ws2812b_geom.leds_num; n++)
   {
-    if (lcbl[n].chain_ptr != 0) //    
+    if (back_bits->dirty[n >> 5] & (1u << (n & 31)))
     {
-      if (lcbl[n].cnt == 0)  //      
-      {
-        lcbl[n].code = *lcbl[n].curr_ptr;   //   
-        lcbl[n].curr_ptr++;
-        lcbl[n].data = *lcbl[n].curr_ptr;   //  
-        lcbl[n].curr_ptr++;                 //      
+      WS2812B_encode_rgb(back_bits->buf + (n / sl) * strip_words + (n % sl) * ws2812b_geom.bits_per_led, frame[n]);
+      cnt++;
+    }
+  }
+  memset(back_bits->dirty, 0, WS2812B_DIRTY_WORDS(ws2812b_geom.leds_num) * sizeof(uint32_t));
+  return cnt;
+#endif
+}
 
+/*-----------------------------------------------------------------------------------------------------
+             FTM0
+-----------------------------------------------------------------------------------------------------*/
+static void WS2812B_ftm_swap(void)
+{
+#ifndef WS2812B_STREAM_MODE
+  T_WS2812B_bits  *b;
 
-        if (lcbl[n].code & B_STOP)
-        {
-          //    
-          lcbl[n].cnt = 0;
-          lcbl[n].chain_ptr = 0;
-        }
-        else if (lcbl[n].code & B_JMP)
-        {
-          //     
-          lcbl[n].curr_ptr = (uint32_t *)lcbl[n].data;
-          lcbl[n].jmp_done = 1;
-        }
-        else
-        {
-          lcbl[n].duration = Conv_ms_to_ticks(lcbl[n].data);
-          lcbl[n].cnt = lcbl[n].duration;
-          lcbl[n].prev_hsv = lcbl[n].hsv;
-          lcbl[n].hsv = lcbl[n].code;
-
-          if ((lcbl[n].code & B_RAMP) == 0)
-          {
-            uint32_t   hue;
-            uint32_t   sat;
-            uint32_t   val;
-
-            hue = (lcbl[n].hsv >> 16) & 0x1FF;
-            sat = (lcbl[n].hsv >> 8) & 0xFF;
-            val = (lcbl[n].hsv >> 0) & 0xFF;
-
-            //   ,     
-            WS2812B_set_led_state(n, hue, sat, val, g_atten);
-          }
-        }
-      }
-      else
+  b          = front_bits;
+  front_bits = back_bits;
+  back_bits  = b;
+#endif
+}
+
+/*-----------------------------------------------------------------------------------------------------
+          FTM0    RGB.
+       , .. ,     .
+   PWM   FTM_WS2812B_1    0   ,    FTM_WS2812B_0.
+               
+
+     ,    0
+-----------------------------------------------------------------------------------------------------*/
+static uint32_t WS2812B_ftm_decode(uint32_t *frame, uint32_t *errs)
+{
+#ifdef WS2812B_STREAM_MODE
+  return 0; //      
+#else
+  const uint16_t *src;
+  uint32_t        n, i, s;
+  uint32_t        b;
+  uint32_t        rgb;
+  uint32_t        err = 0;
+  uint32_t        sl  = ws2812b_geom.strip_leds;
+
+  for (n = 0; n < ws2812b_geom.leds_num; n++)
+  {
+    src = back_bits->buf + (n / sl) * strip_words + (n % sl) * ws2812b_geom.bits_per_led;
+    b   = 0;
+    rgb = 0;
+    for (i = 0; i < ws2812b_geom.bits_per_led; i++)
+    {
+      b = (b << 1) | (src[i] == FTM_WS2812B_1);
+      if ((src[i] != FTM_WS2812B_1) && (src[i] != FTM_WS2812B_0)) err++;
+      if ((i & 7) == 7)
       {
-        lcbl[n].cnt--;
-        if (lcbl[n].code & B_RAMP)
-        {
-          //       
-          uint32_t   prev_hue;
-          uint32_t   prev_sat;
-          uint32_t   prev_val;
-
-          uint32_t   hue;
-          uint32_t   sat;
-          uint32_t   val;
-
-          uint32_t   delta;
-
-          hue = (lcbl[n].hsv >> 16) & 0x1FF;
-          sat = (lcbl[n].hsv >> 8) & 0xFF;
-          val = (lcbl[n].hsv >> 0) & 0xFF;
-
-          prev_hue = (lcbl[n].prev_hsv >> 16) & 0x1FF;
-          prev_sat = (lcbl[n].prev_hsv >> 8) & 0xFF;
-          prev_val = (lcbl[n].prev_hsv >> 0) & 0xFF;
-
-          if (hue > prev_hue)
-          {
-            delta = ((hue - prev_hue) * lcbl[n].cnt) / lcbl[n].duration;
-            hue = hue - delta;
-          }
-          else
-          {
-            delta = ((prev_hue - hue) * lcbl[n].cnt) / lcbl[n].duration;
-            hue = hue + delta;
-          }
-          if (sat > prev_sat)
-          {
-            delta = ((sat - prev_sat) * lcbl[n].cnt) / lcbl[n].duration;
-            sat = sat - delta;
-          }
-          else
-          {
-            delta = ((prev_sat - sat) * lcbl[n].cnt) / lcbl[n].duration;
-            sat = sat + delta;
-          }
-          if (val > prev_val)
-          {
-            delta = ((val - prev_val) * lcbl[n].cnt) / lcbl[n].duration;
-            val = val - delta;
-          }
-          else
-          {
-            delta = ((prev_val - val) * lcbl[n].cnt) / lcbl[n].duration;
-            val = val + delta;
-          }
-          WS2812B_set_led_state(n, hue, sat, val, g_atten);
-        }
+        rgb |= (b & 0xFF) << ws2812b_geom.shift[i >> 3];
+        b    = 0;
       }
     }
-    else
+    frame[n] = rgb;
+  }
+
+  for (s = 0; s < ws2812b_geom.strips_num; s++)
+  {
+    n = ws2812b_geom.leds_num - s * sl;
+    if (n > sl) n = sl;
+    src = back_bits->buf + s * strip_words;
+    for (i = n * ws2812b_geom.bits_per_led; i < strip_words; i++)
     {
-      //   ,   
-      WS2812B_set_led_state(n, 0, 0, 0, g_atten);
+      if (src[i] != 0) err++;
     }
   }
+  if (errs != 0) *errs += err;
+  return ws2812b_geom.leds_num;
+#endif
 }
 
-
+/*-----------------------------------------------------------------------------------------------------
+       
+          
+-----------------------------------------------------------------------------------------------------*/
+static void WS2812B_output_start(void)
+{
+  out_busy = 1;
+  ws2812b_out->start(front_frame);
+}
 
 /*-----------------------------------------------------------------------------------------------------
- 
- \param void 
+      .
+    ,        ,
+               
 -----------------------------------------------------------------------------------------------------*/
-void WS2812B_Demo_DMA(void)
+static void WS2812B_frame_commit(void)
 {
-  uint32_t i;
+  ws2812b_stat.encoded_leds = ws2812b_out->prepare(back_frame);
+  render_capture = LEDSC_capture_frame(ws2812b_out, back_frame);
 
-  //     .   
-  //refr_tmr_id = _timer_start_periodic_every(WS2812B_refresh, 0, TIMER_KERNEL_TIME_MODE, 10);
+  _int_disable();
+  if (out_busy == 0)
+  {
+    WS2812B_swap_frames();
+    WS2812B_output_start();
+  }
+  else
+  {
+    back_ready = 1;
+  }
+  _int_enable();
+}
 
-  WS2812B_init_bits();
+/*-----------------------------------------------------------------------------------------------------
+       DMA  WS2812B    
 
-  ws2812B_DMA_cfg.FTM      = FTM0_BASE_PTR;
-  ws2812B_DMA_cfg.ftm_ch   = FTM_CH_2;
-  ws2812B_DMA_cfg.dma_ch   = DMA_WS2812B_CH;
-  ws2812B_DMA_cfg.saddr    = (uint32_t)&WS2812B_bits.buf;
-  ws2812B_DMA_cfg.arrsz    = WS2812B_BITS_NUM + 1;
-  ws2812B_DMA_cfg.daddr    = (uint32_t)&ws2812B_DMA_cfg.FTM->CONTROLS[FTM_CH_2].CnV;
-  ws2812B_DMA_cfg.DMAMUX   = DMA_WS2812B_DMUX_PTR;
-  ws2812B_DMA_cfg.dmux_src = DMA_WS2812B_DMUX_SRC;
+  cfgs -   .      .
+          saddr, arrsz  daddr     
+  num  -  ,   WS2812B_STRIPS_MAX
 
-  WS2812B_init_DMA_stream(&ws2812B_DMA_cfg);
+     
+----------------------------------------------------------------------------------------------------*/
+static uint32_t WS2812B_init_DMA_streams(const T_DMA_WS2812B_config *cfgs, uint32_t num)
+{
+  T_DMA_WS2812B_config  *cfg;
+  uint32_t               s;
 
-  //     
-  for (i = 0; i < LEDS_NUM; i++)
+  if (num > WS2812B_STRIPS_MAX) num = WS2812B_STRIPS_MAX;
+  for (s = 0; s < num; s++)
   {
-    ptrns_arr[i][0] = HSV_NONE + B_RAMP;
-    ptrns_arr[i][1] = 40 * i;
+    if (cfgs[s].ftm_ch > 7) return 0;
+  }
 
-    ptrns_arr[i][2] = HSV_GREEN + B_RAMP;
-    ptrns_arr[i][3] = 400;
-    ptrns_arr[i][4] = HSV_NONE + B_RAMP;
-    ptrns_arr[i][5] = 400;
-    ptrns_arr[i][6] = HSV_BLUE + B_RAMP;
-    ptrns_arr[i][7] = 400;
-    ptrns_arr[i][8] = HSV_NONE + B_RAMP;
-    ptrns_arr[i][9] = 400;
-    ptrns_arr[i][10] = HSV_RED + B_RAMP;
-    ptrns_arr[i][11] = 400;
-    ptrns_arr[i][12] = HSV_NONE + B_RAMP;
-    ptrns_arr[i][13] = 400;
-    ptrns_arr[i][14] = B_JMP;
-    ptrns_arr[i][15] = (uint32_t)&ptrns_arr[i][2];
+  for (s = 0; s < num; s++)
+  {
+    cfg  = &ws2812B_DMA_cfg[s];
+    *cfg = cfgs[s];
+#ifdef WS2812B_STREAM_MODE
+    cfg->saddr = (uint32_t)scbl[s].buf;
+    cfg->arrsz = stream_words;
+#else
+    cfg->saddr = (uint32_t)(front_bits->buf + s * strip_words);
+    cfg->arrsz = strip_words;
+#endif
+    cfg->daddr = (uint32_t)&cfg->FTM->CONTROLS[cfg->ftm_ch].CnV;
+    WS2812B_build_TCD(cfg, s);
+
+    cfg->DMAMUX->CHCFG[cfg->dma_ch] = cfg->dmux_src + BIT(7); //        (   )     DMA
+#ifdef WS2812B_STREAM_MODE
+    Install_and_enable_isr(WS2812B_STRIP_INT_NUM(cfg->dma_ch), WS2812B_DMA_ISR_PRIO, WS2812B_DMA_isr);
+#endif
   }
-  for (i = 0; i < LEDS_NUM; i++)
+  ws2812b_strips = num;
+  Init_PIT2(WS2812B_reset_end);
+
+  for (s = 0; s < num; s++)
   {
-    WS2812B_Set_pattern(&ptrns_arr[i][0], i);
+    cfg = &ws2812B_DMA_cfg[s];
+    cfg->FTM->OUTMASK &= ~LSHIFT(1, cfg->ftm_ch);             //   
+    cfg->FTM->CONTROLS[cfg->ftm_ch].CnSC |= 0
+      + LSHIFT(1, 6) // CHIE.
+      + LSHIFT(1, 0) // DMA.  1 Enable DMA transfers.
+    ;
   }
+  return num;
 }
 
+/*-----------------------------------------------------------------------------------------------------
+         FTM0   
+
+   0             DMA
+-----------------------------------------------------------------------------------------------------*/
+static uint32_t WS2812B_ftm_alloc_bits(const T_WS2812B_geometry *geom)
+{
+  uint32_t s;
+  uint32_t n;
+
+#ifdef WS2812B_STREAM_MODE
+  stream_words = 2 * WS2812B_STREAM_LEDS * geom->bits_per_led;
+  memset(scbl, 0, sizeof(scbl));
+  for (s = 0; s < geom->strips_num; s++)
+  {
+    scbl[s].buf = (uint16_t *)_mem_alloc_system_zero(stream_words * sizeof(uint16_t));
+    if (scbl[s].buf == 0) return 0;
+    n = geom->leds_num - s * geom->strip_leds;
+    if (n > geom->strip_leds) n = geom->strip_leds;
+    scbl[s].led_num = n;
+  }
+  strips_bits = scbl[0].led_num * geom->bits_per_led; //    
+#else
+  uint32_t b;
+  uint32_t i;
+
+  strip_words = geom->strip_leds * geom->bits_per_led;
+  if (strip_words > 0x7FFF) return 0;
+  strips_bits = strip_words; //     
+  for (b = 0; b < 2; b++)
+  {
+    WS2812B_bits[b].buf   = (uint16_t *)_mem_alloc_system_zero(geom->strips_num * strip_words * sizeof(uint16_t));
+    WS2812B_bits[b].dirty = (uint32_t *)_mem_alloc_system_zero(WS2812B_DIRTY_WORDS(geom->leds_num) * sizeof(uint32_t));
+    if ((WS2812B_bits[b].buf == 0) || (WS2812B_bits[b].dirty == 0)) return 0;
+
+    //          .
+    //             
+    for (n = 0; n < geom->leds_num; n++)
+    {
+      s = n / geom->strip_leds;
+      for (i = 0; i < geom->bits_per_led; i++)
+      {
+        WS2812B_bits[b].buf[s * strip_words + (n % geom->strip_leds) * geom->bits_per_led + i] = FTM_WS2812B_0;
+      }
+    }
+  }
+  front_bits = &WS2812B_bits[0];
+  back_bits  = &WS2812B_bits[1];
+#endif
+  return 1;
+}
+
+/*-----------------------------------------------------------------------------------------------------
+       FTM0.
+         geom->strip_leds
+
+  geom       -  
+  frame_done -              
+
+       0  
+-----------------------------------------------------------------------------------------------------*/
+static uint32_t WS2812B_ftm_init(const T_WS2812B_geometry *geom, void (*frame_done)(void))
+{
+  uint32_t i;
+  T_DMA_WS2812B_config  cfgs[WS2812B_STRIPS_MAX];
+
+  if ((geom->strips_num == 0) || (geom->strips_num > WS2812B_STRIPS_MAX)) return 0;
+  if (WS2812B_ftm_alloc_bits(geom) == 0)
+  {
+    LOGs(__FUNCTION__, __LINE__, SEVERITY_RED, "Unable to allocate bit stream for %d strips of %d LEDs.", geom->strips_num, geom->strip_leds);
+    return 0;
+  }
+
+  memset(cfgs, 0, sizeof(cfgs));
+  for (i = 0; i < geom->strips_num; i++)
+  {
+    cfgs[i].FTM      = FTM0_BASE_PTR;
+    cfgs[i].ftm_ch   = ws2812b_strip_map[i].ftm_ch;
+    cfgs[i].dma_ch   = ws2812b_strip_map[i].dma_ch;
+    cfgs[i].DMAMUX   = DMA_WS2812B_DMUX_PTR;
+    cfgs[i].dmux_src = DMUX_SRC_FTM0_CH0 + ws2812b_strip_map[i].ftm_ch;
+  }
+  strips_done = frame_done;
+  return WS2812B_init_DMA_streams(cfgs, geom->strips_num);
+}
+
+//     FTM0:  PWM    ,  PWM -  
+static const T_WS2812B_wave ftm_wave =
+{
+  WS2812B_FTM_NS(FTM_WS2812B_0),
+  WS2812B_FTM_NS(FTM_WS2812B_1),
+  WS2812B_FTM_NS(FTM_WS2812B_MOD + 1),
+  WS2812B_FTM_NS((FTM_WS2812B_MOD + 1) * WS2812B_RESET_BITS),
+  0,
+};
+
+//     FTM0  DMA
+const T_WS2812B_backend ws2812b_ftm_backend =
+{
+  "FTM",
+  &ftm_wave,
+  WS2812B_ftm_init,
+  WS2812B_ftm_prepare,
+  WS2812B_ftm_swap,
+  WS2812B_ftm_start,
+  WS2812B_ftm_decode,
+};
+
+
+/*-----------------------------------------------------------------------------------------------------
+    .      .
+
+              ,
+  ..        .
+      .             ,
+       ,        
+    .       .
+    WS2812B_CATCHUP_TICKS  ,      .
+            ,    -    ,
+        .
+        ,    ,       WS2812B_KEEPALIVE_TICKS
+
+ \param us -       
+
+ \return uint32_t - 1   
+-----------------------------------------------------------------------------------------------------*/
+uint32_t WS2812B_periodic_refresh(uint32_t us)
+{
+  uint32_t          i;
+  static uint32_t   pending_us;
+  static uint32_t   sm_us;      //        
+  static uint32_t   idle_ticks;
+  uint32_t          pending_ticks;
+  uint32_t          t;
+  uint32_t          frame_us;
+  uint32_t          frame_ticks;
+
+  if ((enable_led_strip==1) && (ws2812b_ready != 0))
+  {
+    pending_us += us;
+    if (pending_us > WS2812B_CATCHUP_TICKS * ws2812b_tick_us)
+    {
+      ws2812b_stat.lost_ticks += (pending_us - WS2812B_CATCHUP_TICKS * ws2812b_tick_us) / ws2812b_tick_us;
+      pending_us = WS2812B_CATCHUP_TICKS * ws2812b_tick_us;
+    }
+    if (back_ready != 0)
+    {
+      ws2812b_stat.dropped_frames++; //     ,     
+      return 0;
+    }
+
+    t = Get_cycles_counter();
+    render_changed   = 0;
+    render_converted = 0;
+    render_capture   = 0;
+    frame_us         = pending_us;
+    pending_us       = 0;
+    sm_us           += frame_us;
+    pending_ticks    = sm_us / ws2812b_tick_us;
+    sm_us           %= ws2812b_tick_us;
+    ws2812b_stat.sm_frac = sm_us * 256 / ws2812b_tick_us;
+    frame_ticks      = pending_ticks; //    ,      
+
+    //        ,       
+    memcpy(back_frame, front_frame, ws2812b_geom.leds_num * sizeof(uint32_t));
+
+    if (src_mode != src_mode_req) WS2812B_src_switch();
+    if (sm_batch_pub != sm_batch_done) WS2812B_batch_apply();
+    if (src_mode == WS2812B_SRC_PALETTE)
+    {
+      pending_ticks = 0; //       
+      WS2812B_pal_render();
+    }
+    else if (src_mode == WS2812B_SRC_EFFECT)
+    {
+      WS2812B_fx_frame(frame_us);
+      pending_ticks = 0;
+    }
+
+    while (pending_ticks > 0)
+    {
+      pending_ticks--;
+      WS2812B_state_automat();
+
+      //      
+      //  ,           0.
+      //          
+      for (i = 0; i < sm_jmps_cnt; i++)
+      {
+        if (sm_jmps[i] == 0)
+        {
+          //          
+          demo_chain[DEMO_HUE1_OFFS] = WS2812B_fx_rand(&demo_rnd) & 0xFF;
+          demo_chain[DEMO_HUE2_OFFS] = WS2812B_fx_rand(&demo_rnd) & 0xFF;
+          demo_chain[DEMO_HUE3_OFFS] = WS2812B_fx_rand(&demo_rnd) & 0xFF;
+        }
+      }
+      sm_jmps_cnt = 0;
+    }
+    if (src_mode == WS2812B_SRC_PATTERNS) WS2812B_ramps_render();
+
+    WS2812B_pt_frame(frame_us);
+    WS2812B_comp_render();
+
+    ws2812b_stat.changed_leds   = render_changed;
+    ws2812b_stat.converted_leds = render_converted;
+    if (out_lut_changed != 0)
+    {
+      //   .     ,      
+      out_lut_changed = 0;
+#ifndef WS2812B_STREAM_MODE
+      if (WS2812B_bits[0].dirty != 0)
+      {
+        memset(WS2812B_bits[0].dirty, 0xFF, WS2812B_DIRTY_WORDS(ws2812b_geom.leds_num) * sizeof(uint32_t));
+        memset(WS2812B_bits[1].dirty, 0xFF, WS2812B_DIRTY_WORDS(ws2812b_geom.leds_num) * sizeof(uint32_t));
+      }
+#endif
+      idle_ticks = WS2812B_KEEPALIVE_TICKS;
+    }
+    idle_ticks += frame_ticks;
+    if ((render_changed != 0) || (idle_ticks >= WS2812B_KEEPALIVE_TICKS))
+    {
+      idle_ticks = 0;
+      WS2812B_frame_commit();
+    }
+    else
+    {
+      ws2812b_stat.encoded_leds = 0;
+      ws2812b_stat.skipped_frames++;
+    }
+
+    t = Get_cycles_counter() - t - render_capture;
+    ws2812b_stat.render_cycles = t;
+    if (t > ws2812b_stat.render_max_cycles) ws2812b_stat.render_max_cycles = t;
+    LEDSC_capture_done(&ws2812b_stat);
+    return 1;
+  }
+  return 0;
+}
+
+/*-----------------------------------------------------------------------------------------------------
+     
+-----------------------------------------------------------------------------------------------------*/
+static void WS2812B_render_tick(void)
+{
+  render_req++;
+  _lwevent_set(&ws2812b_lwev, WS2812B_EVT_RENDER);
+}
+
+/*-----------------------------------------------------------------------------------------------------
+     ws2812b_fps.
+            ,       
+   PIT      ,        PIT1
+
+ \param fps -  , 0 -     
+
+ \return uint32_t -     
+-----------------------------------------------------------------------------------------------------*/
+static uint32_t WS2812B_render_rate(uint32_t fps)
+{
+  render_fps = fps;
+  if (fps == 0)
+  {
+    Stop_PIT1();
+    return BSP_CORE_CLOCK / ws2812b_tps;
+  }
+  if (render_pit == 0)
+  {
+    Init_PIT1(1000000ul / fps, WS2812B_render_tick);
+    render_pit = 1;
+  }
+  else
+  {
+    Set_PIT1_period(1000000ul / fps); //   ,   
+  }
+  return BSP_CORE_CLOCK / fps;
+}
+
+/*-----------------------------------------------------------------------------------------------------
+     :  MQX         .
+    2^32 ,     
+
+ \return uint32_t -   
+-----------------------------------------------------------------------------------------------------*/
+static uint32_t WS2812B_time_us(void)
+{
+  MQX_TICK_STRUCT  tk;
+
+  _time_get_elapsed_ticks(&tk);
+  return tk.TICKS[0] * ws2812b_tick_us + tk.HW_TICKS / ws2812b_hw_us;
+}
+
+/*-----------------------------------------------------------------------------------------------------
+     .       
+-----------------------------------------------------------------------------------------------------*/
+void WS2812B_update_fps(void)
+{
+  if (ws2812b_ready != 0) _lwevent_set(&ws2812b_lwev, WS2812B_EVT_RENDER);
+}
+
+/*-----------------------------------------------------------------------------------------------------
+     .    .
+
+       ,   ,   .
+          ,      ,
+         .
+             .
+       ,     ,
+          
+
+ \param initial_data
+-----------------------------------------------------------------------------------------------------*/
+void Task_WS2812B_render(uint32_t initial_data)
+{
+  uint32_t         fps    = 0xFFFFFFFF;
+  uint32_t         budget = 0;
+  uint32_t         req    = 0;
+  uint32_t         last;
+  uint32_t         now;
+  uint32_t         n;
+
+  last = WS2812B_time_us();
+  do
+  {
+    if (wvar.ws2812b_fps != fps)
+    {
+      fps    = wvar.ws2812b_fps;
+      budget = WS2812B_render_rate(fps);
+      ws2812b_stat.render_budget_cycles = budget;
+      req    = render_req;
+    }
+    //     ,       
+    _lwevent_wait_ticks(&ws2812b_lwev, WS2812B_EVT_RENDER, FALSE, (render_fps == 0) ? 1 : 0);
+
+    n   = render_req - req;
+    req += n;
+    if (n > 1) ws2812b_stat.dropped_frames += n - 1;
+
+    now  = WS2812B_time_us();
+    n    = WS2812B_periodic_refresh(now - last);
+    last = now;
+
+    if ((n != 0) && (ws2812b_stat.render_cycles > budget))
+    {
+      ws2812b_stat.render_overruns++;
+      if (render_fps != 0) _lwevent_clear(&ws2812b_lwev, WS2812B_EVT_RENDER);
+    }
+  } while (1);
+}
+
+/*------------------------------------------------------------------------------
+    HSV  RGB   
+ 
+   - HSV,       [hue] - 0..360 (9 bit), [saturation] - 0..255 (8 bit),  [value] - 0..255 (8-bit)
+   , -        
+           LEDSC_WS2812B_hsv
+ ------------------------------------------------------------------------------*/
+uint32_t Convert_H_S_V_to_RGB(uint32_t hue, uint32_t sat, uint32_t val)
+{
+  return WS2812B_hsv_to_rgb(hue, sat, val);
+}
+
+
+/*------------------------------------------------------------------------------
+    HSV  RGB   
+ 
+   - HSV,       [hue] - 0..360 (9 bit), [saturation] - 0..255 (8 bit),  [value] - 0..255 (8-bit)
+ ------------------------------------------------------------------------------*/
+uint32_t Convert_HSV_to_RGB(uint32_t hsv)
+{
+  uint32_t   hue;
+  uint32_t   sat;
+  uint32_t   val;
+
+  hue = (hsv >> 16) & 0x1FF;
+  sat = (hsv >> 8) & 0xFF;
+  val = (hsv >> 0) & 0xFF;
+  return Convert_H_S_V_to_RGB(hue, sat, val);
+}
+
+/*------------------------------------------------------------------------------
+       0..359.  360  0
+ ------------------------------------------------------------------------------*/
+static uint32_t WS2812B_norm_hue(uint32_t hue)
+{
+  if (hue >= 360) hue -= 360;
+  return hue;
+}
+
+/*------------------------------------------------------------------------------
+        duration 
+
+           Q16,        .
+          , ..  350 -> 10   0,    180.
+        ,       ,
+           .    256    ,
+           .
+
+   from_hsv, to_hsv -      [hue] - 0..360 (9 bit), [saturation] - 0..255 (8 bit),  [value] - 0..255 (8-bit)
+   duration         -   ,   0
+ ------------------------------------------------------------------------------*/
+void WS2812B_ramp_init(T_WS2812B_ramp *r, uint32_t from_hsv, uint32_t to_hsv, uint32_t duration)
+{
+  int32_t   d;
+
+  d = (int32_t)WS2812B_norm_hue((to_hsv >> 16) & 0x1FF) - (int32_t)WS2812B_norm_hue((from_hsv >> 16) & 0x1FF);
+  if (d > 180) d -= 360;
+  else if (d < -180) d += 360;
+  r->hue   = (WS2812B_norm_hue((from_hsv >> 16) & 0x1FF) << 16) + WS2812B_RAMP_ROUND(d);
+  r->d_hue = (d * 65536) / (int32_t)duration;
+
+  d = (int32_t)((to_hsv >> 8) & 0xFF) - (int32_t)((from_hsv >> 8) & 0xFF);
+  r->sat   = (((from_hsv >> 8) & 0xFF) << 16) + WS2812B_RAMP_ROUND(d);
+  r->d_sat = (d * 65536) / (int32_t)duration;
+
+  d = (int32_t)(to_hsv & 0xFF) - (int32_t)(from_hsv & 0xFF);
+  r->val   = ((from_hsv & 0xFF) << 16) + WS2812B_RAMP_ROUND(d);
+  r->d_val = (d * 65536) / (int32_t)duration;
+}
+
+/*------------------------------------------------------------------------------
+      k  ,     
+       HSV     0..359
+
+   k -    0  duration
+ ------------------------------------------------------------------------------*/
+uint32_t WS2812B_ramp_value(const T_WS2812B_ramp *r, uint32_t k)
+{
+  int32_t   hue;
+  int32_t   sat;
+  int32_t   val;
+
+  hue = r->hue + r->d_hue * (int32_t)k;
+  if (hue < 0) hue += (360 << 16);
+  else if (hue >= (360 << 16)) hue -= (360 << 16);
+  sat = r->sat + r->d_sat * (int32_t)k;
+  val = r->val + r->d_val * (int32_t)k;
+
+  return ((uint32_t)(hue >> 16) << 16) | ((uint32_t)(sat >> 16) << 8) | (uint32_t)(val >> 16);
+}
+
+/*------------------------------------------------------------------------------
+        k  k + 1.      0..255,
+             
+       HSV     0..359
+
+   k    -    0  duration - 1
+   frac -    1/256
+ ------------------------------------------------------------------------------*/
+uint32_t WS2812B_ramp_value_frac(const T_WS2812B_ramp *r, uint32_t k, uint32_t frac)
+{
+  int32_t   hue;
+  int32_t   sat;
+  int32_t   val;
+
+  hue = r->hue + r->d_hue * (int32_t)k + (r->d_hue >> 8) * (int32_t)frac;
+  if (hue < 0) hue += (360 << 16);
+  else if (hue >= (360 << 16)) hue -= (360 << 16);
+  sat = r->sat + r->d_sat * (int32_t)k + (r->d_sat >> 8) * (int32_t)frac;
+  val = r->val + r->d_val * (int32_t)k + (r->d_val >> 8) * (int32_t)frac;
+  if (sat < 0) sat = 0;
+  else if (sat > (255 << 16)) sat = 255 << 16;
+  if (val < 0) val = 0;
+  else if (val > (255 << 16)) val = 255 << 16;
+
+  return ((uint32_t)(hue >> 16) << 16) | ((uint32_t)(sat >> 16) << 8) | (uint32_t)(val >> 16);
+}
+
+/*------------------------------------------------------------------------------
+        RGBW.
+             
+ ------------------------------------------------------------------------------*/
+static uint32_t WS2812B_rgb_to_rgbw(uint32_t rgb)
+{
+  uint32_t   w;
+
+  w = (rgb >> 16) & 0xFF;
+  if (((rgb >> 8) & 0xFF) < w) w = (rgb >> 8) & 0xFF;
+  if ((rgb & 0xFF) < w) w = rgb & 0xFF;
+  return (w << 24) | (rgb - w * 0x010101);
+}
+
+/*------------------------------------------------------------------------------
+        .
+           
+ ------------------------------------------------------------------------------*/
+static void WS2812B_frame_put(uint32_t ledn, uint32_t color)
+{
+  if (back_frame[ledn] == color) return;
+
+  back_frame[ledn] = color;
+  render_changed++;
+#ifndef WS2812B_STREAM_MODE
+  //        .        FTM0
+  if (WS2812B_bits[0].dirty == 0) return;
+  WS2812B_bits[0].dirty[ledn >> 5] |= (1u << (ledn & 31));
+  WS2812B_bits[1].dirty[ledn >> 5] |= (1u << (ledn & 31));
+#endif
+}
+
+/*------------------------------------------------------------------------------
+     RGB   
+ ------------------------------------------------------------------------------*/
+static uint32_t WS2812B_frame_colr(uint32_t rgb)
+{
+  if (ws2812b_geom.colrs > 3) return WS2812B_rgb_to_rgbw(rgb);
+  return rgb;
+}
+
+/*------------------------------------------------------------------------------
+     RGB     .
+           
+ ------------------------------------------------------------------------------*/
+static void WS2812B_src_put(uint32_t ledn, uint32_t rgb)
+{
+  src_frame[ledn] = rgb;
+  if (comp_on == 0) WS2812B_frame_put(ledn, WS2812B_frame_colr(rgb));
+}
+
+/*------------------------------------------------------------------------------
+     
+   color -    HSV
+
+       HSV    ,
+            RGB.
+               
+ ------------------------------------------------------------------------------*/
+void WS2812B_set_led_state(uint32_t ledn, uint32_t hue, uint32_t sat, uint32_t val)
+{
+  uint32_t color;
+  uint32_t key;
+
+  if (val == 0) key = 0; //      
+  else key = (hue << 16) | (sat << 8) | val;
+  if (lcbl[ledn].out_key == key) return;
+  lcbl[ledn].out_key = key;
+
+  if (val == 0)
+  {
+    color = 0; //      
+  }
+  else
+  {
+    color = WS2812B_hsv_to_rgb(hue, sat, val);
+    render_converted++;
+  }
+  WS2812B_src_put(ledn, color);
+}
+
+/*------------------------------------------------------------------------------
+      
+
+   src - WS2812B_SRC_PATTERNS -  , WS2812B_SRC_PALETTE - ,
+         WS2812B_SRC_EFFECT -  ,  WS2812B_Set_effect
+ ------------------------------------------------------------------------------*/
+void WS2812B_set_source(uint32_t src)
+{
+  if (src >= WS2812B_SRC_NUM) return;
+  src_mode_req = src;
+}
+
+/*------------------------------------------------------------------------------
+     .  WS2812B_FX_NONE    
+
+   p -  , 
+ ------------------------------------------------------------------------------*/
+void WS2812B_Set_effect(const T_WS2812B_fx_params *p)
+{
+  if ((p->id == WS2812B_FX_NONE) || (p->id >= WS2812B_FX_NUM))
+  {
+    WS2812B_set_source(WS2812B_SRC_PATTERNS);
+    return;
+  }
+  _int_disable();
+  fx_req_params = *p;
+  fx_req = 1;
+  _int_enable();
+  WS2812B_set_source(WS2812B_SRC_EFFECT);
+}
+
+/*------------------------------------------------------------------------------
+      WS2812B_FX_SCRIPT.    ,     .
+      ,   .     ,
+             
+
+   prog - ,  WS2812B_vm_load
+ ------------------------------------------------------------------------------*/
+void WS2812B_Set_script(const T_WS2812B_vm_prog *prog)
+{
+  T_WS2812B_vm_prog *dst;
+
+  _int_disable();
+  dst = (fx.prog == &fx_progs[0]) ? &fx_progs[1] : &fx_progs[0];
+  *dst = *prog;
+  fx_prog_req = dst;
+  _int_enable();
+}
+
+/*------------------------------------------------------------------------------
+     .
+           ,     .
+              ,
+      ,         
+ ------------------------------------------------------------------------------*/
+static void WS2812B_src_switch(void)
+{
+  uint32_t   n;
+
+  src_mode = src_mode_req;
+  if (src_mode == WS2812B_SRC_PALETTE) pal_changed = 1;
+  if (src_mode != WS2812B_SRC_PATTERNS) return;
+  for (n = 0; n < ws2812b_geom.leds_num; n++)
+  {
+    lcbl[n].out_key = 0xFFFFFFFF;
+    if (lcbl[n].chain_ptr != 0)
+    {
+      lcbl[n].curr_ptr = lcbl[n].chain_ptr;
+      lcbl[n].prev_hsv = HSV_NONE;
+      lcbl[n].hsv      = HSV_NONE;
+      lcbl[n].data     = 0;
+      lcbl[n].loop_cnt = 0;
+    }
+    WS2812B_ramp_remove(n);
+    WS2812B_schedule(n, sm_tick + 1 + lcbl[n].phase); //     
+  }
+}
+
+/*------------------------------------------------------------------------------
+          .
+      ,       
+ ------------------------------------------------------------------------------*/
+static void WS2812B_pal_render(void)
+{
+  uint32_t   n;
+  uint32_t   offs;
+
+  if (pal_changed == 0) return;
+  pal_changed = 0;
+  offs = pal_offs;
+  for (n = 0; n < ws2812b_geom.leds_num; n++)
+  {
+    WS2812B_src_put(n, pal[(pal_idx[n] + offs) & 0xFF]);
+  }
+}
+
+/*------------------------------------------------------------------------------
+        .
+        ,         
+
+   us -      
+ ------------------------------------------------------------------------------*/
+static void WS2812B_fx_frame(uint32_t us)
+{
+  T_WS2812B_fx_params  p;
+  uint32_t             n;
+  uint32_t             req;
+
+  _int_disable();
+  req = fx_req;
+  fx_req = 0;
+  p = fx_req_params;
+  if (fx_prog_req != 0)
+  {
+    fx.prog     = fx_prog_req;
+    fx_prog_req = 0;
+  }
+  _int_enable();
+  if (req != 0)
+  {
+    fx_ms     = 0;
+    fx_ms_acc = 0;
+    WS2812B_fx_init(&fx, &p, fx_heat, ws2812b_geom.leds_num, 0);
+  }
+  else
+  {
+    fx_ms_acc += us;
+    fx_ms     += fx_ms_acc / 1000;
+    fx_ms_acc %= 1000;
+  }
+
+  WS2812B_fx_render(&fx, src_frame, ws2812b_geom.leds_num, fx_ms);
+  if (comp_on != 0) return;
+  for (n = 0; n < ws2812b_geom.leds_num; n++)
+  {
+    WS2812B_frame_put(n, WS2812B_frame_colr(src_frame[n]));
+  }
+}
+
+/*------------------------------------------------------------------------------
+     .          .
+       
+
+   s -  , 
+
+    0   
+ ------------------------------------------------------------------------------*/
+uint32_t WS2812B_Spawn_particles(const T_WS2812B_pt_spawn *s)
+{
+  uint32_t res = 0;
+
+  _int_disable();
+  if ((pt_req_wr - pt_req_rd) < WS2812B_PT_REQ_NUM)
+  {
+    pt_req[pt_req_wr % WS2812B_PT_REQ_NUM] = *s;
+    pt_req_wr++;
+    res = 1;
+  }
+  _int_enable();
+  return res;
+}
+
+/*------------------------------------------------------------------------------
+       
+
+   s     -  ,  count  
+   width -        s->pos
+   rate  -        255, 0 -  
+ ------------------------------------------------------------------------------*/
+void WS2812B_Set_emitter(const T_WS2812B_pt_spawn *s, uint32_t width, uint32_t rate)
+{
+  _int_disable();
+  pt_em.s     = *s;
+  pt_em.width = (uint16_t)width;
+  pt_em.rate  = (uint16_t)rate;
+  pt_em.acc   = 0;
+  pt_em_seq++;
+  _int_enable();
+}
+
+/*------------------------------------------------------------------------------
+      ,     
+
+   level - 0..255,     
+ ------------------------------------------------------------------------------*/
+void WS2812B_pt_level(uint32_t level)
+{
+  pt_level = (level > 255) ? 255 : level;
+}
+
+/*------------------------------------------------------------------------------
+        .
+                  
+
+   us -      
+ ------------------------------------------------------------------------------*/
+static void WS2812B_pt_frame(uint32_t us)
+{
+  T_WS2812B_pt_spawn   s;
+  T_WS2812B_pt_emitter em;
+  uint32_t             seq;
+  uint32_t             n = ws2812b_geom.leds_num;
+  uint32_t             ms;
+  uint32_t             t;
+
+  t = Get_cycles_counter();
+  pt_ms_acc += us;
+  ms         = pt_ms_acc / 1000;
+  pt_ms_acc %= 1000;
+
+  WS2812B_pt_update(&pt_pool, ms, n);
+  while (pt_req_rd != pt_req_wr)
+  {
+    _int_disable();
+    s = pt_req[pt_req_rd % WS2812B_PT_REQ_NUM];
+    pt_req_rd++;
+    _int_enable();
+    WS2812B_pt_spawn(&pt_pool, &s);
+  }
+  //    ,         
+  _int_disable();
+  em  = pt_em;
+  seq = pt_em_seq;
+  _int_enable();
+  if (em.rate != 0)
+  {
+    WS2812B_pt_emit(&pt_pool, &em, pt_level, ms);
+    _int_disable();
+    if (seq == pt_em_seq) pt_em.acc = em.acc;
+    _int_enable();
+  }
+
+  ws2812b_stat.pt_live = pt_pool.num;
+  if ((pt_pool.num == 0) && (em.rate == 0))
+  {
+    if (pt_on != 0)
+    {
+      pt_on = 0;
+      WS2812B_layer_set(WS2812B_PT_LAYER, 0, WS2812B_BLEND_ADD, 0);
+    }
+    ws2812b_stat.pt_cycles = 0;
+    return;
+  }
+  memset(pt_frame, 0, n * sizeof(uint32_t));
+  WS2812B_pt_splat(&pt_pool, pt_frame, n);
+  if (pt_on == 0)
+  {
+    pt_on = 1;
+    WS2812B_layer_set(WS2812B_PT_LAYER, pt_frame, WS2812B_BLEND_ADD, WS2812B_ALPHA_MAX);
+  }
+  ws2812b_stat.pt_cycles = Get_cycles_counter() - t;
+}
+
+/*------------------------------------------------------------------------------
+     
+
+   first -    
+   rgb   -    RGB (00000000 RRRRRRRR GGGGGGGG BBBBBBBB)
+   num   -  .      
+ ------------------------------------------------------------------------------*/
+void WS2812B_pal_set(uint32_t first, const uint32_t *rgb, uint32_t num)
+{
+  uint32_t   i;
+
+  for (i = 0; (i < num) && (first + i < 256); i++)
+  {
+    pal[first + i] = rgb[i] & 0xFFFFFF;
+  }
+  pal_changed = 1;
+}
+
+/*------------------------------------------------------------------------------
+        HSV
+ ------------------------------------------------------------------------------*/
+void WS2812B_pal_set_hsv(uint32_t i, uint32_t hue, uint32_t sat, uint32_t val)
+{
+  if (i > 255) return;
+  pal[i] = WS2812B_hsv_to_rgb(hue, sat, val);
+  pal_changed = 1;
+}
+
+/*------------------------------------------------------------------------------
+           RGB .
+        , ,    ..
+ ------------------------------------------------------------------------------*/
+void WS2812B_pal_gradient(uint32_t first, uint32_t first_rgb, uint32_t last, uint32_t last_rgb)
+{
+  uint32_t   i;
+  uint32_t   k;
+  uint32_t   n;
+  uint32_t   rgb;
+  uint32_t   a, b;
+
+  if ((last > 255) || (first > last)) return;
+  n = last - first;
+  if (n == 0) n = 1;
+  for (i = 0; i <= last - first; i++)
+  {
+    rgb = 0;
+    for (k = 0; k < 24; k += 8)
+    {
+      a = (first_rgb >> k) & 0xFF;
+      b = (last_rgb >> k) & 0xFF;
+      rgb |= ((a * (n - i) + b * i + n / 2) / n) << k;
+    }
+    pal[first + i] = rgb;
+  }
+  pal_changed = 1;
+}
+
+/*------------------------------------------------------------------------------
+      
+
+   first -   
+   idx   -  
+   num   -  .      
+ ------------------------------------------------------------------------------*/
+void WS2812B_pal_set_index(uint32_t first, const uint8_t *idx, uint32_t num)
+{
+  uint32_t   i;
+
+  if ((ws2812b_ready == 0) || (first >= ws2812b_geom.leds_num)) return;
+  if (num > ws2812b_geom.leds_num - first) num = ws2812b_geom.leds_num - first;
+  for (i = 0; i < num; i++)
+  {
+    pal_idx[first + i] = idx[i];
+  }
+  pal_changed = 1;
+}
+
+/*------------------------------------------------------------------------------
+      step .    i    i + .
+      ,   
+ ------------------------------------------------------------------------------*/
+void WS2812B_pal_rotate(int32_t step)
+{
+  pal_offs = (pal_offs + (uint32_t)step) & 0xFF;
+  pal_changed = 1;
+}
+
+/*------------------------------------------------------------------------------
+        .
+           amount / 256 ,      1,
+        amount         
+
+   target -    256    RGB
+   amount -   1..256   Q8, 256 -    
+ ------------------------------------------------------------------------------*/
+void WS2812B_pal_blend(const uint32_t *target, uint32_t amount)
+{
+  uint32_t   i;
+  uint32_t   k;
+  uint32_t   c, t;
+  uint32_t   a, b;
+  uint32_t   res;
+
+  if (amount > 256) amount = 256;
+  for (i = 0; i < 256; i++)
+  {
+    c = pal[i];
+    t = target[i] & 0xFFFFFF;
+    if (c == t) continue;
+    res = 0;
+    for (k = 0; k < 24; k += 8)
+    {
+      a = (c >> k) & 0xFF;
+      b = (t >> k) & 0xFF;
+      if (a < b) a += ((b - a) * amount + 255) >> 8;
+      else a -= ((a - b) * amount + 255) >> 8;
+      res |= a << k;
+    }
+    pal[i] = res;
+  }
+  pal_changed = 1;
+}
+
+/*------------------------------------------------------------------------------
+   ,    
+
+   layer -   0..WS2812B_LAYERS_MAX - 1.     
+   pix   -     RGB    .        ,
+                 . 0 -  
+   mode  -   WS2812B_BLEND_...
+   alpha -   0..WS2812B_ALPHA_MAX
+
+    0   
+ ------------------------------------------------------------------------------*/
+uint32_t WS2812B_layer_set(uint32_t layer, const uint32_t *pix, uint32_t mode, uint32_t alpha)
+{
+  if ((layer >= WS2812B_LAYERS_MAX) || (mode >= WS2812B_BLEND_NUM)) return 0;
+  if (alpha > WS2812B_ALPHA_MAX) alpha = WS2812B_ALPHA_MAX;
+
+  _int_disable();
+  comp_layers[layer].pix   = pix;
+  comp_layers[layer].mode  = mode;
+  comp_layers[layer].alpha = alpha;
+  _int_enable();
+  return 1;
+}
+
+/*------------------------------------------------------------------------------
+     ,       
+ ------------------------------------------------------------------------------*/
+void WS2812B_layer_alpha(uint32_t layer, uint32_t alpha)
+{
+  if (layer >= WS2812B_LAYERS_MAX) return;
+  if (alpha > WS2812B_ALPHA_MAX) alpha = WS2812B_ALPHA_MAX;
+  comp_layers[layer].alpha = alpha;
+}
+
+/*------------------------------------------------------------------------------
+             .
+             
+ ------------------------------------------------------------------------------*/
+static void WS2812B_comp_render(void)
+{
+  T_WS2812B_layer   layers[WS2812B_LAYERS_MAX];
+  uint32_t          i;
+  uint32_t          on = 0;
+  uint32_t          n = ws2812b_geom.leds_num;
+  uint32_t          t;
+
+  _int_disable();
+  memcpy(layers, comp_layers, sizeof(layers));
+  _int_enable();
+  for (i = 0; i < WS2812B_LAYERS_MAX; i++)
+  {
+    if ((layers[i].pix != 0) && (layers[i].alpha != 0)) on = 1;
+  }
+  if ((on == 0) && (comp_on == 0))
+  {
+    ws2812b_stat.compose_cycles = 0;
+    return;
+  }
+
+  t = Get_cycles_counter();
+  memcpy(comp_frame, src_frame, n * sizeof(uint32_t));
+  WS2812B_compose(comp_frame, layers, WS2812B_LAYERS_MAX, n);
+  for (i = 0; i < n; i++)
+  {
+    WS2812B_frame_put(i, WS2812B_frame_colr(comp_frame[i]));
+  }
+  comp_on = on;
+  ws2812b_stat.compose_cycles = Get_cycles_counter() - t;
+}
+
+
+/*-------------------------------------------------------------------------------------------------------------
+       . 0 -  
+-------------------------------------------------------------------------------------------------------------*/
+static uint32_t WS2812B_item_size(uint32_t op)
+{
+  uint32_t dur = ((op & WS2812B_OPF_SAME_DUR) == 0) ? 2 : 0;
+
+  switch (op & WS2812B_OP_MASK)
+  {
+  case WS2812B_OP_STOP:
+    return (op == WS2812B_OP_STOP) ? 1 : 0;
+  case WS2812B_OP_JMP:
+    return (op == WS2812B_OP_JMP) ? 3 : 0;
+  case WS2812B_OP_LOOP:
+    return (op == WS2812B_OP_LOOP) ? 4 : 0;
+  case WS2812B_OP_HOLD:
+  case WS2812B_OP_RAMP:
+    return ((op & ~(WS2812B_OP_MASK | WS2812B_OPF_SAME_DUR)) == 0) ? 4 + dur : 0;
+  case WS2812B_OP_HOLDS:
+  case WS2812B_OP_RAMPS:
+    return ((op & ~(WS2812B_OP_MASK | WS2812B_OPF_SAME_DUR)) == 0) ? 3 + dur : 0;
+  }
+  return 0;
+}
+
+/*-------------------------------------------------------------------------------------------------------------
+  ,   pos     
+-------------------------------------------------------------------------------------------------------------*/
+static uint32_t WS2812B_item_start(const uint8_t *blob, uint32_t len, uint32_t pos)
+{
+  uint32_t i = 0;
+
+  if (pos >= len) return 0;
+  while (i < pos) i += WS2812B_item_size(blob[i]); //    len     
+  return (i == pos);
+}
+
+/*-------------------------------------------------------------------------------------------------------------
+         .
+
+       ,      (,  )
+      . ,            blob,
+          blob,    -   ,
+  ..      .
+    ,      .
+             
+
+  blob - 
+  len  -    
+
+   1   , 0        
+-------------------------------------------------------------------------------------------------------------*/
+uint32_t WS2812B_pattern_check(const uint8_t *blob, uint32_t len)
+{
+  uint32_t pos = 0;
+  uint32_t size;
+  uint32_t op  = WS2812B_OP_STOP;
+  int32_t  target;
+  uint32_t i;
+
+  if ((blob == 0) || (len == 0)) return 0;
+
+  //    
+  while (pos < len)
+  {
+    op   = blob[pos];
+    size = WS2812B_item_size(op);
+    if ((size == 0) || (size > len - pos)) return 0;
+    pos += size;
+  }
+  if ((op != WS2812B_OP_STOP) && (op != WS2812B_OP_JMP)) return 0;
+
+  //     
+  for (pos = 0; pos < len; pos += size)
+  {
+    op   = blob[pos];
+    size = WS2812B_item_size(op);
+    if (op == WS2812B_OP_JMP) target = (int32_t)(pos + size) + (int16_t)WS2812B_rd16(&blob[pos + 1]);
+    else if (op == WS2812B_OP_LOOP) target = (int32_t)(pos + size) + (int16_t)WS2812B_rd16(&blob[pos + 2]);
+    else continue;
+    if ((target < 0) || (WS2812B_item_start(blob, len, (uint32_t)target) == 0)) return 0;
+  }
+
+  // .      LDREX/STREX,     
+  if (WS2812B_pattern_ok(blob) != 0) return 1;
+  do
+  {
+    i = __LDREX((unsigned long *)&pat_checked_num);
+    if (i >= WS2812B_PATTERNS_MAX)
+    {
+      __CLREX();
+      return 0;
+    }
+  } while (__STREX(i + 1, (unsigned long *)&pat_checked_num) != 0);
+  pat_checked[i] = blob;
+  return 1;
+}
+
+/*-------------------------------------------------------------------------------------------------------------
+     WS2812B_pattern_check.  0      
+-------------------------------------------------------------------------------------------------------------*/
+static uint32_t WS2812B_pattern_ok(const uint8_t *pattern)
+{
+  uint32_t i;
+  uint32_t num = pat_checked_num;
+
+  if (pattern == 0) return 1;
+  for (i = 0; i < num; i++)
+  {
+    if (pat_checked[i] == pattern) return 1;
+  }
+  return 0;
+}
+
+/*-------------------------------------------------------------------------------------------------------------
+    
+
+      LEDSC_WS2812B.h.    ,
+        ,     Flash      .
+
+  n -   0..(ws2812b_leds_num - 1)
+-------------------------------------------------------------------------------------------------------------*/
+uint32_t WS2812B_Set_pattern(const uint8_t *pattern, uint32_t n)
+{
+  return WS2812B_Set_shared_pattern(pattern, n, 0, WS2812B_RATE_1X);
+}
+
+/*-------------------------------------------------------------------------------------------------------------
+            
+
+    ,        
+          .
+             .
+                .
+
+  pattern  -   
+  n        -   0..(ws2812b_leds_num - 1)
+  phase_ms -     .      
+  rate     -     Q8, WS2812B_RATE_1X -  .     rate
+
+   0    :   ,  ,    WS2812B_pattern_check
+          
+-------------------------------------------------------------------------------------------------------------*/
+uint32_t WS2812B_Set_shared_pattern(const uint8_t *pattern, uint32_t n, uint32_t phase_ms, uint32_t rate)
+{
+  T_WS2812B_sm_slot *s;
+
+  if ((ws2812b_ready == 0) || (n >= ws2812b_geom.leds_num) || (pattern == 0)) return 0;
+  if (WS2812B_pattern_ok(pattern) == 0) return 0;
+  if (rate == 0) rate = WS2812B_RATE_1X;
+
+  s = &sm_slot[n];
+  if (WS2812B_claim(&s->seq) == 0) return 0;
+  __DMB(); //      
+  s->a.pattern = pattern;
+  s->a.phase   = Conv_ms_to_ticks(phase_ms);
+  s->a.tscale  = (WS2812B_RATE_1X << 16) / rate;
+  __DMB();
+  s->seq++; //  ,    
+  WS2812B_bits_set(&sm_req[n >> 5], 1u << (n & 31)); //        
+  return 1;
+}
+
+/*-------------------------------------------------------------------------------------------------------------
+      .
+     WS2812B_Batch_range  WS2812B_Batch_set     WS2812B_Batch_publish
+          .
+
+   0       ,      ,
+       .           
+-------------------------------------------------------------------------------------------------------------*/
+uint32_t WS2812B_Batch_begin(void)
+{
+  if ((ws2812b_ready == 0) || (sm_batch_pub != sm_batch_done)) return 0;
+  if (WS2812B_claim(&sm_batch_open) == 0) return 0;
+  memset(sm_batch_map, 0, WS2812B_DIRTY_WORDS(ws2812b_geom.leds_num) * sizeof(uint32_t));
+  return 1;
+}
+
+/*-------------------------------------------------------------------------------------------------------------
+        n.     
+-------------------------------------------------------------------------------------------------------------*/
+static void WS2812B_batch_put(uint32_t n, const uint8_t *pattern, uint32_t phase, uint32_t tscale)
+{
+  sm_batch[n].pattern = pattern;
+  sm_batch[n].phase   = phase;
+  sm_batch[n].tscale  = tscale;
+  sm_batch_map[n >> 5] |= (1u << (n & 31));
+}
+
+/*-------------------------------------------------------------------------------------------------------------
+         .
+         phase_step_ms,    .
+     WS2812B_pattern_check    
+
+  pattern       -   , 0 -  
+  first         -   
+  num           -  
+  phase_ms      -      
+  phase_step_ms -      
+  rate          -     Q8, WS2812B_RATE_1X -  
+-------------------------------------------------------------------------------------------------------------*/
+void WS2812B_Batch_range(const uint8_t *pattern, uint32_t first, uint32_t num, uint32_t phase_ms, uint32_t phase_step_ms, uint32_t rate)
+{
+  uint32_t n;
+  uint32_t tscale;
+
+  if ((sm_batch_open == 0) || (first >= ws2812b_geom.leds_num) || (WS2812B_pattern_ok(pattern) == 0)) return;
+  if (num > ws2812b_geom.leds_num - first) num = ws2812b_geom.leds_num - first;
+  if (rate == 0) rate = WS2812B_RATE_1X;
+  tscale = (WS2812B_RATE_1X << 16) / rate;
+  for (n = first; n < first + num; n++)
+  {
+    WS2812B_batch_put(n, pattern, Conv_ms_to_ticks(phase_ms), tscale);
+    phase_ms += phase_step_ms;
+  }
+}
+
+/*-------------------------------------------------------------------------------------------------------------
+          .
+     WS2812B_pattern_check    
+
+  pattern  -   , 0 -  
+  leds     -  ,    
+  num      -  
+  phase_ms -    
+  rate     -     Q8, WS2812B_RATE_1X -  
+-------------------------------------------------------------------------------------------------------------*/
+void WS2812B_Batch_set(const uint8_t *pattern, const uint16_t *leds, uint32_t num, uint32_t phase_ms, uint32_t rate)
+{
+  uint32_t i;
+  uint32_t phase;
+  uint32_t tscale;
+
+  if ((sm_batch_open == 0) || (WS2812B_pattern_ok(pattern) == 0)) return;
+  if (rate == 0) rate = WS2812B_RATE_1X;
+  phase  = Conv_ms_to_ticks(phase_ms);
+  tscale = (WS2812B_RATE_1X << 16) / rate;
+  for (i = 0; i < num; i++)
+  {
+    if (leds[i] < ws2812b_geom.leds_num) WS2812B_batch_put(leds[i], pattern, phase, tscale);
+  }
+}
+
+/*-------------------------------------------------------------------------------------------------------------
+    .      
+-------------------------------------------------------------------------------------------------------------*/
+void WS2812B_Batch_publish(void)
+{
+  if (sm_batch_open == 0) return;
+  __DMB(); //         
+  sm_batch_pub  = sm_batch_done + 1;
+  sm_batch_open = 0; //        
+}
+
+/*-------------------------------------------------------------------------------------------------------------
+        
+-------------------------------------------------------------------------------------------------------------*/
+uint32_t WS2812B_Batch_pending(void)
+{
+  return (sm_batch_pub != sm_batch_done);
+}
+
+/*------------------------------------------------------------------------------
+          .    .
+           ,     sm_req   ,
+            
+ ------------------------------------------------------------------------------*/
+static void WS2812B_batch_apply(void)
+{
+  uint32_t            i;
+  uint32_t            k;
+  uint32_t            m;
+  uint32_t            n;
+
+  __DMB();
+  for (i = 0; i < WS2812B_DIRTY_WORDS(ws2812b_geom.leds_num); i++)
+  {
+    m = sm_batch_map[i];
+    if (m == 0) continue;
+    WS2812B_bits_take(&sm_req[i], m); //      
+    for (k = 0; m != 0; k++, m >>= 1)
+    {
+      if ((m & 1) == 0) continue;
+      n = i * 32 + k;
+      WS2812B_sm_assign(n, &sm_batch[n], sm_tick + 1); //    sm_tick   
+    }
+  }
+  __DMB(); //       
+  sm_batch_done = sm_batch_pub;
+}
+
+/*------------------------------------------------------------------------------
+             .
+             
+
+   n     -  
+   b     - ,  0  
+   start -      
+ ------------------------------------------------------------------------------*/
+static void WS2812B_sm_assign(uint32_t n, const T_WS2812B_sm_batch *b, uint32_t start)
+{
+  T_WS2812B_sm_cbl *p = &lcbl[n];
+
+  if ((b->pattern != 0) && (p->chain_ptr == b->pattern) && (p->phase == b->phase) && (p->tscale == b->tscale)) return;
+  p->chain_ptr = b->pattern;
+  p->curr_ptr  = b->pattern;
+  p->prev_hsv  = HSV_NONE;
+  p->hsv       = HSV_NONE;
+  p->data      = 0;
+  p->loop_cnt  = 0;
+  p->phase     = b->phase;
+  p->tscale    = b->tscale;
+  WS2812B_ramp_remove(n);
+  WS2812B_schedule(n, start + p->phase);
+}
+
+/*------------------------------------------------------------------------------
+       n.
+         ,   :     
+ ------------------------------------------------------------------------------*/
+static void WS2812B_slot_take(uint32_t n)
+{
+  T_WS2812B_sm_slot  *s = &sm_slot[n];
+  T_WS2812B_sm_batch  b;
+  uint32_t            seq;
+
+  seq = s->seq;
+  if (seq & 1) return;
+  __DMB();
+  b = s->a;
+  __DMB();
+  if (s->seq != seq) return;
+  WS2812B_sm_assign(n, &b, sm_tick);
+}
+
+
+/*------------------------------------------------------------------------------
+     m      LDREX/STREX.
+    ,           
+ ------------------------------------------------------------------------------*/
+static void WS2812B_bits_set(volatile uint32_t *w, uint32_t m)
+{
+  uint32_t v;
+
+  do
+  {
+    v = __LDREX((unsigned long *)w) | m;
+  } while (__STREX(v, (unsigned long *)w) != 0);
+}
+
+/*------------------------------------------------------------------------------
+             LDREX/STREX
+
+    0    , ..   
+ ------------------------------------------------------------------------------*/
+static uint32_t WS2812B_claim(volatile uint32_t *w)
+{
+  uint32_t v;
+
+  do
+  {
+    v = __LDREX((unsigned long *)w);
+    if (v & 1)
+    {
+      __CLREX();
+      return 0;
+    }
+  } while (__STREX(v + 1, (unsigned long *)w) != 0);
+  return 1;
+}
+
+/*------------------------------------------------------------------------------
+     m      LDREX/STREX
+
+      m,     
+ ------------------------------------------------------------------------------*/
+static uint32_t WS2812B_bits_take(volatile uint32_t *w, uint32_t m)
+{
+  uint32_t v;
+
+  do
+  {
+    v = __LDREX((unsigned long *)w);
+  } while (__STREX(v & ~m, (unsigned long *)w) != 0);
+  return v & m;
+}
+
+
+/*------------------------------------------------------------------------------
+      
+ ------------------------------------------------------------------------------*/
+static void WS2812B_heap_swap(uint32_t i, uint32_t j)
+{
+  uint16_t   n;
+
+  n          = sm_heap[i];
+  sm_heap[i] = sm_heap[j];
+  sm_heap[j] = n;
+  lcbl[sm_heap[i]].heap_pos = i;
+  lcbl[sm_heap[j]].heap_pos = j;
+}
+
+/*------------------------------------------------------------------------------
+         i
+ ------------------------------------------------------------------------------*/
+static void WS2812B_heap_fix(uint32_t i)
+{
+  uint32_t   c;
+
+  //   
+  while ((i > 0) && SM_BEFORE(lcbl[sm_heap[i]].deadline, lcbl[sm_heap[(i - 1) >> 1]].deadline))
+  {
+    WS2812B_heap_swap(i, (i - 1) >> 1);
+    i = (i - 1) >> 1;
+  }
+  //   
+  for (;;)
+  {
+    c = i * 2 + 1;
+    if (c >= sm_heap_len) break;
+    if (((c + 1) < sm_heap_len) && SM_BEFORE(lcbl[sm_heap[c + 1]].deadline, lcbl[sm_heap[c]].deadline)) c++;
+    if (!SM_BEFORE(lcbl[sm_heap[c]].deadline, lcbl[sm_heap[i]].deadline)) break;
+    WS2812B_heap_swap(i, c);
+    i = c;
+  }
+}
+
+/*------------------------------------------------------------------------------
+         n
+ ------------------------------------------------------------------------------*/
+static void WS2812B_schedule(uint32_t n, uint32_t deadline)
+{
+  lcbl[n].deadline = deadline;
+  if (lcbl[n].heap_pos == SM_NONE)
+  {
+    sm_heap[sm_heap_len] = n;
+    lcbl[n].heap_pos = sm_heap_len;
+    sm_heap_len++;
+  }
+  WS2812B_heap_fix(lcbl[n].heap_pos);
+}
+
+/*------------------------------------------------------------------------------
+     n   
+ ------------------------------------------------------------------------------*/
+static void WS2812B_unschedule(uint32_t n)
+{
+  uint32_t   i;
+
+  i = lcbl[n].heap_pos;
+  if (i == SM_NONE) return;
+  lcbl[n].heap_pos = SM_NONE;
+  sm_heap_len--;
+  if (i == sm_heap_len) return;
+  sm_heap[i] = sm_heap[sm_heap_len];
+  lcbl[sm_heap[i]].heap_pos = i;
+  WS2812B_heap_fix(i);
+}
+
+/*------------------------------------------------------------------------------
+     n   
+ ------------------------------------------------------------------------------*/
+static void WS2812B_ramp_add(uint32_t n)
+{
+  if (lcbl[n].ramp_pos != SM_NONE) return;
+  sm_ramps[sm_ramps_cnt] = n;
+  lcbl[n].ramp_pos = sm_ramps_cnt;
+  sm_ramps_cnt++;
+}
+
+/*------------------------------------------------------------------------------
+     n   .       
+ ------------------------------------------------------------------------------*/
+static void WS2812B_ramp_remove(uint32_t n)
+{
+  uint32_t   i;
+
+  i = lcbl[n].ramp_pos;
+  if (i == SM_NONE) return;
+  lcbl[n].ramp_pos = SM_NONE;
+  sm_ramps_cnt--;
+  if (i == sm_ramps_cnt) return;
+  sm_ramps[i] = sm_ramps[sm_ramps_cnt];
+  lcbl[sm_ramps[i]].ramp_pos = i;
+}
+
+/*------------------------------------------------------------------------------
+      n    .
+         ,     
+        .   ,       
+ ------------------------------------------------------------------------------*/
+static void WS2812B_ramp_end(uint32_t n)
+{
+  uint32_t   hsv;
+
+  if (lcbl[n].ramp_pos == SM_NONE) return;
+  WS2812B_ramp_remove(n);
+  hsv = lcbl[n].hsv;
+  WS2812B_set_led_state(n, WS2812B_norm_hue((hsv >> 16) & 0x1FF), (hsv >> 8) & 0xFF, hsv & 0xFF);
+}
+
+/*------------------------------------------------------------------------------
+      
+ ------------------------------------------------------------------------------*/
+static void WS2812B_sm_init(void)
+{
+  uint32_t   n;
+
+  for (n = 0; n < ws2812b_geom.leds_num; n++)
+  {
+    lcbl[n].heap_pos = SM_NONE;
+    lcbl[n].ramp_pos = SM_NONE;
+    lcbl[n].tscale   = 0x10000;
+  }
+  sm_heap_len  = 0;
+  sm_ramps_cnt = 0;
+  sm_jmps_cnt  = 0;
+}
+
+/*------------------------------------------------------------------------------
+    16-   .       
+ ------------------------------------------------------------------------------*/
+static uint32_t WS2812B_rd16(const uint8_t *ptr)
+{
+  return ptr[0] | (ptr[1] << 8);
+}
+
+/*------------------------------------------------------------------------------
+          n
+ ------------------------------------------------------------------------------*/
+static void WS2812B_next_item(uint32_t n)
+{
+  T_WS2812B_sm_cbl *p = &lcbl[n];
+  const uint8_t    *ip = p->curr_ptr;
+  uint32_t          op;
+  uint32_t          hsv;
+  uint32_t          cnt;
+  int32_t           rel;
+
+  op = *ip++; //   
+
+  switch (op & WS2812B_OP_MASK)
+  {
+  case WS2812B_OP_JMP:
+    //  .    
+    rel = (int16_t)WS2812B_rd16(ip);
+    ip += 2;
+    p->curr_ptr = ip + rel;
+    sm_jmps[sm_jmps_cnt++] = n;
+    WS2812B_ramp_end(n);
+    WS2812B_schedule(n, sm_tick + 1);
+    return;
+
+  case WS2812B_OP_LOOP:
+    //      .    
+    cnt = ip[0];
+    rel = (int16_t)WS2812B_rd16(ip + 1);
+    ip += 3;
+    if (p->loop_cnt == 0) p->loop_cnt = cnt;
+    if (p->loop_cnt != 0) p->loop_cnt--;
+    if (p->loop_cnt != 0) ip += rel;
+    p->curr_ptr = ip;
+    WS2812B_ramp_end(n);
+    WS2812B_schedule(n, sm_tick + 1);
+    return;
+
+  case WS2812B_OP_HOLD:
+  case WS2812B_OP_RAMP:
+    hsv = (WS2812B_HUE_DEG(ip[0]) << 16) | (ip[1] << 8) | ip[2];
+    ip += 3;
+    break;
+
+  case WS2812B_OP_HOLDS:
+  case WS2812B_OP_RAMPS:
+    hsv = (WS2812B_HUE_DEG(ip[0]) << 16) | (0xFF << 8) | ip[1]; //  
+    ip += 2;
+    break;
+
+  default:
+    //    .     
+    p->chain_ptr = 0;
+    WS2812B_ramp_end(n);
+    WS2812B_schedule(n, sm_tick + 1);
+    return;
+  }
+
+  if ((op & WS2812B_OPF_SAME_DUR) == 0)
+  {
+    p->data = WS2812B_rd16(ip);
+    ip += 2;
+  }
+  p->curr_ptr = ip;
+  if ((op & WS2812B_OPF_RAMP) != 0) WS2812B_ramp_end(n); //        
+  p->prev_hsv = p->hsv;
+  p->hsv      = hsv;
+
+  if (p->data == WS2812B_P_FOREVER)
+  {
+    //         
+    WS2812B_ramp_remove(n);
+    WS2812B_unschedule(n);
+    WS2812B_set_led_state(n, (hsv >> 16) & 0x1FF, (hsv >> 8) & 0xFF, hsv & 0xFF);
+    return;
+  }
+
+  p->duration = Conv_ms_to_ticks(p->data);
+  if (p->tscale != 0x10000) p->duration = (uint32_t)(((uint64_t)p->duration * p->tscale) >> 16);
+  p->start    = sm_tick;
+
+  if ((op & WS2812B_OPF_RAMP) == 0)
+  {
+    //   ,     
+    WS2812B_ramp_remove(n);
+    WS2812B_set_led_state(n, (hsv >> 16) & 0x1FF, (hsv >> 8) & 0xFF, hsv & 0xFF);
+  }
+  else if (p->duration != 0)
+  {
+    //        
+    WS2812B_ramp_init(&p->ramp, p->prev_hsv, p->hsv, p->duration);
+    WS2812B_ramp_add(n);
+  }
+  else
+  {
+    //       
+    WS2812B_ramp_remove(n);
+    WS2812B_set_led_state(n, (hsv >> 16) & 0x1FF, (hsv >> 8) & 0xFF, hsv & 0xFF);
+  }
+  //   duration ,      
+  WS2812B_schedule(n, sm_tick + p->duration + 1);
+}
+
+/*------------------------------------------------------------------------------
+     
+     
+
+                 ,
+   ..    ,    .
+        ,    WS2812B_ramps_render    
+ ------------------------------------------------------------------------------*/
+static void  WS2812B_state_automat(void)
+{
+  uint32_t       n;
+  uint32_t       i;
+  uint32_t       m;
+  uint32_t       k;
+  uint32_t       due = 0;
+
+  sm_tick++;
+
+  //   
+  for (i = 0; i < WS2812B_DIRTY_WORDS(ws2812b_geom.leds_num); i++)
+  {
+    if (sm_req[i] == 0) continue;
+    m = WS2812B_bits_take(&sm_req[i], 0xFFFFFFFF);
+    for (k = 0; m != 0; k++, m >>= 1)
+    {
+      if (m & 1) WS2812B_slot_take(i * 32 + k);
+    }
+  }
+
+  //    
+  while ((sm_heap_len > 0) && !SM_BEFORE(sm_tick, lcbl[sm_heap[0]].deadline))
+  {
+    n = sm_heap[0];
+    if (lcbl[n].chain_ptr == 0)
+    {
+      //   ,   
+      WS2812B_unschedule(n);
+      WS2812B_set_led_state(n, 0, 0, 0);
+    }
+    else
+    {
+      WS2812B_next_item(n);
+    }
+    due++;
+  }
+
+  ws2812b_stat.due_leds  = due;
+  ws2812b_stat.sm_ticks  = sm_tick;
+}
+
+/*------------------------------------------------------------------------------
+        .
+                 ,   
+   ,   ,    
+ ------------------------------------------------------------------------------*/
+static void  WS2812B_ramps_render(void)
+{
+  uint32_t       n;
+  uint32_t       i;
+  uint32_t       k;
+  uint32_t       hsv;
+  T_WS2812B_sm_cbl *p;
+
+  for (i = 0; i < sm_ramps_cnt; i++)
+  {
+    n = sm_ramps[i];
+    p = &lcbl[n];
+    k = sm_tick - p->start;
+    if ((k == 0) && (ws2812b_stat.sm_frac == 0)) continue; //         
+    if (k >= p->duration) hsv = p->hsv; //        
+    else hsv = WS2812B_ramp_value_frac(&p->ramp, k, ws2812b_stat.sm_frac);
+    WS2812B_set_led_state(n, WS2812B_norm_hue((hsv >> 16) & 0x1FF), (hsv >> 8) & 0xFF, hsv & 0xFF);
+  }
+  ws2812b_stat.ramp_leds = sm_ramps_cnt;
+}
+
+
+
+/*-----------------------------------------------------------------------------------------------------
+ 
+ \param void 
+-----------------------------------------------------------------------------------------------------*/
+void WS2812B_Demo_DMA(void)
+{
+  if (WS2812B_init_geometry() == 0)
+  {
+    LOGs(__FUNCTION__, __LINE__, SEVERITY_RED, "Incorrect LED strip settings.");
+    return;
+  }
+  if (WS2812B_init_bits() == 0) return;
+  WS2812B_sm_init();
+
+  _lwevent_create(&ws2812b_lwev, LWEVENT_AUTO_CLEAR);
+  Cycles_counter_init(); //   ,     
+  Init_PIT_module();     //  PIT1    PIT2  
+  ws2812b_tps     = _time_get_ticks_per_sec();
+  ws2812b_tick_us = 1000000ul / ws2812b_tps;
+  ws2812b_hw_us   = _time_get_hwticks_per_tick() / ws2812b_tick_us;
+  if (ws2812b_out->init(&ws2812b_geom, WS2812B_frame_end) == 0)
+  {
+    LOGs(__FUNCTION__, __LINE__, SEVERITY_RED, "LED strip output %s initialization error.", ws2812b_out->name);
+    return;
+  }
+  _int_disable();
+  WS2812B_output_start(); //    
+  _int_enable();
+  ws2812b_ready = 1;
+
+  //     .
+  //     ,     40     
+  if ((WS2812B_pattern_check(demo_chain, sizeof(demo_chain)) == 0) || (WS2812B_Batch_begin() == 0))
+  {
+    LOGs(__FUNCTION__, __LINE__, SEVERITY_RED, "LED strip demo pattern batch is not accepted.");
+    return;
+  }
+  WS2812B_Batch_range(demo_chain, 0, ws2812b_geom.leds_num, 0, 40, WS2812B_RATE_1X);
+  WS2812B_Batch_publish();
+}
+
+/*-----------------------------------------------------------------------------------------------------
+         
+-----------------------------------------------------------------------------------------------------*/
+const T_WS2812B_stat* WS2812B_get_stat(void)
+{
+  return &ws2812b_stat;
+}
+
+/*-----------------------------------------------------------------------------------------------------
+        .
+       ,     ,
+            
+
+  ticks -     , 0 -   
+   MQX_OK   
+-----------------------------------------------------------------------------------------------------*/
+_mqx_uint WS2812B_wait_frame_done(uint32_t ticks)
+{
+  _lwevent_clear(&ws2812b_lwev, WS2812B_EVT_FRAME_DONE);
+  return _lwevent_wait_ticks(&ws2812b_lwev, WS2812B_EVT_FRAME_DONE, FALSE, ticks);
+}
+
+/*-----------------------------------------------------------------------------------------------------
+         strip.
+     WS2812B_wait_frame_done,       
+
+  ticks -     , 0 -   
+   MQX_OK   
+-----------------------------------------------------------------------------------------------------*/
+_mqx_uint WS2812B_wait_strip_done(uint32_t strip, uint32_t ticks)
+{
+  if (strip >= ws2812b_strips) return MQX_INVALID_PARAMETER;
+  _lwevent_clear(&ws2812b_lwev, WS2812B_EVT_STRIP_DONE(strip));
+  return _lwevent_wait_ticks(&ws2812b_lwev, WS2812B_EVT_STRIP_DONE(strip), FALSE, ticks);
+}
+
+/*-----------------------------------------------------------------------------------------------------
+           
+-----------------------------------------------------------------------------------------------------*/
+uint32_t WS2812B_get_strips_busy(void)
+{
+  return strips_busy;
+}
+
+/*-----------------------------------------------------------------------------------------------------
+     
+-----------------------------------------------------------------------------------------------------*/
+uint32_t WS2812B_get_strips_num(void)
+{
+  return ws2812b_strips;
+}
+
+/*-----------------------------------------------------------------------------------------------------
+     
+-----------------------------------------------------------------------------------------------------*/
+const T_WS2812B_backend* WS2812B_get_backend(void)
+{
+  return ws2812b_out;
+}
+
+/*-----------------------------------------------------------------------------------------------------
+   .    0    
+-----------------------------------------------------------------------------------------------------*/
+const T_WS2812B_geometry* WS2812B_get_geometry(void)
+{
+  return &ws2812b_geom;
+}
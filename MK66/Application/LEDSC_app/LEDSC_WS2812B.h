@@ -20,8 +20,203 @@
 #define  HSV_BLUE_RED   0x12CFFFF // hue = 300, sat = 255, value = 255
 
 
-void WS2812B_Demo_DMA(void);
-void WS2812B_periodic_refresh(void);
+#define  WS2812B_BITS_PER_LED  24 //       RGB
+#define  WS2812B_COLRS_MAX     4  //       (RGBW)
+#define  WS2812B_BITS_PER_LED_MAX (WS2812B_COLRS_MAX * 8)
+#define  WS2812B_LEDS_MAX      1024 //     .     16- 
+#define  WS2812B_RESET_BITS    144 //         (180 )
+#define  WS2812B_STREAM_LEDS   4  //        
+#define  WS2812B_RATE_1X       256 //       Q8
+#define  WS2812B_PATTERNS_MAX  32  //       
+#define  WS2812B_STRIPS_MAX    8   //        FTM0
+#define  WS2812B_FTM_CLK_MHZ   60  //   FTM0  
+#define  WS2812B_FTM_NS(cnt)   ((cnt) * 1000 / WS2812B_FTM_CLK_MHZ) //   FTM0  
+
+//       ( ws2812b_color_order)
+#define  WS2812B_ORDER_GRB     0 // WS2812B
+#define  WS2812B_ORDER_RGB     1
+#define  WS2812B_ORDER_GRBW    2 // SK6812 RGBW.          
+#define  WS2812B_ORDER_NUM     3
+
+//   
+#define  WS2812B_SRC_PATTERNS  0 //  (  ) 
+#define  WS2812B_SRC_PALETTE   1 //    
+#define  WS2812B_SRC_EFFECT    2 //  
+#define  WS2812B_SRC_NUM       3
+
+#define  WS2812B_PT_LAYER      (WS2812B_LAYERS_MAX - 1) //   .        
+
+//     
+typedef struct
+{
+  volatile uint32_t  frames;          //   
+  volatile uint32_t  underruns;       //        
+  volatile uint32_t  isr_max_cycles;  //          
+  uint32_t           skipped_frames;    //    ,    
+  uint32_t           changed_leds;      //       
+  uint32_t           converted_leds;    //   HSV -> RGB   
+  uint32_t           encoded_leds;      //         
+  uint32_t           render_cycles;     //      
+  uint32_t           render_max_cycles; //      
+  uint32_t           due_leds;          //          
+  uint32_t           ramp_leds;         //        
+  uint32_t           sm_ticks;          //     
+  uint32_t           sm_frac;           //          1/256
+  uint32_t           lost_ticks;        //        
+  volatile uint32_t  strip_frames[WS2812B_STRIPS_MAX]; //      
+  volatile uint32_t  strips_skew_max_cycles; //            
+  uint32_t           compose_cycles;    //         
+  uint32_t           pt_live;           //   
+  uint32_t           pt_cycles;         //           
+  uint32_t           render_budget_cycles; //       
+  uint32_t           render_overruns;   //      
+  uint32_t           dropped_frames;    //     :         
+} T_WS2812B_stat;
+
+//  .    ,          
+typedef struct
+{
+  uint32_t  leds_num;     //    
+  uint32_t  strips_num;   //    
+  uint32_t  strip_leds;   //    .     
+  uint32_t  order;        //    WS2812B_ORDER_...
+  uint32_t  colrs;        //     : 3  4
+  uint32_t  bits_per_led; //      
+  uint8_t   shift[WS2812B_COLRS_MAX]; //     (00000000 RRRRRRRR GGGGGGGG BBBBBBBB)   
+} T_WS2812B_geometry;
+
+//       .       
+typedef struct
+{
+  uint32_t  t0h;   //     0
+  uint32_t  t1h;   //     1
+  uint32_t  bit;   //  
+  uint32_t  reset; //    
+  uint32_t  gap;   //         . 0 -   
+} T_WS2812B_wave;
+
+//   .      RGB     .
+//  swap  start         
+typedef struct
+{
+  const char *name;
+  const T_WS2812B_wave *wave;
+  uint32_t  (*init)(const T_WS2812B_geometry *geom, void (*frame_done)(void)); // .  0  . frame_done       
+  uint32_t  (*prepare)(const uint32_t *frame);                    //       .    
+  void      (*swap)(void);                                        //       
+  void      (*start)(const uint32_t *frame);                      //    
+  uint32_t  (*decode)(uint32_t *frame, uint32_t *errs);           //        RGB  .     0    .
+                                                                  //  errs,   0,        0  1      
+} T_WS2812B_backend;
+
+extern const T_WS2812B_backend ws2812b_ftm_backend;
+extern const uint8_t (*ws2812b_out_lut)[256]; //    ,     : 0 - B, 1 - G, 2 - R, 3 - W
+
+
+/*
+    (  ) .
+
+   -    , 16-      .
+        ,       .
+        :
+
+                        
+  0x00  1       -                        .  
+  0x10  3       rel16                      rel16 .   
+  0x20  4       cnt8, rel16              :   rel16      cnt8 .   
+  0x40  6       hue8, sat8, val8, dur16        dur16 
+  0x50  6       hue8, sat8, val8, dur16       dur16 
+  0x60  5       hue8, val8, dur16            
+  0x70  5       hue8, val8, dur16              
+
+   WS2812B_OPF_SAME_DUR        dur16,    .
+   hue8       (0..255 -> 0..359 ).
+   WS2812B_P_FOREVER       .
+        WS2812B_pattern_check.
+*/
+#define  WS2812B_OP_MASK       0xF0
+#define  WS2812B_OP_STOP       0x00
+#define  WS2812B_OP_JMP        0x10
+#define  WS2812B_OP_LOOP       0x20
+#define  WS2812B_OP_HOLD       0x40
+#define  WS2812B_OP_RAMP       0x50
+#define  WS2812B_OP_HOLDS      0x60
+#define  WS2812B_OP_RAMPS      0x70
+#define  WS2812B_OPF_RAMP      0x10 //       
+#define  WS2812B_OPF_SAME_DUR  0x01 //   ,    
+
+#define  WS2812B_P_FOREVER     0xFFFF
+
+#define  WS2812B_HUE8(deg)     ((((deg) * 256 + 180) / 360) & 0xFF) //       
+#define  WS2812B_HUE_DEG(h8)   (((h8) * 360 + 128) >> 8)            //       
+
+#define  WS2812B_P_LO(x)       ((uint8_t)((x) & 0xFF))
+#define  WS2812B_P_HI(x)       ((uint8_t)(((x) >> 8) & 0xFF))
+
+//        uint8_t
+#define  WS2812B_P_STOP()                 WS2812B_OP_STOP
+#define  WS2812B_P_JMP(rel)               WS2812B_OP_JMP, WS2812B_P_LO(rel), WS2812B_P_HI(rel)
+#define  WS2812B_P_LOOP(cnt, rel)         WS2812B_OP_LOOP, (cnt), WS2812B_P_LO(rel), WS2812B_P_HI(rel)
+#define  WS2812B_P_HOLD(h8, s, v, ms)     WS2812B_OP_HOLD, (h8), (s), (v), WS2812B_P_LO(ms), WS2812B_P_HI(ms)
+#define  WS2812B_P_RAMP(h8, s, v, ms)     WS2812B_OP_RAMP, (h8), (s), (v), WS2812B_P_LO(ms), WS2812B_P_HI(ms)
+#define  WS2812B_P_HOLD_SD(h8, s, v)      (WS2812B_OP_HOLD | WS2812B_OPF_SAME_DUR), (h8), (s), (v)
+#define  WS2812B_P_RAMP_SD(h8, s, v)      (WS2812B_OP_RAMP | WS2812B_OPF_SAME_DUR), (h8), (s), (v)
+#define  WS2812B_P_HOLDS(h8, v, ms)       WS2812B_OP_HOLDS, (h8), (v), WS2812B_P_LO(ms), WS2812B_P_HI(ms)
+#define  WS2812B_P_RAMPS(h8, v, ms)       WS2812B_OP_RAMPS, (h8), (v), WS2812B_P_LO(ms), WS2812B_P_HI(ms)
+#define  WS2812B_P_HOLDS_SD(h8, v)        (WS2812B_OP_HOLDS | WS2812B_OPF_SAME_DUR), (h8), (v)
+#define  WS2812B_P_RAMPS_SD(h8, v)        (WS2812B_OP_RAMPS | WS2812B_OPF_SAME_DUR), (h8), (v)
+
+//    .           Q16
+typedef struct
+{
+  int32_t   hue;
+  int32_t   sat;
+  int32_t   val;
+  int32_t   d_hue;
+  int32_t   d_sat;
+  int32_t   d_val;
+} T_WS2812B_ramp;
+
+
+void     WS2812B_Demo_DMA(void);
+uint32_t WS2812B_periodic_refresh(uint32_t us);
+void     WS2812B_update_fps(void);
+void     Task_WS2812B_render(uint32_t initial_data);
+uint32_t WS2812B_pattern_check(const uint8_t *blob, uint32_t len);
+uint32_t WS2812B_Set_pattern(const uint8_t *pattern, uint32_t n);
+uint32_t WS2812B_Set_shared_pattern(const uint8_t *pattern, uint32_t n, uint32_t phase_ms, uint32_t rate);
+uint32_t WS2812B_Batch_begin(void);
+void     WS2812B_Batch_range(const uint8_t *pattern, uint32_t first, uint32_t num, uint32_t phase_ms, uint32_t phase_step_ms, uint32_t rate);
+void     WS2812B_Batch_set(const uint8_t *pattern, const uint16_t *leds, uint32_t num, uint32_t phase_ms, uint32_t rate);
+void     WS2812B_Batch_publish(void);
+uint32_t WS2812B_Batch_pending(void);
+void     WS2812B_encode_rgb(uint16_t *dst, uint32_t rgb);
+void     WS2812B_update_output_lut(void);
+uint32_t Convert_H_S_V_to_RGB(uint32_t hue, uint32_t sat, uint32_t val);
+const T_WS2812B_stat* WS2812B_get_stat(void);
+_mqx_uint WS2812B_wait_frame_done(uint32_t ticks);
+_mqx_uint WS2812B_wait_strip_done(uint32_t strip, uint32_t ticks);
+uint32_t WS2812B_get_strips_busy(void);
+uint32_t WS2812B_get_strips_num(void);
+const T_WS2812B_backend* WS2812B_get_backend(void);
+const T_WS2812B_geometry* WS2812B_get_geometry(void);
+void     WS2812B_set_source(uint32_t src);
+void     WS2812B_Set_effect(const T_WS2812B_fx_params *p);
+void     WS2812B_Set_script(const T_WS2812B_vm_prog *prog);
+uint32_t WS2812B_Spawn_particles(const T_WS2812B_pt_spawn *s);
+void     WS2812B_Set_emitter(const T_WS2812B_pt_spawn *s, uint32_t width, uint32_t rate);
+void     WS2812B_pt_level(uint32_t level);
+void     WS2812B_pal_set(uint32_t first, const uint32_t *rgb, uint32_t num);
+void     WS2812B_pal_set_hsv(uint32_t i, uint32_t hue, uint32_t sat, uint32_t val);
+void     WS2812B_pal_gradient(uint32_t first, uint32_t first_rgb, uint32_t last, uint32_t last_rgb);
+void     WS2812B_pal_set_index(uint32_t first, const uint8_t *idx, uint32_t num);
+void     WS2812B_pal_rotate(int32_t step);
+void     WS2812B_pal_blend(const uint32_t *target, uint32_t amount);
+uint32_t WS2812B_layer_set(uint32_t layer, const uint32_t *pix, uint32_t mode, uint32_t alpha);
+void     WS2812B_layer_alpha(uint32_t layer, uint32_t alpha);
+void     WS2812B_ramp_init(T_WS2812B_ramp *r, uint32_t from_hsv, uint32_t to_hsv, uint32_t duration);
+uint32_t WS2812B_ramp_value(const T_WS2812B_ramp *r, uint32_t k);
+uint32_t WS2812B_ramp_value_frac(const T_WS2812B_ramp *r, uint32_t k, uint32_t frac);
 
 #endif // LEDSC_WS2812B_H
 
@@ -0,0 +1,261 @@
+//    8-  WS2812B    GPIO.
+//
+//      ,    i  -    i.
+//    PWM  FTM0         DMA:
+//   -        PSOR -    1
+//   -   T0H     PDOR -    0 
+//   -   T1H     PCOR -    0
+//          3   DMA  2-     .
+#include   "App.h"
+
+#define   GPIO_SET_CNV   1                   //   .  CnV = 0     DMA
+#define   GPIO_DAT_CNV   (FTM_WS2812B_0 + 1) //   ,  0 
+#define   GPIO_CLR_CNV   (FTM_WS2812B_1 + 1) //   ,  1 
+
+//        .     WS2812B_RESET_BITS    ,    0.
+//         
+static uint32_t            *gpio_front;
+static uint32_t            *gpio_back;
+
+static uint8_t              gpio_lanes;       //      PSOR  PCOR
+static uint32_t             gpio_leds_num;    //    
+static uint32_t             gpio_strip_leds;  //     
+static void               (*gpio_frame_done)(void);
+
+/*-----------------------------------------------------------------------------------------------------
+     DMA         
+
+  ch    -   DMA
+  saddr -  
+  soff  -    . 0 -    
+  daddr -   
+  cnt   -  
+  intr  - 1 -    
+-----------------------------------------------------------------------------------------------------*/
+static void WS2812B_GPIO_init_TCD(uint32_t ch, uint32_t saddr, uint32_t soff, uint32_t daddr, uint32_t cnt, uint32_t intr)
+{
+  DMA_MemMapPtr    DMA     = DMA_BASE_PTR;
+
+  DMA->TCD[ch].SADDR = saddr;
+  DMA->TCD[ch].SOFF = soff;
+  DMA->TCD[ch].SLAST = 0;
+  DMA->TCD[ch].DADDR = daddr;
+  DMA->TCD[ch].DOFF = 0;
+  DMA->TCD[ch].DLAST_SGA = 0;
+  DMA->TCD[ch].NBYTES_MLNO = 1;
+
+  DMA->TCD[ch].BITER_ELINKNO = 0
+    + LSHIFT(0, 15)                  // ELINK  |   
+    + LSHIFT(cnt, 0)                 // BITER  | Starting Major Iteration Count (15 bit)
+  ;
+  DMA->TCD[ch].CITER_ELINKNO = 0
+    + LSHIFT(0, 15)                  // ELINK  |   
+    + LSHIFT(cnt, 0)                 // CITER  | Current Major Iteration Count (15 bit)
+  ;
+  DMA->TCD[ch].ATTR = 0
+    + LSHIFT(0, 11) // SMOD  |     
+    + LSHIFT(0, 8)  // SSIZE | 8-    
+    + LSHIFT(0, 3)  // DMOD  |   
+    + LSHIFT(0, 0)  // DSIZE | 8-    .          
+  ;
+  DMA->TCD[ch].CSR = 0
+    + LSHIFT(0, 14)   // BWC         | Bandwidth Control. 00 No eDMA engine stalls
+    + LSHIFT(1, 3)    // DREQ        |     
+    + LSHIFT(intr, 1) // INTMAJOR    |    
+  ;
+}
+
+/*-----------------------------------------------------------------------------------------------------
+   DMA        
+-----------------------------------------------------------------------------------------------------*/
+static void WS2812B_GPIO_DMA_isr(void *user_isr_ptr)
+{
+  DMA_MemMapPtr    DMA     = DMA_BASE_PTR;
+  FTM_MemMapPtr    FTM     = FTM0_BASE_PTR;
+
+  if ((DMA->INT & (1u << DMA_WS2812B_GPIO_CLR_CH)) == 0) return;
+  DMA->INT = 1u << DMA_WS2812B_GPIO_CLR_CH; //     
+
+  //   DMA      
+  FTM->CONTROLS[WS2812B_GPIO_FTM_SET_CH].CnSC &= ~(LSHIFT(1, 6) | LSHIFT(1, 0));
+  FTM->CONTROLS[WS2812B_GPIO_FTM_DAT_CH].CnSC &= ~(LSHIFT(1, 6) | LSHIFT(1, 0));
+  FTM->CONTROLS[WS2812B_GPIO_FTM_CLR_CH].CnSC &= ~(LSHIFT(1, 6) | LSHIFT(1, 0));
+
+  if (gpio_frame_done != 0) gpio_frame_done();
+}
+
+/*-----------------------------------------------------------------------------------------------------
+     .     
+         DMA
+-----------------------------------------------------------------------------------------------------*/
+void WS2812B_GPIO_start(const uint32_t *frame)
+{
+  DMA_MemMapPtr    DMA     = DMA_BASE_PTR;
+  FTM_MemMapPtr    FTM     = FTM0_BASE_PTR;
+  GPIO_MemMapPtr   GPIO    = WS2812B_GPIO_PTR;
+  uint32_t         bits    = gpio_strip_leds * WS2812B_LANE_BYTES_PER_LED;
+  uint32_t         cnt;
+
+  //      ,          
+  WS2812B_GPIO_init_TCD(DMA_WS2812B_GPIO_SET_CH, (uint32_t)&gpio_lanes, 0, (uint32_t)&GPIO->PSOR, bits, 0);
+  WS2812B_GPIO_init_TCD(DMA_WS2812B_GPIO_DAT_CH, (uint32_t)gpio_front, 1, (uint32_t)&GPIO->PDOR, bits + WS2812B_RESET_BITS, 0);
+  WS2812B_GPIO_init_TCD(DMA_WS2812B_GPIO_CLR_CH, (uint32_t)&gpio_lanes, 0, (uint32_t)&GPIO->PCOR, bits + WS2812B_RESET_BITS, 1);
+  DMA->SERQ = DMA_WS2812B_GPIO_SET_CH;
+  DMA->SERQ = DMA_WS2812B_GPIO_DAT_CH;
+  DMA->SERQ = DMA_WS2812B_GPIO_CLR_CH;
+
+  //        ,        .
+  //  CnSC    CHF = 0       
+  do
+  {
+    cnt = FTM->CNT;
+  } while ((cnt <= GPIO_CLR_CNV) || (cnt > (GPIO_CLR_CNV + 8)));
+  FTM->CONTROLS[WS2812B_GPIO_FTM_SET_CH].CnSC = (FTM->CONTROLS[WS2812B_GPIO_FTM_SET_CH].CnSC & ~LSHIFT(1, 7)) | LSHIFT(1, 6) | LSHIFT(1, 0);
+  FTM->CONTROLS[WS2812B_GPIO_FTM_DAT_CH].CnSC = (FTM->CONTROLS[WS2812B_GPIO_FTM_DAT_CH].CnSC & ~LSHIFT(1, 7)) | LSHIFT(1, 6) | LSHIFT(1, 0);
+  FTM->CONTROLS[WS2812B_GPIO_FTM_CLR_CH].CnSC = (FTM->CONTROLS[WS2812B_GPIO_FTM_CLR_CH].CnSC & ~LSHIFT(1, 7)) | LSHIFT(1, 6) | LSHIFT(1, 0);
+}
+
+/*-----------------------------------------------------------------------------------------------------
+              .
+    ,        
+
+     
+-----------------------------------------------------------------------------------------------------*/
+uint32_t WS2812B_GPIO_prepare(const uint32_t *frame)
+{
+  WS2812B_transpose_frame(gpio_back, frame, gpio_leds_num, gpio_strip_leds, gpio_lanes, ws2812b_out_lut);
+  return gpio_leds_num;
+}
+
+/*-----------------------------------------------------------------------------------------------------
+          
+-----------------------------------------------------------------------------------------------------*/
+void WS2812B_GPIO_swap(void)
+{
+  uint32_t *p;
+
+  p          = gpio_front;
+  gpio_front = gpio_back;
+  gpio_back  = p;
+}
+
+/*-----------------------------------------------------------------------------------------------------
+           RGB.
+   k     (7 - k % 8)  ,       .
+          :   PDOR     .
+        ,     
+
+     
+-----------------------------------------------------------------------------------------------------*/
+uint32_t WS2812B_GPIO_decode(uint32_t *frame, uint32_t *errs)
+{
+  const uint8_t *src = (const uint8_t *)gpio_back;
+  uint32_t       i, l, k;
+  uint32_t       g, r, b;
+  uint32_t       pos = 0;
+  uint32_t       err = 0;
+
+  for (i = 0; i < gpio_strip_leds * WS2812B_LANE_BYTES_PER_LED; i++)
+  {
+    if (src[i] & ~gpio_lanes) err++;
+  }
+
+  for (i = 0; (i < WS2812B_LANES) && (pos < gpio_leds_num); i++)
+  {
+    if ((gpio_lanes & (1u << i)) == 0) continue;
+    for (l = 0; (l < gpio_strip_leds) && (pos + l < gpio_leds_num); l++)
+    {
+      src = (const uint8_t *)gpio_back + l * WS2812B_LANE_BYTES_PER_LED;
+      g   = 0;
+      r   = 0;
+      b   = 0;
+      for (k = 0; k < 8; k++)
+      {
+        g = (g << 1) | ((src[k]      >> i) & 1);
+        r = (r << 1) | ((src[k + 8]  >> i) & 1);
+        b = (b << 1) | ((src[k + 16] >> i) & 1);
+      }
+      frame[pos + l] = (r << 16) | (g << 8) | b;
+    }
+    pos += gpio_strip_leds;
+  }
+  if (errs != 0) *errs += err;
+  return gpio_leds_num;
+}
+
+/*-----------------------------------------------------------------------------------------------------
+      GPIO.  FTM0     FTM_init_PWM_DMA
+
+  geom       -  .    geom->strips_num   WS2812B_GPIO_LANES_MASK.
+                  24-     GRB
+  frame_done -     DMA    
+
+         0  
+-----------------------------------------------------------------------------------------------------*/
+uint32_t WS2812B_GPIO_init(const T_WS2812B_geometry *geom, void (*frame_done)(void))
+{
+  FTM_MemMapPtr    FTM     = FTM0_BASE_PTR;
+  GPIO_MemMapPtr   GPIO    = WS2812B_GPIO_PTR;
+  DMAMUX_MemMapPtr DMAMUX  = DMA_WS2812B_DMUX_PTR;
+  uint32_t         lanes   = 0;
+  uint32_t         mask    = 0;
+  uint32_t         bytes;
+  uint32_t         i;
+
+  if (geom->order != WS2812B_ORDER_GRB) return 0;
+  for (i = 0; i < WS2812B_LANES; i++)
+  {
+    if ((WS2812B_GPIO_LANES_MASK & (1u << i)) && (lanes < geom->strips_num))
+    {
+      mask |= 1u << i;
+      lanes++;
+    }
+  }
+  if (lanes == 0) return 0;
+  gpio_strip_leds = (geom->leds_num + lanes - 1) / lanes;
+  if (gpio_strip_leds > WS2812B_GPIO_STRIP_LEDS_MAX) return 0;
+  gpio_leds_num   = geom->leds_num;
+  gpio_lanes      = mask;
+  gpio_frame_done = frame_done;
+
+  bytes      = gpio_strip_leds * WS2812B_LANE_BYTES_PER_LED + WS2812B_RESET_BITS;
+  gpio_front = (uint32_t *)_mem_alloc_system_zero(bytes);
+  gpio_back  = (uint32_t *)_mem_alloc_system_zero(bytes);
+  if ((gpio_front == 0) || (gpio_back == 0)) return 0;
+
+  GPIO->PCOR  = mask;  //   0   
+  GPIO->PDDR |= mask;  //   
+
+  FTM->CONTROLS[WS2812B_GPIO_FTM_SET_CH].CnV = GPIO_SET_CNV;
+  FTM->CONTROLS[WS2812B_GPIO_FTM_DAT_CH].CnV = GPIO_DAT_CNV;
+  FTM->CONTROLS[WS2812B_GPIO_FTM_CLR_CH].CnV = GPIO_CLR_CNV;
+
+  DMAMUX->CHCFG[DMA_WS2812B_GPIO_SET_CH] = DMUX_SRC_FTM0_CH0 + WS2812B_GPIO_FTM_SET_CH + BIT(7);
+  DMAMUX->CHCFG[DMA_WS2812B_GPIO_DAT_CH] = DMUX_SRC_FTM0_CH0 + WS2812B_GPIO_FTM_DAT_CH + BIT(7);
+  DMAMUX->CHCFG[DMA_WS2812B_GPIO_CLR_CH] = DMUX_SRC_FTM0_CH0 + WS2812B_GPIO_FTM_CLR_CH + BIT(7);
+
+  Install_and_enable_isr(DMA_WS2812B_GPIO_INT_NUM, WS2812B_DMA_ISR_PRIO, WS2812B_GPIO_DMA_isr);
+  return gpio_strip_leds;
+}
+
+//   :    GPIO_SET_CNV,    GPIO_DAT_CNV    GPIO_CLR_CNV
+static const T_WS2812B_wave gpio_wave =
+{
+  WS2812B_FTM_NS(GPIO_DAT_CNV - GPIO_SET_CNV),
+  WS2812B_FTM_NS(GPIO_CLR_CNV - GPIO_SET_CNV),
+  WS2812B_FTM_NS(FTM_WS2812B_MOD + 1),
+  WS2812B_FTM_NS((FTM_WS2812B_MOD + 1) * WS2812B_RESET_BITS),
+  0,
+};
+
+//       GPIO
+const T_WS2812B_backend ws2812b_gpio_backend =
+{
+  "GPIO",
+  &gpio_wave,
+  WS2812B_GPIO_init,
+  WS2812B_GPIO_prepare,
+  WS2812B_GPIO_swap,
+  WS2812B_GPIO_start,
+  WS2812B_GPIO_decode,
+};
@@ -0,0 +1,16 @@
+#ifndef LEDSC_WS2812B_GPIO_H
+#define LEDSC_WS2812B_GPIO_H
+
+#include   "LEDSC_WS2812B_transpose.h"
+
+#define  WS2812B_GPIO_STRIP_LEDS_MAX  ((0x7FFF - WS2812B_RESET_BITS) / WS2812B_LANE_BYTES_PER_LED) //      .  15-    DMA
+
+uint32_t WS2812B_GPIO_init(const T_WS2812B_geometry *geom, void (*frame_done)(void));
+uint32_t WS2812B_GPIO_prepare(const uint32_t *frame);
+void     WS2812B_GPIO_swap(void);
+void     WS2812B_GPIO_start(const uint32_t *frame);
+uint32_t WS2812B_GPIO_decode(uint32_t *frame, uint32_t *errs);
+
+extern const T_WS2812B_backend ws2812b_gpio_backend;
+
+#endif // LEDSC_WS2812B_GPIO_H
@@ -0,0 +1,274 @@
+//   WS2812B   DSPI.
+//
+//     4-     SOUT: 0 - 1000, 1 - 1110.
+//   SCK 3.33    SPI 300 , .. T0H = 300, T0L = 900, T1H = 900, T1L = 300 ,   1.2 .
+//       WS2812B.  1000/1100  3   T1L = 667 ,   600 ,
+//     SCK   T1H  T1L   1100 .
+//  SPI - 8 , ..  .    SPI (tDT, WS2812B_SPI_GAP_NS)  
+//             ,   T0L = 933, T1L = 333 .
+//  3-  ,   ,  .
+//   RGB  12   DMA  48     FTM.
+//   ,      .
+#include   "App.h"
+
+extern const T_SPI_modules spi_mods[3];
+
+#define   SPI_RESET_BYTES  (WS2812B_RESET_BITS * WS2812B_SPI_SYM_BITS / 8) //    ,   0
+
+//      4   SPI    (    )
+static uint32_t          spi_lut[256];
+static uint32_t          spi_colrs;                     //     
+static uint8_t           spi_shift[WS2812B_COLRS_MAX];  //       
+
+//      .          .
+//       
+static uint8_t          *spi_front;
+static uint8_t          *spi_back;
+
+static uint32_t          spi_leds_num;   //    
+static uint32_t          spi_led_bytes;  //     
+static uint32_t          spi_bytes;      //         
+static T_DMA_SPI_cbl     spi_dma_cbl;
+static void            (*spi_frame_done)(void);
+
+/*-----------------------------------------------------------------------------------------------------
+         SPI        
+-----------------------------------------------------------------------------------------------------*/
+void WS2812B_SPI_init_lut(const T_WS2812B_geometry *geom)
+{
+  uint32_t b, i;
+  uint32_t hi, lo;
+  uint32_t w;
+
+  spi_colrs = geom->colrs;
+  memcpy(spi_shift, geom->shift, sizeof(spi_shift));
+  spi_led_bytes = spi_colrs * WS2812B_SPI_BYTES_PER_COLR;
+
+  for (b = 0; b < 256; b++)
+  {
+    w = 0;
+    for (i = 0; i < 4; i++)
+    {
+      //     ,       
+      if ((b >> (7 - i * 2)) & 1) hi = WS2812B_SPI_SYM_1;
+      else hi = WS2812B_SPI_SYM_0;
+      if ((b >> (6 - i * 2)) & 1) lo = WS2812B_SPI_SYM_1;
+      else lo = WS2812B_SPI_SYM_0;
+      w |= ((hi << 4) | lo) << (i * 8);
+    }
+    spi_lut[b] = w;
+  }
+}
+
+/*-----------------------------------------------------------------------------------------------------
+        SPI      ,
+   WS2812B - 12    G, R, B.        
+
+  dst -     4-    ,     4 
+  rgb -    RGB (WWWWWWWW RRRRRRRR GGGGGGGG BBBBBBBB)
+-----------------------------------------------------------------------------------------------------*/
+void WS2812B_SPI_encode_rgb(uint8_t *dst, uint32_t rgb)
+{
+  uint32_t *d = (uint32_t *)dst;
+  const uint8_t (*lut)[256] = ws2812b_out_lut;
+  uint32_t  c;
+  uint32_t  sh;
+
+  for (c = 0; c < spi_colrs; c++)
+  {
+    sh   = spi_shift[c];
+    d[c] = spi_lut[lut[sh >> 3][(rgb >> sh) & 0xFF]]; //     
+  }
+}
+
+/*-----------------------------------------------------------------------------------------------------
+   DMA          FIFO .
+   FIFO     ,      
+-----------------------------------------------------------------------------------------------------*/
+static void WS2812B_SPI_DMA_isr(void *user_isr_ptr)
+{
+  DMA_MemMapPtr    DMA     = DMA_BASE_PTR;
+
+  if ((DMA->INT & (1u << DMA_WS2812B_SPI_CH)) == 0) return;
+  DMA->INT = 1u << DMA_WS2812B_SPI_CH; //     
+
+  if (spi_frame_done != 0) spi_frame_done();
+}
+
+/*-----------------------------------------------------------------------------------------------------
+     .     
+         DMA
+-----------------------------------------------------------------------------------------------------*/
+static void WS2812B_SPI_start(const uint32_t *frame)
+{
+  DMA_MemMapPtr    DMA     = DMA_BASE_PTR;
+  uint32_t         ch      = spi_dma_cbl.tx_ch;
+
+  // Start_DMA_for_SPI_TX  ,      ,     
+  DMA->CDNE = ch;
+  DMA->TCD[ch].SADDR = (uint32_t)spi_front;
+  DMA->TCD[ch].BITER_ELINKNO = LSHIFT(spi_bytes, 0);
+  DMA->TCD[ch].CITER_ELINKNO = LSHIFT(spi_bytes, 0);
+  DMA->SERQ = ch;
+}
+
+/*-----------------------------------------------------------------------------------------------------
+        SPI
+
+     
+-----------------------------------------------------------------------------------------------------*/
+static uint32_t WS2812B_SPI_prepare(const uint32_t *frame)
+{
+  uint32_t n;
+
+  for (n = 0; n < spi_leds_num; n++)
+  {
+    WS2812B_SPI_encode_rgb(&spi_back[n * spi_led_bytes], frame[n]);
+  }
+  return spi_leds_num;
+}
+
+/*-----------------------------------------------------------------------------------------------------
+         SPI
+-----------------------------------------------------------------------------------------------------*/
+static void WS2812B_SPI_swap(void)
+{
+  uint8_t *p;
+
+  p         = spi_front;
+  spi_front = spi_back;
+  spi_back  = p;
+}
+
+/*-----------------------------------------------------------------------------------------------------
+      SPI    RGB.
+         SOUT,    WS2812B_SPI_SYM_1    0
+    ,    WS2812B_SPI_SYM_0.        
+
+     
+-----------------------------------------------------------------------------------------------------*/
+static uint32_t WS2812B_SPI_decode(uint32_t *frame, uint32_t *errs)
+{
+  const uint8_t *src;
+  uint32_t       n, i;
+  uint32_t       sym;
+  uint32_t       b;
+  uint32_t       rgb;
+  uint32_t       err = 0;
+
+  for (n = 0; n < spi_leds_num; n++)
+  {
+    src = &spi_back[n * spi_led_bytes];
+    b   = 0;
+    rgb = 0;
+    for (i = 0; i < spi_colrs * 8; i++)
+    {
+      sym = (src[i >> 1] >> ((i & 1) ? 0 : 4)) & 0x0F;
+      b   = (b << 1) | (sym == WS2812B_SPI_SYM_1);
+      if ((sym != WS2812B_SPI_SYM_1) && (sym != WS2812B_SPI_SYM_0)) err++;
+      if ((i & 7) == 7)
+      {
+        rgb |= (b & 0xFF) << spi_shift[i >> 3];
+        b    = 0;
+      }
+    }
+    frame[n] = rgb;
+  }
+  for (i = spi_leds_num * spi_led_bytes; i < spi_bytes; i++)
+  {
+    if (spi_back[i] != 0) err++;
+  }
+  if (errs != 0) *errs += err;
+  return spi_leds_num;
+}
+
+/*-----------------------------------------------------------------------------------------------------
+      DSPI
+
+  geom       -  .       
+  frame_done -     DMA    
+
+      0  
+-----------------------------------------------------------------------------------------------------*/
+static uint32_t WS2812B_SPI_init(const T_WS2812B_geometry *geom, void (*frame_done)(void))
+{
+  SPI_MemMapPtr        SPI     = spi_mods[WS2812B_SPI].spi;
+  PORT_MemMapPtr       PORT    = WS2812B_SPI_SOUT_PORT;
+  T_DMA_SPI_TX_config  tx_cfg;
+  uint32_t             n;
+
+  if (geom->leds_num == 0) return 0;
+  WS2812B_SPI_init_lut(geom);
+  spi_leds_num   = geom->leds_num;
+  spi_bytes      = spi_leds_num * spi_led_bytes + SPI_RESET_BYTES;
+  if (spi_bytes > 0x7FFF) return 0; //   DMA 15- 
+  spi_frame_done = frame_done;
+
+  spi_front = (uint8_t *)_mem_alloc_system_zero(spi_bytes);
+  spi_back  = (uint8_t *)_mem_alloc_system_zero(spi_bytes);
+  if ((spi_front == 0) || (spi_back == 0)) return 0;
+  for (n = 0; n < spi_leds_num; n++)
+  {
+    //     
+    WS2812B_SPI_encode_rgb(&spi_front[n * spi_led_bytes], 0);
+    WS2812B_SPI_encode_rgb(&spi_back[n * spi_led_bytes], 0);
+  }
+
+  SPI_master_init(WS2812B_SPI, SPI_8_BITS, 0, 0, SPI_BAUD_3_3MHZ, 0);
+
+  //    SPI   ,     
+  SPI->MCR |= LSHIFT(1, 0); // HALT
+  SPI->CTAR[0] &= ~(0
+    + LSHIFT(3,   22) // PCSSCK
+    + LSHIFT(3,   20) // PASC
+    + LSHIFT(3,   18) // PDT
+    + LSHIFT(0xF, 12) // CSSCK
+    + LSHIFT(0xF, 8)  // ASC
+    + LSHIFT(0xF, 4)  // DT
+  );
+  //    ,   
+  SPI->RSER &= ~(0
+    + LSHIFT(1,   19) // RFOF_RE
+    + LSHIFT(1,   17) // RFDF_RE
+    + LSHIFT(1,   16) // RFDF_DIRS
+  );
+  //   DMA  PUSHR     ,     PCS   
+  SPI->PUSHR = LSHIFT(1, 31); // CONT
+  SPI->MCR &= ~LSHIFT(1, 0);
+
+  PORT->PCR[WS2812B_SPI_SOUT_PIN] = LSHIFT(WS2812B_SPI_SOUT_MUX, 8) | LSHIFT(1, 6); // MUX, DSE
+
+  tx_cfg.ch        = DMA_WS2812B_SPI_CH;
+  tx_cfg.databuf   = 0;
+  tx_cfg.datasz    = 0;
+  tx_cfg.spi_pushr = (uint32_t)&SPI->PUSHR;
+  tx_cfg.DMAMUX    = DMA_WS2812B_DMUX_PTR;
+  tx_cfg.dmux_src  = DMA_WS2812B_SPI_DMUX_SRC;
+  Config_DMA_for_SPI_TX(&tx_cfg, &spi_dma_cbl);
+  DMA_BASE_PTR->TCD[DMA_WS2812B_SPI_CH].CSR |= LSHIFT(1, 1); // INTMAJOR |     
+
+  Install_and_enable_isr(DMA_WS2812B_SPI_INT_NUM, WS2812B_DMA_ISR_PRIO, WS2812B_SPI_DMA_isr);
+  return spi_leds_num;
+}
+
+//    DSPI.    SPI      
+static const T_WS2812B_wave spi_wave =
+{
+  WS2812B_SPI_NS(1),                      //  1000
+  WS2812B_SPI_NS(3),                      //  1110
+  WS2812B_SPI_NS(WS2812B_SPI_SYM_BITS),
+  WS2812B_SPI_NS(SPI_RESET_BYTES * 8),
+  WS2812B_SPI_GAP_NS,
+};
+
+//     DSPI
+const T_WS2812B_backend ws2812b_spi_backend =
+{
+  "SPI",
+  &spi_wave,
+  WS2812B_SPI_init,
+  WS2812B_SPI_prepare,
+  WS2812B_SPI_swap,
+  WS2812B_SPI_start,
+  WS2812B_SPI_decode,
+};
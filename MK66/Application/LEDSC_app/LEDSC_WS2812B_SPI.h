@@ -0,0 +1,19 @@
+#ifndef LEDSC_WS2812B_SPI_H
+#define LEDSC_WS2812B_SPI_H
+
+#define  WS2812B_SPI_SYM_BITS       4   //   SPI    
+#define  WS2812B_SPI_SYM_0          0x8 //   0: 1000
+#define  WS2812B_SPI_SYM_1          0xE //   1: 1110
+#define  WS2812B_SPI_SCK_KHZ        3333 //  SCK,  SPI_BAUD_3_3MHZ
+#define  WS2812B_SPI_NS(bits)       ((bits) * 1000000 / WS2812B_SPI_SCK_KHZ) //    SPI  
+#define  WS2812B_SPI_GAP_NS         33  //    SPI: tDT = PDT 1 * DT 2   60 
+#define  WS2812B_SPI_GAP_BITS       2   //       ,  SPI -  
+#define  WS2812B_SPI_BYTES_PER_COLR (8 * WS2812B_SPI_SYM_BITS / 8) //      
+#define  WS2812B_SPI_BYTES_PER_LED_MAX (WS2812B_COLRS_MAX * WS2812B_SPI_BYTES_PER_COLR) //      
+
+void     WS2812B_SPI_init_lut(const T_WS2812B_geometry *geom);
+void     WS2812B_SPI_encode_rgb(uint8_t *dst, uint32_t rgb);
+
+extern const T_WS2812B_backend ws2812b_spi_backend;
+
+#endif // LEDSC_WS2812B_SPI_H
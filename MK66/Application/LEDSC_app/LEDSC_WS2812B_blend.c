@@ -0,0 +1,133 @@
+//       RGB  SIMD Cortex-M4    
+#include   <stdint.h>
+#include   "LEDSC_WS2812B_blend.h"
+
+#define  BLD_ADD(d, s)   WS2812B_QADD8(d, s)          //    
+
+#if defined(__ICCARM__) && defined(__ARM_MEDIA__)
+  #include <intrinsics.h>
+  #define  BLD_MAX(d, s)   ((d) + __UQSUB8(s, d))      //   d    s,    
+  #define  BLD_HALF(d, s)  __UHADD8(d, s)              //  ,  128
+#else
+  #define  BLD_MAX(d, s)   Bld_max(d, s)
+  #define  BLD_HALF(d, s)  (((((d) ^ (s)) & 0xFEFEFEFE) >> 1) + ((d) & (s)))
+
+/*-----------------------------------------------------------------------------------------------------
+    
+-----------------------------------------------------------------------------------------------------*/
+static inline uint32_t Bld_max(uint32_t d, uint32_t s)
+{
+  uint32_t k;
+  uint32_t m = 0;
+
+  for (k = 0; k < 32; k += 8)
+  {
+    if (((s >> k) & 0xFF) > ((d >> k) & 0xFF)) m |= 0xFFu << k;
+  }
+  return (d & ~m) | (s & m);
+}
+#endif
+
+/*-----------------------------------------------------------------------------------------------------
+   s  d   a 0..256: (s * a + d * (256 - a)) / 256   .
+   0, 2  1, 3    16-   ,     4 
+-----------------------------------------------------------------------------------------------------*/
+static inline uint32_t Bld_lerp(uint32_t d, uint32_t s, uint32_t a)
+{
+  uint32_t b = WS2812B_ALPHA_MAX - a;
+  uint32_t rb;
+  uint32_t ag;
+
+  rb = (((s & 0x00FF00FF) * a + (d & 0x00FF00FF) * b) >> 8) & 0x00FF00FF;
+  ag = (((s >> 8) & 0x00FF00FF) * a + ((d >> 8) & 0x00FF00FF) * b) & 0xFF00FF00;
+  return rb | ag;
+}
+
+/*-----------------------------------------------------------------------------------------------------
+        255  
+-----------------------------------------------------------------------------------------------------*/
+static inline uint32_t Bld_mul(uint32_t d, uint32_t s)
+{
+  uint32_t k;
+  uint32_t t;
+  uint32_t res = 0;
+
+  for (k = 0; k < 32; k += 8)
+  {
+    t = ((d >> k) & 0xFF) * ((s >> k) & 0xFF) + 128;
+    res |= ((t + (t >> 8)) >> 8) << k;
+  }
+  return res;
+}
+
+//    .     d  s
+#define  BLD_LOOP(expr) \
+  for (i = 0; i < n; i++) \
+  { \
+    d = dst[i]; \
+    s = src[i]; \
+    dst[i] = (expr); \
+  }
+
+//       
+#define  BLD_MODE(op) \
+  if (alpha == WS2812B_ALPHA_MAX) { BLD_LOOP(op) } \
+  else { BLD_LOOP(Bld_lerp(d, op, alpha)) }
+
+/*-----------------------------------------------------------------------------------------------------
+    src   dst
+
+  dst   -    RGB,     
+  src   -     RGB
+  n     -  
+  mode  -   WS2812B_BLEND_...
+  alpha -   0..WS2812B_ALPHA_MAX
+-----------------------------------------------------------------------------------------------------*/
+void WS2812B_blend(uint32_t *dst, const uint32_t *src, uint32_t n, uint32_t mode, uint32_t alpha)
+{
+  uint32_t i;
+  uint32_t d;
+  uint32_t s;
+
+  if (alpha == 0) return;
+  if (alpha > WS2812B_ALPHA_MAX) alpha = WS2812B_ALPHA_MAX;
+
+  switch (mode)
+  {
+  case WS2812B_BLEND_ALPHA:
+    if (alpha == WS2812B_ALPHA_MAX) { BLD_LOOP(s) }
+    else if (alpha == WS2812B_ALPHA_MAX / 2) { BLD_LOOP(BLD_HALF(d, s)) }
+    else { BLD_LOOP(Bld_lerp(d, s, alpha)) }
+    break;
+  case WS2812B_BLEND_ADD:
+    BLD_MODE(BLD_ADD(d, s))
+    break;
+  case WS2812B_BLEND_MAX:
+    BLD_MODE(BLD_MAX(d, s))
+    break;
+  case WS2812B_BLEND_MUL:
+    BLD_MODE(Bld_mul(d, s))
+    break;
+  default:
+    break;
+  }
+}
+
+/*-----------------------------------------------------------------------------------------------------
+        dst.   
+
+  dst    -     RGB,     
+  layers - ,   
+  num    -  
+  n      -  
+-----------------------------------------------------------------------------------------------------*/
+void WS2812B_compose(uint32_t *dst, const T_WS2812B_layer *layers, uint32_t num, uint32_t n)
+{
+  uint32_t i;
+
+  for (i = 0; i < num; i++)
+  {
+    if (layers[i].pix == 0) continue;
+    WS2812B_blend(dst, layers[i].pix, n, layers[i].mode, layers[i].alpha);
+  }
+}
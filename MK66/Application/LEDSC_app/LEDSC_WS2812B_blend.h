@@ -0,0 +1,50 @@
+#ifndef LEDSC_WS2812B_BLEND_H
+#define LEDSC_WS2812B_BLEND_H
+
+#include   <stdint.h>
+
+#define  WS2812B_LAYERS_MAX    4   //       
+#define  WS2812B_ALPHA_MAX     256 //   
+
+//   .         
+#define  WS2812B_BLEND_ALPHA   0 //   
+#define  WS2812B_BLEND_ADD     1 //   
+#define  WS2812B_BLEND_MAX     2 //    
+#define  WS2812B_BLEND_MUL     3 // .   255    , 0 - 
+#define  WS2812B_BLEND_NUM     4
+
+//  
+typedef struct
+{
+  const uint32_t *pix;   //     RGB,     . 0 -  
+  uint32_t        mode;  //   WS2812B_BLEND_...
+  uint32_t        alpha; //   0..WS2812B_ALPHA_MAX
+} T_WS2812B_layer;
+
+//    RGB  .       
+#if defined(__ICCARM__) && defined(__ARM_MEDIA__)
+  #include <intrinsics.h>
+  #define  WS2812B_QADD8(d, s)  __UQADD8(d, s)
+#else
+  #define  WS2812B_QADD8(d, s)  WS2812B_qadd8(d, s)
+
+/*-----------------------------------------------------------------------------------------------------
+      .
+    7-       7,         
+-----------------------------------------------------------------------------------------------------*/
+static inline uint32_t WS2812B_qadd8(uint32_t d, uint32_t s)
+{
+  uint32_t t;
+  uint32_t c;
+
+  t = (d & 0x7F7F7F7F) + (s & 0x7F7F7F7F);
+  c = ((d & s) | ((d | s) & t)) & 0x80808080; //  
+  t = t ^ ((d ^ s) & 0x80808080);
+  return t | ((c >> 7) * 0xFF);
+}
+#endif
+
+void WS2812B_blend(uint32_t *dst, const uint32_t *src, uint32_t n, uint32_t mode, uint32_t alpha);
+void WS2812B_compose(uint32_t *dst, const T_WS2812B_layer *layers, uint32_t num, uint32_t n);
+
+#endif // LEDSC_WS2812B_BLEND_H
@@ -0,0 +1,330 @@
+//   (,  , , )      xorshift32
+#include   <stdint.h>
+#include   "LEDSC_WS2812B_hsv.h"
+#include   "LEDSC_WS2812B_vm.h"
+#include   "LEDSC_WS2812B_fx.h"
+#include   "LEDSC_WS2812B_noise.h"
+
+#define  FX_HUE_DEG(h8)      (((h8) * 360 + 128) >> 8) //      
+#define  FX_FIRE_STEP        4096 //      .   255    16 
+#define  FX_FIRE_STEPS_MAX   4    //       
+#define  FX_FIRE_SPARK_ZONE  7    //         
+#define  FX_NOISE_CHUNK      32   //      .    
+
+//  xorshift32.     
+#define  FX_RND(s)  ((s) ^= (s) << 13, (s) ^= (s) >> 17, (s) ^= (s) << 5)
+
+/*-----------------------------------------------------------------------------------------------------
+      xorshift32.
+   2^32 - 1,    
+-----------------------------------------------------------------------------------------------------*/
+uint32_t WS2812B_fx_rand(uint32_t *state)
+{
+  uint32_t s = *state;
+
+  if (s == 0) s = 0x2545F491;
+  FX_RND(s);
+  *state = s;
+  return s;
+}
+
+/*-----------------------------------------------------------------------------------------------------
+    RGB  v 0..255     
+-----------------------------------------------------------------------------------------------------*/
+static uint32_t WS2812B_fx_scale(uint32_t rgb, uint32_t v)
+{
+  v++;
+  return ((((rgb & 0x00FF00FF) * v) >> 8) & 0x00FF00FF) | ((((rgb & 0x0000FF00) * v) >> 8) & 0x0000FF00);
+}
+
+/*-----------------------------------------------------------------------------------------------------
+    :  -  -  - 
+-----------------------------------------------------------------------------------------------------*/
+static uint32_t WS2812B_fx_heat_color(uint32_t heat)
+{
+  uint32_t t = (heat * 191) / 255;
+  uint32_t ramp = (t & 0x3F) << 2;
+
+  if (t & 0x80) return 0xFFFF00 | ramp;
+  if (t & 0x40) return 0xFF0000 | (ramp << 8);
+  return ramp << 16;
+}
+
+/*-----------------------------------------------------------------------------------------------------
+   
+
+  fx   -  
+  p    -  
+  heat -     n ,  
+  n    -  
+  ms   -    
+-----------------------------------------------------------------------------------------------------*/
+void WS2812B_fx_init(T_WS2812B_fx *fx, const T_WS2812B_fx_params *p, uint8_t *heat, uint32_t n, uint32_t ms)
+{
+  uint32_t i;
+  uint32_t rgb;
+
+  fx->p       = *p;
+  fx->heat    = heat;
+  fx->last_ms = ms;
+  fx->acc     = 0;
+  if (fx->rnd == 0) fx->rnd = 0x2545F491;
+  for (i = 0; (heat != 0) && (i < n); i++)
+  {
+    heat[i] = 0;
+  }
+
+  switch (p->id)
+  {
+  case WS2812B_FX_RAINBOW:
+    for (i = 0; i < 256; i++)
+    {
+      fx->lut[i] = WS2812B_hsv_to_rgb(FX_HUE_DEG(i), p->sat, p->val);
+    }
+    break;
+  case WS2812B_FX_FIRE:
+    for (i = 0; i < 256; i++)
+    {
+      fx->lut[i] = WS2812B_fx_scale(WS2812B_fx_heat_color(i), p->val);
+    }
+    break;
+  case WS2812B_FX_SCRIPT:
+    break;
+  case WS2812B_FX_NOISE:
+    //       density  ,      
+    for (i = 0; i < 256; i++)
+    {
+      rgb = WS2812B_hsv_to_rgb(FX_HUE_DEG((p->hue + ((i * p->density) >> 8)) & 0xFF), p->sat, 255);
+      fx->lut[i] = WS2812B_fx_scale(rgb, (p->val * (64 + ((i * 3) >> 2))) >> 8);
+    }
+    break;
+  default:
+    //     .        
+    rgb = WS2812B_hsv_to_rgb(FX_HUE_DEG(p->hue), p->sat, p->val);
+    for (i = 0; i < 256; i++)
+    {
+      fx->lut[i] = WS2812B_fx_scale(rgb, (i * i) >> 8);
+    }
+    break;
+  }
+}
+
+/*-----------------------------------------------------------------------------------------------------
+   .         width     .
+      Q8  
+-----------------------------------------------------------------------------------------------------*/
+static void WS2812B_fx_rainbow(T_WS2812B_fx *fx, uint32_t *dst, uint32_t n, uint32_t ms)
+{
+  uint32_t i;
+  uint32_t h;
+  uint32_t step = 0;
+
+  if (fx->p.width != 0) step = 0x10000 / fx->p.width;
+  h = (fx->p.hue << 8) + ms * fx->p.speed;
+  for (i = 0; i < n; i++)
+  {
+    dst[i] = fx->lut[(h >> 8) & 0xFF];
+    h -= step; //       
+  }
+}
+
+/*-----------------------------------------------------------------------------------------------------
+      width .      .
+      Q8       
+-----------------------------------------------------------------------------------------------------*/
+static void WS2812B_fx_chase(T_WS2812B_fx *fx, uint32_t *dst, uint32_t n, uint32_t ms)
+{
+  uint32_t i;
+  int32_t  d;
+  int32_t  per;
+  uint32_t k;
+
+  per = fx->p.width;
+  if (per < 2) per = 2;
+  per <<= 8;
+  k = (255u << 16) / (uint32_t)per;
+  d = (int32_t)(((ms * fx->p.speed) >> 2) % (uint32_t)per); //     0
+  for (i = 0; i < n; i++)
+  {
+    dst[i] = fx->lut[255 - (((uint32_t)d * k) >> 16)];
+    d -= 256;
+    d += per & (d >> 31);
+  }
+}
+
+/*-----------------------------------------------------------------------------------------------------
+        len : ,      
+-----------------------------------------------------------------------------------------------------*/
+static void WS2812B_fx_fire_step(T_WS2812B_fx *fx, uint8_t *heat, uint32_t len)
+{
+  uint32_t i;
+  uint32_t cool;
+  uint32_t r;
+  int32_t  h;
+
+  cool = ((uint32_t)fx->p.sat * 10) / len + 2;
+  for (i = 0; i < len; i++)
+  {
+    FX_RND(fx->rnd);
+    h = (int32_t)heat[i] - (int32_t)(((fx->rnd & 0xFF) * cool) >> 8);
+    heat[i] = (uint8_t)(h & ~(h >> 31));
+  }
+  for (i = len - 1; i >= 2; i--)
+  {
+    heat[i] = (uint8_t)(((heat[i - 1] + 2 * heat[i - 2]) * 85) >> 8);
+  }
+  r = FX_RND(fx->rnd);
+  if ((r & 0xFF) < fx->p.density)
+  {
+    i = (((r >> 8) & 0xFF) * (len < FX_FIRE_SPARK_ZONE ? len : FX_FIRE_SPARK_ZONE)) >> 8;
+    h = heat[i] + 160 + (((r >> 16) & 0xFF) * 95 >> 8);
+    heat[i] = (h > 255) ? 255 : h;
+  }
+}
+
+/*-----------------------------------------------------------------------------------------------------
+  .      width    ,    .
+        ,      
+-----------------------------------------------------------------------------------------------------*/
+static void WS2812B_fx_fire(T_WS2812B_fx *fx, uint32_t *dst, uint32_t n, uint32_t ms)
+{
+  uint32_t i;
+  uint32_t len;
+  uint32_t steps = 0;
+
+  if (fx->heat == 0) return;
+  fx->acc += (ms - fx->last_ms) * fx->p.speed;
+  while ((fx->acc >= FX_FIRE_STEP) && (steps < FX_FIRE_STEPS_MAX))
+  {
+    fx->acc -= FX_FIRE_STEP;
+    steps++;
+    for (i = 0; i < n; i += len)
+    {
+      len = fx->p.width;
+      if ((len == 0) || (len > n - i)) len = n - i;
+      if (len >= 3) WS2812B_fx_fire_step(fx, fx->heat + i, len);
+    }
+  }
+  if (fx->acc >= FX_FIRE_STEP) fx->acc = 0; //    
+
+  for (i = 0; i < n; i++)
+  {
+    dst[i] = fx->lut[fx->heat[i]];
+  }
+}
+
+/*-----------------------------------------------------------------------------------------------------
+  .  : ,           ,
+   -   
+-----------------------------------------------------------------------------------------------------*/
+static void WS2812B_fx_twinkle(T_WS2812B_fx *fx, uint32_t *dst, uint32_t n, uint32_t ms)
+{
+  uint32_t i;
+  uint32_t h;
+  uint32_t b;
+  uint32_t t;
+  uint32_t on;
+
+  t = ms * fx->p.speed;
+  for (i = 0; i < n; i++)
+  {
+    h  = (i + 1) * 0x9E3779B1u;
+    h ^= h >> 15;
+    h *= 0x2C1B3C6Du;
+    h ^= h >> 12;
+    on = (uint32_t)((int32_t)((h & 0xFF) - fx->p.density) >> 31); //     
+    b  = ((((t * (4 + (h >> 30))) >> 2) + (h >> 8)) >> 7) & 0x1FF; //  0..511   1..1.75  
+    b  = (b ^ (0u - (b >> 8))) & 0xFF;                             //   0..255..0
+    dst[i] = fx->lut[b] & on;
+  }
+}
+
+/*-----------------------------------------------------------------------------------------------------
+    .          ,
+       
+-----------------------------------------------------------------------------------------------------*/
+static void WS2812B_fx_script(T_WS2812B_fx *fx, uint32_t *dst, uint32_t n, uint32_t ms)
+{
+  int32_t  params[WS2812B_VM_PARAMS];
+
+  if (fx->prog == 0)
+  {
+    fx->vm_frame.len = 0;
+  }
+  else
+  {
+    params[0] = fx->p.speed;
+    params[1] = fx->p.hue;
+    params[2] = fx->p.sat;
+    params[3] = fx->p.val;
+    params[4] = fx->p.density;
+    params[5] = fx->p.width;
+    WS2812B_vm_specialize(fx->prog, &fx->vm_frame, ms, params);
+  }
+  WS2812B_vm_run(&fx->vm_frame, dst, n);
+}
+
+/*-----------------------------------------------------------------------------------------------------
+   .  -   2D,    - ,    
+      .     FX_NOISE_CHUNK .
+        2^32,    ,   
+-----------------------------------------------------------------------------------------------------*/
+static void WS2812B_fx_noise(T_WS2812B_fx *fx, uint32_t *dst, uint32_t n, uint32_t ms)
+{
+  int16_t  row[FX_NOISE_CHUNK];
+  uint32_t i;
+  uint32_t k;
+  uint32_t len;
+  uint32_t x;
+  uint32_t dx;
+  uint32_t t;
+
+  dx = 0x10000 / ((fx->p.width != 0) ? fx->p.width : 1); //     width 
+  t  = ms * fx->p.speed;
+  x  = t >> 2;
+  for (i = 0; i < n; i += len)
+  {
+    len = n - i;
+    if (len > FX_NOISE_CHUNK) len = FX_NOISE_CHUNK;
+    WS2812B_noise2_row(row, len, x, dx, t);
+    for (k = 0; k < len; k++)
+    {
+      dst[i + k] = fx->lut[WS2812B_NOISE_U8(row[k])];
+    }
+    x += len * dx;
+  }
+}
+
+/*-----------------------------------------------------------------------------------------------------
+   
+
+  dst -    RGB  n 
+  ms  -    
+-----------------------------------------------------------------------------------------------------*/
+void WS2812B_fx_render(T_WS2812B_fx *fx, uint32_t *dst, uint32_t n, uint32_t ms)
+{
+  switch (fx->p.id)
+  {
+  case WS2812B_FX_RAINBOW:
+    WS2812B_fx_rainbow(fx, dst, n, ms);
+    break;
+  case WS2812B_FX_CHASE:
+    WS2812B_fx_chase(fx, dst, n, ms);
+    break;
+  case WS2812B_FX_FIRE:
+    WS2812B_fx_fire(fx, dst, n, ms);
+    break;
+  case WS2812B_FX_TWINKLE:
+    WS2812B_fx_twinkle(fx, dst, n, ms);
+    break;
+  case WS2812B_FX_SCRIPT:
+    WS2812B_fx_script(fx, dst, n, ms);
+    break;
+  case WS2812B_FX_NOISE:
+    WS2812B_fx_noise(fx, dst, n, ms);
+    break;
+  default:
+    break;
+  }
+  fx->last_ms = ms;
+}
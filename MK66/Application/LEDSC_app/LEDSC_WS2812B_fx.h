@@ -0,0 +1,54 @@
+#ifndef LEDSC_WS2812B_FX_H
+#define LEDSC_WS2812B_FX_H
+
+//  .     ,     
+#define  WS2812B_FX_NONE      0 //  ,    
+#define  WS2812B_FX_RAINBOW   1 //  
+#define  WS2812B_FX_CHASE     2 //     
+#define  WS2812B_FX_FIRE      3 // 
+#define  WS2812B_FX_TWINKLE   4 // 
+#define  WS2812B_FX_SCRIPT    5 //   , . LEDSC_WS2812B_vm.h
+#define  WS2812B_FX_NOISE     6 //     : , , 
+#define  WS2812B_FX_NUM       7
+
+/*
+   .        CMD_EFFECT     ,
+  width -   .
+
+     speed                      hue            sat         val      density              width
+  RAINBOW            .        -                       , 0 -  
+  CHASE                       .        -                      ,  
+  FIRE                 -                               
+  TWINKLE                     .                -
+  SCRIPT        PARAM   speed, hue, sat, val, density, width
+  NOISE                    .                  
+*/
+typedef struct
+{
+  uint8_t   id;      //  WS2812B_FX_...
+  uint8_t   speed;
+  uint8_t   hue;     // ,     
+  uint8_t   sat;
+  uint8_t   val;
+  uint8_t   density;
+  uint16_t  width;
+} T_WS2812B_fx_params;
+
+//  
+typedef struct
+{
+  T_WS2812B_fx_params p;
+  uint32_t  rnd;       //     
+  uint32_t  last_ms;   //   
+  uint32_t  acc;       //      
+  uint8_t  *heat;      //  ,    
+  uint32_t  lut[256];  //     RGB:    ,      
+  const T_WS2812B_vm_prog *prog;  //   WS2812B_FX_SCRIPT, 0 -  
+  T_WS2812B_vm_prog  vm_frame;    //        
+} T_WS2812B_fx;
+
+uint32_t WS2812B_fx_rand(uint32_t *state);
+void     WS2812B_fx_init(T_WS2812B_fx *fx, const T_WS2812B_fx_params *p, uint8_t *heat, uint32_t n, uint32_t ms);
+void     WS2812B_fx_render(T_WS2812B_fx *fx, uint32_t *dst, uint32_t n, uint32_t ms);
+
+#endif // LEDSC_WS2812B_FX_H
@@ -0,0 +1,120 @@
+//  HSV -> RGB       ,      Convert_H_S_V_to_RGB
+#include   <stdint.h>
+#include   "LEDSC_WS2812B_hsv.h"
+
+#define  HSV_DIV60(x)   (((x) * 34953u) >> 21) //    60  x < 74898
+
+//   255 - dim_curve[255 - sat].       ,
+//        
+static const uint8_t hsv_sat_curve[256] = {
+  0, 7, 13, 17, 21, 25, 29, 33, 37, 41, 44, 48, 52, 55, 59, 62,
+  65, 69, 72, 75, 78, 81, 84, 87, 90, 93, 96, 98, 101, 104, 106, 109,
+  111, 114, 116, 119, 121, 123, 126, 128, 130, 132, 134, 137, 139, 141, 143, 145,
+  146, 148, 150, 152, 154, 156, 157, 159, 161, 162, 164, 165, 167, 169, 170, 172,
+  173, 174, 176, 177, 179, 180, 181, 182, 184, 185, 186, 187, 189, 190, 191, 192,
+  193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207, 207,
+  208, 209, 210, 211, 212, 212, 213, 214, 215, 215, 216, 217, 217, 218, 219, 219,
+  220, 220, 221, 222, 222, 223, 223, 224, 225, 225, 226, 226, 227, 227, 228, 228,
+  229, 229, 230, 230, 230, 231, 231, 232, 232, 233, 233, 233, 234, 234, 235, 235,
+  235, 236, 236, 236, 237, 237, 237, 238, 238, 238, 239, 239, 239, 239, 240, 240,
+  240, 241, 241, 241, 241, 242, 242, 242, 242, 243, 243, 243, 243, 243, 244, 244,
+  244, 244, 244, 245, 245, 245, 245, 245, 246, 246, 246, 246, 246, 246, 247, 247,
+  247, 247, 247, 247, 248, 248, 248, 248, 248, 248, 248, 249, 249, 249, 249, 249,
+  249, 249, 249, 250, 250, 250, 250, 250, 250, 250, 250, 250, 250, 251, 251, 251,
+  251, 251, 251, 251, 251, 251, 251, 251, 251, 252, 252, 252, 252, 252, 252, 252,
+  252, 252, 252, 252, 252, 252, 252, 253, 253, 253, 253, 253, 253, 254, 254, 255,
+};
+
+//  val,    base   RGB   .
+//        ,   
+typedef struct
+{
+  uint8_t   val;
+  uint8_t   trn;
+  uint8_t   base;
+} T_hsv_sector;
+
+static const T_hsv_sector hsv_sectors[6] =
+{
+  { 16, 8,  0  }, // 0..59    R = val,  G ,  B = base
+  { 8,  16, 0  }, // 60..119  G = val,  R , B = base
+  { 8,  0,  16 }, // 120..179 G = val,  B ,  R = base
+  { 0,  8,  16 }, // 180..239 B = val,  G , R = base
+  { 0,  16, 8  }, // 240..299 B = val,  R ,  G = base
+  { 16, 0,  8  }, // 300..359 R = val,  B , G = base
+};
+
+#ifdef WS2812B_HSV_HUE_TABLE
+//          0..60       0..359.
+//        ,     
+static const uint16_t hsv_hue_tab[360] = {
+  0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B,
+  0x000C, 0x000D, 0x000E, 0x000F, 0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017,
+  0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F, 0x0020, 0x0021, 0x0022, 0x0023,
+  0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F,
+  0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B,
+  0x013C, 0x013B, 0x013A, 0x0139, 0x0138, 0x0137, 0x0136, 0x0135, 0x0134, 0x0133, 0x0132, 0x0131,
+  0x0130, 0x012F, 0x012E, 0x012D, 0x012C, 0x012B, 0x012A, 0x0129, 0x0128, 0x0127, 0x0126, 0x0125,
+  0x0124, 0x0123, 0x0122, 0x0121, 0x0120, 0x011F, 0x011E, 0x011D, 0x011C, 0x011B, 0x011A, 0x0119,
+  0x0118, 0x0117, 0x0116, 0x0115, 0x0114, 0x0113, 0x0112, 0x0111, 0x0110, 0x010F, 0x010E, 0x010D,
+  0x010C, 0x010B, 0x010A, 0x0109, 0x0108, 0x0107, 0x0106, 0x0105, 0x0104, 0x0103, 0x0102, 0x0101,
+  0x0200, 0x0201, 0x0202, 0x0203, 0x0204, 0x0205, 0x0206, 0x0207, 0x0208, 0x0209, 0x020A, 0x020B,
+  0x020C, 0x020D, 0x020E, 0x020F, 0x0210, 0x0211, 0x0212, 0x0213, 0x0214, 0x0215, 0x0216, 0x0217,
+  0x0218, 0x0219, 0x021A, 0x021B, 0x021C, 0x021D, 0x021E, 0x021F, 0x0220, 0x0221, 0x0222, 0x0223,
+  0x0224, 0x0225, 0x0226, 0x0227, 0x0228, 0x0229, 0x022A, 0x022B, 0x022C, 0x022D, 0x022E, 0x022F,
+  0x0230, 0x0231, 0x0232, 0x0233, 0x0234, 0x0235, 0x0236, 0x0237, 0x0238, 0x0239, 0x023A, 0x023B,
+  0x033C, 0x033B, 0x033A, 0x0339, 0x0338, 0x0337, 0x0336, 0x0335, 0x0334, 0x0333, 0x0332, 0x0331,
+  0x0330, 0x032F, 0x032E, 0x032D, 0x032C, 0x032B, 0x032A, 0x0329, 0x0328, 0x0327, 0x0326, 0x0325,
+  0x0324, 0x0323, 0x0322, 0x0321, 0x0320, 0x031F, 0x031E, 0x031D, 0x031C, 0x031B, 0x031A, 0x0319,
+  0x0318, 0x0317, 0x0316, 0x0315, 0x0314, 0x0313, 0x0312, 0x0311, 0x0310, 0x030F, 0x030E, 0x030D,
+  0x030C, 0x030B, 0x030A, 0x0309, 0x0308, 0x0307, 0x0306, 0x0305, 0x0304, 0x0303, 0x0302, 0x0301,
+  0x0400, 0x0401, 0x0402, 0x0403, 0x0404, 0x0405, 0x0406, 0x0407, 0x0408, 0x0409, 0x040A, 0x040B,
+  0x040C, 0x040D, 0x040E, 0x040F, 0x0410, 0x0411, 0x0412, 0x0413, 0x0414, 0x0415, 0x0416, 0x0417,
+  0x0418, 0x0419, 0x041A, 0x041B, 0x041C, 0x041D, 0x041E, 0x041F, 0x0420, 0x0421, 0x0422, 0x0423,
+  0x0424, 0x0425, 0x0426, 0x0427, 0x0428, 0x0429, 0x042A, 0x042B, 0x042C, 0x042D, 0x042E, 0x042F,
+  0x0430, 0x0431, 0x0432, 0x0433, 0x0434, 0x0435, 0x0436, 0x0437, 0x0438, 0x0439, 0x043A, 0x043B,
+  0x053C, 0x053B, 0x053A, 0x0539, 0x0538, 0x0537, 0x0536, 0x0535, 0x0534, 0x0533, 0x0532, 0x0531,
+  0x0530, 0x052F, 0x052E, 0x052D, 0x052C, 0x052B, 0x052A, 0x0529, 0x0528, 0x0527, 0x0526, 0x0525,
+  0x0524, 0x0523, 0x0522, 0x0521, 0x0520, 0x051F, 0x051E, 0x051D, 0x051C, 0x051B, 0x051A, 0x0519,
+  0x0518, 0x0517, 0x0516, 0x0515, 0x0514, 0x0513, 0x0512, 0x0511, 0x0510, 0x050F, 0x050E, 0x050D,
+  0x050C, 0x050B, 0x050A, 0x0509, 0x0508, 0x0507, 0x0506, 0x0505, 0x0504, 0x0503, 0x0502, 0x0501,
+};
+#endif
+
+/*-----------------------------------------------------------------------------------------------------
+   HSV -> RGB
+
+  hue -   , 360  0.     0..359
+  sat -  0..255,     
+  val -  0..255, -     
+
+      RGB (00000000 RRRRRRRR GGGGGGGG BBBBBBBB)
+-----------------------------------------------------------------------------------------------------*/
+uint32_t WS2812B_hsv_to_rgb(uint32_t hue, uint32_t sat, uint32_t val)
+{
+  uint32_t            base;
+  uint32_t            trn;
+  uint32_t            s;
+  uint32_t            f;
+  const T_hsv_sector *p;
+
+  sat = hsv_sat_curve[sat];
+  if (sat == 0) return val * 0x010101; //  ,   
+
+  base = ((255 - sat) * val) >> 8;
+
+  if (hue >= 360) hue %= 360; // 9-    HSV   511
+
+#ifdef WS2812B_HSV_HUE_TABLE
+  s = hsv_hue_tab[hue] >> 8;
+  f = hsv_hue_tab[hue] & 0xFF;
+#else
+  s = (hue * 1093) >> 16; //    60    1488
+  f = hue - s * 60;
+  if (s & 1) f = 60 - f;
+#endif
+
+  trn = HSV_DIV60((val - base) * f) + base;
+  p   = &hsv_sectors[s];
+  return (val << p->val) | (trn << p->trn) | (base << p->base);
+}
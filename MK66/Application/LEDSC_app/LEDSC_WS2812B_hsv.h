@@ -0,0 +1,9 @@
+#ifndef LEDSC_WS2812B_HSV_H
+#define LEDSC_WS2812B_HSV_H
+
+#define  WS2812B_HSV_HUE_TABLE  //             360   flash
+                                //       60
+
+uint32_t WS2812B_hsv_to_rgb(uint32_t hue, uint32_t sat, uint32_t val);
+
+#endif // LEDSC_WS2812B_HSV_H
@@ -0,0 +1,310 @@
+//    1D/2D/3D         
+#include   <stdint.h>
+#include   "LEDSC_WS2812B_noise.h"
+
+#define  NOISE_FRAC_BITS   13                       //       
+#define  NOISE_FRAC_ONE    (1 << NOISE_FRAC_BITS)
+#define  NOISE_G_ONE       16384                    //     Q14
+#define  NOISE_FRAC(c)     ((int32_t)(((c) & 0xFFFF) >> (16 - NOISE_FRAC_BITS)))
+#define  NOISE_CELL(c)     (((c) >> 16) & 0xFF)
+
+//  a..b   t 0..32768.  a  b   2^15,     32 
+#define  NOISE_LERP(a, b, t)  ((a) + ((((b) - (a)) * (int32_t)(t)) >> 15))
+
+//       -WS2812B_NOISE_ONE..WS2812B_NOISE_ONE   Q8.
+//       ,   
+#define  NOISE_SCALE1      2048
+#define  NOISE_SCALE2      1024
+#define  NOISE_SCALE3      1024
+
+//  :    x = 0  g0 * x + c0,   x = 1 - g1 * (x - 1) + c1.
+// g   Q14, c  x   Q13.
+//        y, z,         .
+//       ,        
+typedef struct
+{
+  int32_t   g0;
+  int32_t   c0;
+  int32_t   g1;
+  int32_t   c1;
+} T_noise_cell;
+
+//  .    -        256.
+//      
+const uint8_t ws2812b_noise_perm[256] =
+{
+  151, 160, 137,  91,  90,  15, 131,  13, 201,  95,  96,  53, 194, 233,   7, 225,
+  140,  36, 103,  30,  69, 142,   8,  99,  37, 240,  21,  10,  23, 190,   6, 148,
+  247, 120, 234,  75,   0,  26, 197,  62,  94, 252, 219, 203, 117,  35,  11,  32,
+   57, 177,  33,  88, 237, 149,  56,  87, 174,  20, 125, 136, 171, 168,  68, 175,
+   74, 165,  71, 134, 139,  48,  27, 166,  77, 146, 158, 231,  83, 111, 229, 122,
+   60, 211, 133, 230, 220, 105,  92,  41,  55,  46, 245,  40, 244, 102, 143,  54,
+   65,  25,  63, 161,   1, 216,  80,  73, 209,  76, 132, 187, 208,  89,  18, 169,
+  200, 196, 135, 130, 116, 188, 159,  86, 164, 100, 109, 198, 173, 186,   3,  64,
+   52, 217, 226, 250, 124, 123,   5, 202,  38, 147, 118, 126, 255,  82,  85, 212,
+  207, 206,  59, 227,  47,  16,  58,  17, 182, 189,  28,  42, 223, 183, 170, 213,
+  119, 248, 152,   2,  44, 154, 163,  70, 221, 153, 101, 155, 167,  43, 172,   9,
+  129,  22,  39, 253,  19,  98, 108, 110,  79, 113, 224, 232, 178, 185, 112, 104,
+  218, 246,  97, 228, 251,  34, 242, 193, 238, 210, 144,  12, 191, 179, 162, 241,
+   81,  51, 145, 235, 249,  14, 239, 107,  49, 192, 214,  31, 181, 199, 106, 157,
+  184,  84, 204, 176, 115, 121,  50,  45, 127,   4, 150, 254, 138, 236, 205,  93,
+  222, 114,  67,  29,  24,  72, 243, 141, 128, 195,  78,  66, 215,  61, 156, 180
+};
+
+//   6t^5 - 15t^4 + 10t^3  257 ,  Q15.    
+static const uint16_t noise_fade[257] =
+{
+      0,     0,     0,     1,     1,     2,     4,     6,    10,    13,    18,    24,    31,    40,    49,    60,
+     73,    87,   102,   119,   139,   159,   182,   207,   233,   262,   293,   326,   361,   399,   439,   481,
+    526,   573,   623,   675,   730,   787,   847,   910,   975,  1043,  1114,  1188,  1264,  1344,  1426,  1510,
+   1598,  1689,  1782,  1878,  1977,  2080,  2184,  2292,  2403,  2517,  2633,  2752,  2875,  3000,  3128,  3258,
+   3392,  3528,  3668,  3810,  3954,  4102,  4252,  4405,  4561,  4719,  4880,  5043,  5209,  5378,  5549,  5722,
+   5898,  6077,  6258,  6441,  6626,  6814,  7004,  7196,  7391,  7587,  7786,  7986,  8189,  8393,  8600,  8808,
+   9018,  9230,  9443,  9659,  9875, 10094, 10314, 10535, 10758, 10982, 11207, 11434, 11662, 11891, 12121, 12352,
+  12584, 12817, 13051, 13285, 13521, 13757, 13994, 14231, 14469, 14707, 14946, 15185, 15425, 15664, 15904, 16144,
+  16384, 16624, 16864, 17104, 17343, 17583, 17822, 18061, 18299, 18537, 18774, 19011, 19247, 19483, 19717, 19951,
+  20184, 20416, 20647, 20877, 21106, 21334, 21561, 21786, 22010, 22233, 22454, 22674, 22893, 23109, 23325, 23538,
+  23750, 23960, 24168, 24375, 24579, 24782, 24982, 25181, 25377, 25572, 25764, 25954, 26142, 26327, 26510, 26691,
+  26870, 27046, 27219, 27390, 27559, 27725, 27888, 28049, 28207, 28363, 28516, 28666, 28814, 28958, 29100, 29240,
+  29376, 29510, 29640, 29768, 29893, 30016, 30135, 30251, 30365, 30476, 30584, 30688, 30791, 30890, 30986, 31079,
+  31170, 31258, 31342, 31424, 31504, 31580, 31654, 31725, 31793, 31858, 31921, 31981, 32038, 32093, 32145, 32195,
+  32242, 32287, 32329, 32369, 32407, 32442, 32475, 32506, 32535, 32561, 32586, 32609, 32629, 32649, 32666, 32681,
+  32695, 32708, 32719, 32728, 32737, 32744, 32750, 32755, 32758, 32762, 32764, 32766, 32767, 32767, 32768, 32768,
+  32768
+};
+
+//  1D: 4    ,  Q14
+static const int16_t noise_grad1[8] =
+{
+  4096, 8192, 12288, 16384, -4096, -8192, -12288, -16384
+};
+
+//  2D:   
+static const int8_t noise_grad2[8][2] =
+{
+  { 1, 1 }, { -1, 1 }, { 1, -1 }, { -1, -1 }, { 1, 0 }, { -1, 0 }, { 0, 1 }, { 0, -1 }
+};
+
+//  3D:   , 4       4  
+static const int8_t noise_grad3[16][3] =
+{
+  { 1, 1, 0 }, { -1, 1, 0 }, { 1, -1, 0 }, { -1, -1, 0 },
+  { 1, 0, 1 }, { -1, 0, 1 }, { 1, 0, -1 }, { -1, 0, -1 },
+  { 0, 1, 1 }, { 0, -1, 1 }, { 0, 1, -1 }, { 0, -1, -1 },
+  { 1, 1, 0 }, { -1, 1, 0 }, { 0, -1, 1 }, { 0, -1, -1 }
+};
+
+/*-----------------------------------------------------------------------------------------------------
+        c 0..65535.  0..32768
+-----------------------------------------------------------------------------------------------------*/
+static inline uint32_t Noise_fade(uint32_t c)
+{
+  uint32_t i = (c >> 8) & 0xFF;
+  uint32_t a = noise_fade[i];
+
+  return a + (((noise_fade[i + 1] - a) * (c & 0xFF)) >> 8);
+}
+
+/*-----------------------------------------------------------------------------------------------------
+        x     
+-----------------------------------------------------------------------------------------------------*/
+static inline int16_t Noise_eval(const T_noise_cell *cl, uint32_t x, int32_t scale)
+{
+  int32_t  f = NOISE_FRAC(x);
+  int32_t  a;
+  int32_t  b;
+  int32_t  r;
+
+  a = ((cl->g0 * f) >> 14) + cl->c0;
+  b = ((cl->g1 * (f - NOISE_FRAC_ONE)) >> 14) + cl->c1;
+  r = (NOISE_LERP(a, b, Noise_fade(x & 0xFFFF)) * scale) >> 8;
+  if (r > WS2812B_NOISE_ONE) r = WS2812B_NOISE_ONE;
+  if (r < -WS2812B_NOISE_ONE) r = -WS2812B_NOISE_ONE;
+  return (int16_t)r;
+}
+
+/*-----------------------------------------------------------------------------------------------------
+    1D
+-----------------------------------------------------------------------------------------------------*/
+static void Noise1_cell(T_noise_cell *cl, uint32_t xi)
+{
+  cl->g0 = noise_grad1[ws2812b_noise_perm[xi] & 7];
+  cl->g1 = noise_grad1[ws2812b_noise_perm[(xi + 1) & 0xFF] & 7];
+  cl->c0 = 0;
+  cl->c1 = 0;
+}
+
+/*-----------------------------------------------------------------------------------------------------
+    2D   xi  x   y
+-----------------------------------------------------------------------------------------------------*/
+static void Noise2_cell(T_noise_cell *cl, uint32_t xi, uint32_t y)
+{
+  uint32_t  yi = NOISE_CELL(y);
+  int32_t   fy0 = NOISE_FRAC(y);
+  int32_t   fy1 = fy0 - NOISE_FRAC_ONE;
+  uint32_t  v = Noise_fade(y & 0xFFFF);
+  uint32_t  a;
+  uint32_t  b;
+  const int8_t *g00;
+  const int8_t *g01;
+  const int8_t *g10;
+  const int8_t *g11;
+
+  a = ws2812b_noise_perm[xi] + yi;
+  b = ws2812b_noise_perm[(xi + 1) & 0xFF] + yi;
+  g00 = noise_grad2[ws2812b_noise_perm[a & 0xFF] & 7];
+  g01 = noise_grad2[ws2812b_noise_perm[(a + 1) & 0xFF] & 7];
+  g10 = noise_grad2[ws2812b_noise_perm[b & 0xFF] & 7];
+  g11 = noise_grad2[ws2812b_noise_perm[(b + 1) & 0xFF] & 7];
+
+  cl->g0 = NOISE_LERP(g00[0] * NOISE_G_ONE, g01[0] * NOISE_G_ONE, v);
+  cl->c0 = NOISE_LERP(g00[1] * fy0, g01[1] * fy1, v);
+  cl->g1 = NOISE_LERP(g10[0] * NOISE_G_ONE, g11[0] * NOISE_G_ONE, v);
+  cl->c1 = NOISE_LERP(g10[1] * fy0, g11[1] * fy1, v);
+}
+
+/*-----------------------------------------------------------------------------------------------------
+    x  3D     .
+   :  0 - z,  1 - y
+-----------------------------------------------------------------------------------------------------*/
+static void Noise3_face(int32_t *g, int32_t *c, const uint8_t *h, int32_t fy0, int32_t fz0, uint32_t v, uint32_t w)
+{
+  int32_t   fy1 = fy0 - NOISE_FRAC_ONE;
+  int32_t   fz1 = fz0 - NOISE_FRAC_ONE;
+  const int8_t *g00 = noise_grad3[h[0] & 15];
+  const int8_t *g01 = noise_grad3[h[1] & 15];
+  const int8_t *g10 = noise_grad3[h[2] & 15];
+  const int8_t *g11 = noise_grad3[h[3] & 15];
+  int32_t   c0;
+  int32_t   c1;
+  int32_t   s0;
+  int32_t   s1;
+
+  s0 = NOISE_LERP(g00[0] * NOISE_G_ONE, g10[0] * NOISE_G_ONE, v);
+  s1 = NOISE_LERP(g01[0] * NOISE_G_ONE, g11[0] * NOISE_G_ONE, v);
+  *g = NOISE_LERP(s0, s1, w);
+  c0 = NOISE_LERP(g00[1] * fy0 + g00[2] * fz0, g10[1] * fy1 + g10[2] * fz0, v);
+  c1 = NOISE_LERP(g01[1] * fy0 + g01[2] * fz1, g11[1] * fy1 + g11[2] * fz1, v);
+  *c = NOISE_LERP(c0, c1, w);
+}
+
+/*-----------------------------------------------------------------------------------------------------
+    3D   xi  x   y, z
+-----------------------------------------------------------------------------------------------------*/
+static void Noise3_cell(T_noise_cell *cl, uint32_t xi, uint32_t y, uint32_t z)
+{
+  uint32_t  yi = NOISE_CELL(y);
+  uint32_t  zi = NOISE_CELL(z);
+  int32_t   fy = NOISE_FRAC(y);
+  int32_t   fz = NOISE_FRAC(z);
+  uint32_t  v = Noise_fade(y & 0xFFFF);
+  uint32_t  w = Noise_fade(z & 0xFFFF);
+  uint32_t  a;
+  uint32_t  aa;
+  uint32_t  ab;
+  uint8_t   h[4];
+
+  a  = ws2812b_noise_perm[xi] + yi;
+  aa = ws2812b_noise_perm[a & 0xFF] + zi;
+  ab = ws2812b_noise_perm[(a + 1) & 0xFF] + zi;
+  h[0] = ws2812b_noise_perm[aa & 0xFF];
+  h[1] = ws2812b_noise_perm[(aa + 1) & 0xFF];
+  h[2] = ws2812b_noise_perm[ab & 0xFF];
+  h[3] = ws2812b_noise_perm[(ab + 1) & 0xFF];
+  Noise3_face(&cl->g0, &cl->c0, h, fy, fz, v, w);
+
+  a  = ws2812b_noise_perm[(xi + 1) & 0xFF] + yi;
+  aa = ws2812b_noise_perm[a & 0xFF] + zi;
+  ab = ws2812b_noise_perm[(a + 1) & 0xFF] + zi;
+  h[0] = ws2812b_noise_perm[aa & 0xFF];
+  h[1] = ws2812b_noise_perm[(aa + 1) & 0xFF];
+  h[2] = ws2812b_noise_perm[ab & 0xFF];
+  h[3] = ws2812b_noise_perm[(ab + 1) & 0xFF];
+  Noise3_face(&cl->g1, &cl->c1, h, fy, fz, v, w);
+}
+
+/*-----------------------------------------------------------------------------------------------------
+   1D
+-----------------------------------------------------------------------------------------------------*/
+int16_t WS2812B_noise1(uint32_t x)
+{
+  T_noise_cell cl;
+
+  Noise1_cell(&cl, NOISE_CELL(x));
+  return Noise_eval(&cl, x, NOISE_SCALE1);
+}
+
+/*-----------------------------------------------------------------------------------------------------
+   2D
+-----------------------------------------------------------------------------------------------------*/
+int16_t WS2812B_noise2(uint32_t x, uint32_t y)
+{
+  T_noise_cell cl;
+
+  Noise2_cell(&cl, NOISE_CELL(x), y);
+  return Noise_eval(&cl, x, NOISE_SCALE2);
+}
+
+/*-----------------------------------------------------------------------------------------------------
+   3D
+-----------------------------------------------------------------------------------------------------*/
+int16_t WS2812B_noise3(uint32_t x, uint32_t y, uint32_t z)
+{
+  T_noise_cell cl;
+
+  Noise3_cell(&cl, NOISE_CELL(x), y, z);
+  return Noise_eval(&cl, x, NOISE_SCALE3);
+}
+
+/*-----------------------------------------------------------------------------------------------------
+    2D   x, x + dx, x + 2dx ...   y.
+            
+
+  dst -   n 
+-----------------------------------------------------------------------------------------------------*/
+void WS2812B_noise2_row(int16_t *dst, uint32_t n, uint32_t x, uint32_t dx, uint32_t y)
+{
+  T_noise_cell cl;
+  uint32_t     xi;
+  uint32_t     i;
+
+  if (n == 0) return;
+  xi = NOISE_CELL(x);
+  Noise2_cell(&cl, xi, y);
+  for (i = 0; i < n; i++)
+  {
+    if (NOISE_CELL(x) != xi)
+    {
+      xi = NOISE_CELL(x);
+      Noise2_cell(&cl, xi, y);
+    }
+    dst[i] = Noise_eval(&cl, x, NOISE_SCALE2);
+    x += dx;
+  }
+}
+
+/*-----------------------------------------------------------------------------------------------------
+    3D   x, x + dx, x + 2dx ...   y  z
+
+  dst -   n 
+-----------------------------------------------------------------------------------------------------*/
+void WS2812B_noise3_row(int16_t *dst, uint32_t n, uint32_t x, uint32_t dx, uint32_t y, uint32_t z)
+{
+  T_noise_cell cl;
+  uint32_t     xi;
+  uint32_t     i;
+
+  if (n == 0) return;
+  xi = NOISE_CELL(x);
+  Noise3_cell(&cl, xi, y, z);
+  for (i = 0; i < n; i++)
+  {
+    if (NOISE_CELL(x) != xi)
+    {
+      xi = NOISE_CELL(x);
+      Noise3_cell(&cl, xi, y, z);
+    }
+    dst[i] = Noise_eval(&cl, x, NOISE_SCALE3);
+    x += dx;
+  }
+}
@@ -0,0 +1,21 @@
+#ifndef LEDSC_WS2812B_NOISE_H
+#define LEDSC_WS2812B_NOISE_H
+
+/*
+       .
+      Q16:  16  -   ,  -   .
+     256    .
+   -WS2812B_NOISE_ONE..WS2812B_NOISE_ONE,     
+*/
+#define  WS2812B_NOISE_ONE     32767
+#define  WS2812B_NOISE_U8(v)   ((uint8_t)(((v) + 32768) >> 8)) //     0..255
+
+extern const uint8_t ws2812b_noise_perm[256];
+
+int16_t  WS2812B_noise1(uint32_t x);
+int16_t  WS2812B_noise2(uint32_t x, uint32_t y);
+int16_t  WS2812B_noise3(uint32_t x, uint32_t y, uint32_t z);
+void     WS2812B_noise2_row(int16_t *dst, uint32_t n, uint32_t x, uint32_t dx, uint32_t y);
+void     WS2812B_noise3_row(int16_t *dst, uint32_t n, uint32_t x, uint32_t dx, uint32_t y, uint32_t z);
+
+#endif // LEDSC_WS2812B_NOISE_H
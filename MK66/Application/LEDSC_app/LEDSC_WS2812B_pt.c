@@ -0,0 +1,190 @@
+//    ,       
+#include   <stdint.h>
+#include   "LEDSC_WS2812B_hsv.h"
+#include   "LEDSC_WS2812B_vm.h"
+#include   "LEDSC_WS2812B_fx.h"
+#include   "LEDSC_WS2812B_pt.h"
+#include   "LEDSC_WS2812B_blend.h"
+
+#define  PT_BRI_FULL     (256u << 16)      //   
+#define  PT_MS_MAX       100               //   ,      
+#define  PT_EMIT_UNIT    (255u * 1000u)    //     :  255  1000 
+
+/*-----------------------------------------------------------------------------------------------------
+    RGB  w 0..256     
+-----------------------------------------------------------------------------------------------------*/
+static inline uint32_t Pt_scale(uint32_t rgb, uint32_t w)
+{
+  return ((((rgb & 0x00FF00FF) * w) >> 8) & 0x00FF00FF) | ((((rgb & 0x0000FF00) * w) >> 8) & 0x0000FF00);
+}
+
+/*-----------------------------------------------------------------------------------------------------
+      k,     
+-----------------------------------------------------------------------------------------------------*/
+static inline void Pt_put(uint32_t *dst, uint32_t n, int32_t k, uint32_t rgb)
+{
+  if ((uint32_t)k < n) dst[k] = WS2812B_QADD8(dst[k], rgb);
+}
+
+/*-----------------------------------------------------------------------------------------------------
+    -j..+j
+-----------------------------------------------------------------------------------------------------*/
+static int32_t Pt_jitter(T_WS2812B_pt_pool *pl, uint32_t j)
+{
+  if (j == 0) return 0;
+  return (int32_t)(WS2812B_fx_rand(&pl->rnd) % (2 * j + 1)) - (int32_t)j;
+}
+
+/*-----------------------------------------------------------------------------------------------------
+   
+-----------------------------------------------------------------------------------------------------*/
+void WS2812B_pt_init(T_WS2812B_pt_pool *pl)
+{
+  pl->num = 0;
+  if (pl->rnd == 0) pl->rnd = 0x6C078965;
+}
+
+/*-----------------------------------------------------------------------------------------------------
+    
+
+  pl -  
+  s  -  
+
+     .       
+-----------------------------------------------------------------------------------------------------*/
+uint32_t WS2812B_pt_spawn(T_WS2812B_pt_pool *pl, const T_WS2812B_pt_spawn *s)
+{
+  uint32_t  k;
+  uint32_t  i;
+  uint32_t  life_ms;
+  int32_t   v;
+  uint32_t  h8;
+
+  life_ms = (s->life != 0 ? s->life : 1) * WS2812B_PT_LIFE_MS;
+  for (k = 0; (k < s->count) && (pl->num < WS2812B_PT_MAX); k++)
+  {
+    i  = pl->num++;
+    v  = s->speed + Pt_jitter(pl, s->jitter) * 16;      //      Q4
+    h8 = (s->hue + Pt_jitter(pl, s->hue_jitter)) & 0xFF;
+    pl->pos[i]  = ((int32_t)s->pos << 16) + 0x8000;      //  
+    pl->vel[i]  = (v * 4096) / 1000;                     // Q4   -> Q16  
+    pl->bri[i]  = PT_BRI_FULL;
+    pl->dec[i]  = PT_BRI_FULL / life_ms;
+    pl->rgb[i]  = WS2812B_hsv_to_rgb((h8 * 360 + 128) >> 8, s->sat, s->val);
+    pl->tail[i] = s->tail;
+  }
+  return k;
+}
+
+/*-----------------------------------------------------------------------------------------------------
+     .     
+
+  pl    -  
+  em    - 
+  level -   0..255
+  ms    -      
+-----------------------------------------------------------------------------------------------------*/
+void WS2812B_pt_emit(T_WS2812B_pt_pool *pl, T_WS2812B_pt_emitter *em, uint32_t level, uint32_t ms)
+{
+  T_WS2812B_pt_spawn  s;
+
+  if (em->rate == 0) return;
+  if (ms > PT_MS_MAX) ms = PT_MS_MAX;
+  if (level > 255) level = 255;
+  em->acc += em->rate * level * ms;
+  s = em->s;
+  s.count = 1;
+  while (em->acc >= PT_EMIT_UNIT)
+  {
+    em->acc -= PT_EMIT_UNIT;
+    if (em->width > 1) s.pos = em->s.pos + (uint16_t)(WS2812B_fx_rand(&pl->rnd) % em->width);
+    if (WS2812B_pt_spawn(pl, &s) == 0)
+    {
+      em->acc %= PT_EMIT_UNIT; //  ,    
+      break;
+    }
+  }
+}
+
+/*-----------------------------------------------------------------------------------------------------
+     .           :
+        
+
+  pl -  
+  ms -      
+  n  -  
+-----------------------------------------------------------------------------------------------------*/
+void WS2812B_pt_update(T_WS2812B_pt_pool *pl, uint32_t ms, uint32_t n)
+{
+  uint32_t  i = 0;
+  uint32_t  last;
+  uint32_t  d;
+  int32_t   p;
+  int32_t   margin;
+
+  if (ms > PT_MS_MAX) ms = PT_MS_MAX;
+  while (i < pl->num)
+  {
+    d      = pl->dec[i] * ms;
+    p      = pl->pos[i] + pl->vel[i] * (int32_t)ms;
+    margin = ((int32_t)pl->tail[i] + 1) << 16;
+    if ((d >= pl->bri[i]) || (p < -margin) || (p >= (int32_t)(n << 16) + margin))
+    {
+      last = --pl->num;
+      pl->pos[i]  = pl->pos[last];
+      pl->vel[i]  = pl->vel[last];
+      pl->bri[i]  = pl->bri[last];
+      pl->dec[i]  = pl->dec[last];
+      pl->rgb[i]  = pl->rgb[last];
+      pl->tail[i] = pl->tail[last];
+      continue;
+    }
+    pl->pos[i]  = p;
+    pl->bri[i] -= d;
+    i++;
+  }
+}
+
+/*-----------------------------------------------------------------------------------------------------
+     .
+           ,
+            
+
+  pl  -  
+  dst -    RGB  n 
+  n   -  
+-----------------------------------------------------------------------------------------------------*/
+void WS2812B_pt_splat(const T_WS2812B_pt_pool *pl, uint32_t *dst, uint32_t n)
+{
+  uint32_t  i;
+  uint32_t  c;
+  int32_t   k;
+  uint32_t  f;
+  uint32_t  t;
+  uint32_t  len;
+  uint32_t  w;
+  uint32_t  step;
+  int32_t   dir;
+
+  for (i = 0; i < pl->num; i++)
+  {
+    c = Pt_scale(pl->rgb[i], pl->bri[i] >> 16);
+    k = (pl->pos[i] - 0x8000) >> 16;               //    
+    f = ((uint32_t)(pl->pos[i] - 0x8000) >> 8) & 0xFF;
+    Pt_put(dst, n, k,     Pt_scale(c, 256 - f));
+    Pt_put(dst, n, k + 1, Pt_scale(c, f));
+
+    len = pl->tail[i];
+    if (len == 0) continue;
+    dir  = (pl->vel[i] >= 0) ? -1 : 1;
+    if (dir > 0) k++;                              //       
+    step = 256 / (len + 1);
+    w    = 256;
+    for (t = 1; t <= len; t++)
+    {
+      w -= step;
+      k += dir;
+      Pt_put(dst, n, k, Pt_scale(c, w));
+    }
+  }
+}
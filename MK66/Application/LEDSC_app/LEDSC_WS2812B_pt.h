@@ -0,0 +1,58 @@
+#ifndef LEDSC_WS2812B_PT_H
+#define LEDSC_WS2812B_PT_H
+
+#define  WS2812B_PT_MAX       256 //   .       
+#define  WS2812B_PT_LIFE_MS   20  //       , 
+
+/*
+     .        CMD_SPAWN     ,
+  16-   -   .
+      speed     -jitter..+jitter,
+   jitter   speed      ,  tail   speed - 
+*/
+typedef struct
+{
+  uint16_t  pos;        //  
+  int16_t   speed;      //        Q4,   
+  uint8_t   jitter;     //      
+  uint8_t   count;      //  
+  uint8_t   hue;        // ,     
+  uint8_t   hue_jitter; //  
+  uint8_t   sat;
+  uint8_t   val;
+  uint8_t   life;       //        WS2812B_PT_LIFE_MS
+  uint8_t   tail;       //    , 0 -   
+} T_WS2812B_pt_spawn;
+
+//    .      0..255
+typedef struct
+{
+  T_WS2812B_pt_spawn  s;     //  , count  
+  uint16_t            width; //      s.pos..s.pos + width - 1
+  uint16_t            rate;  //       255, 0 -  
+  uint32_t            acc;   //     
+} T_WS2812B_pt_emitter;
+
+/*
+   .     ,     0..num - 1.
+     ,           
+*/
+typedef struct
+{
+  uint32_t  num;                     //   
+  uint32_t  rnd;                     //    
+  int32_t   pos[WS2812B_PT_MAX];     //      Q16
+  int32_t   vel[WS2812B_PT_MAX];     //        Q16
+  uint32_t  bri[WS2812B_PT_MAX];     //  0..256   Q16, 256 - 
+  uint32_t  dec[WS2812B_PT_MAX];     //       Q16
+  uint32_t  rgb[WS2812B_PT_MAX];     //       RGB
+  uint8_t   tail[WS2812B_PT_MAX];    //    
+} T_WS2812B_pt_pool;
+
+void     WS2812B_pt_init(T_WS2812B_pt_pool *pl);
+uint32_t WS2812B_pt_spawn(T_WS2812B_pt_pool *pl, const T_WS2812B_pt_spawn *s);
+void     WS2812B_pt_emit(T_WS2812B_pt_pool *pl, T_WS2812B_pt_emitter *em, uint32_t level, uint32_t ms);
+void     WS2812B_pt_update(T_WS2812B_pt_pool *pl, uint32_t ms, uint32_t n);
+void     WS2812B_pt_splat(const T_WS2812B_pt_pool *pl, uint32_t *dst, uint32_t n);
+
+#endif // LEDSC_WS2812B_PT_H
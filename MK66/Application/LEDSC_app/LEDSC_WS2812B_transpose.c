@@ -0,0 +1,126 @@
+//             GPIO
+#include   <stdint.h>
+#include   "LEDSC_WS2812B_transpose.h"
+
+#if defined(__ICCARM__)
+  #include <intrinsics.h>
+  #define  TRP_REV(x)  __REV(x) //      REV
+#else
+  #define  TRP_REV(x)  ((((x) >> 24) & 0x000000FFu) | (((x) >> 8) & 0x0000FF00u) | (((x) << 8) & 0x00FF0000u) | ((x) << 24))
+#endif
+
+//   RGB  ,      
+#define  TRP_LUT(lut, x) \
+  (((uint32_t)(lut)[2][((x) >> 16) & 0xFF] << 16) | ((uint32_t)(lut)[1][((x) >> 8) & 0xFF] << 8) | (uint32_t)(lut)[0][(x) & 0xFF])
+
+//  4-    a..d  .  a    
+#define  TRP_PACK(a, b, c, d, sh) \
+  ((((a) >> (sh)) & 0xFF) << 24 | (((b) >> (sh)) & 0xFF) << 16 | (((c) >> (sh)) & 0xFF) << 8 | (((d) >> (sh)) & 0xFF))
+
+/*-----------------------------------------------------------------------------------------------------
+    8x8     x ( 0..3)  y ( 4..7)  3   
+  (Hacker's Delight, transpose8).  Cortex-M4   -       .
+   - 8       ,   
+-----------------------------------------------------------------------------------------------------*/
+static inline void WS2812B_tr8x8(uint32_t *dst, uint32_t x, uint32_t y)
+{
+  uint32_t t;
+
+  t = (x ^ (x >> 7)) & 0x00AA00AA;
+  x = x ^ t ^ (t << 7);
+  t = (y ^ (y >> 7)) & 0x00AA00AA;
+  y = y ^ t ^ (t << 7);
+
+  t = (x ^ (x >> 14)) & 0x0000CCCC;
+  x = x ^ t ^ (t << 14);
+  t = (y ^ (y >> 14)) & 0x0000CCCC;
+  y = y ^ t ^ (t << 14);
+
+  t = (x & 0xF0F0F0F0) | ((y >> 4) & 0x0F0F0F0F);
+  y = ((x << 4) & 0xF0F0F0F0) | (y & 0x0F0F0F0F);
+
+  //     ,   little-endian  
+  dst[0] = TRP_REV(t);
+  dst[1] = TRP_REV(y);
+}
+
+/*-----------------------------------------------------------------------------------------------------
+      8-   24       G, R, B.
+   k   (7 - k % 8)   ,  i    i
+
+  dst -     6- 
+  rgb -  8-    RGB (00000000 RRRRRRRR GGGGGGGG BBBBBBBB)
+-----------------------------------------------------------------------------------------------------*/
+void WS2812B_transpose8(uint32_t *dst, const uint32_t *rgb)
+{
+  uint32_t c0 = rgb[0], c1 = rgb[1], c2 = rgb[2], c3 = rgb[3];
+  uint32_t c4 = rgb[4], c5 = rgb[5], c6 = rgb[6], c7 = rgb[7];
+
+  //  0  -  7,   0      
+  WS2812B_tr8x8(&dst[0], TRP_PACK(c7, c6, c5, c4, 8),  TRP_PACK(c3, c2, c1, c0, 8));  // 
+  WS2812B_tr8x8(&dst[2], TRP_PACK(c7, c6, c5, c4, 16), TRP_PACK(c3, c2, c1, c0, 16)); // 
+  WS2812B_tr8x8(&dst[4], TRP_PACK(c7, c6, c5, c4, 0),  TRP_PACK(c3, c2, c1, c0, 0));  // 
+}
+
+/*-----------------------------------------------------------------------------------------------------
+        
+
+         strip_leds .
+            lanes_mask,
+                 .
+
+  dst        -   strip_leds * 6 
+  frame      -   leds_num    RGB
+  strip_leds -     
+  lanes_mask -      
+  lut        -    ,  0..2  ,   .     0
+-----------------------------------------------------------------------------------------------------*/
+void WS2812B_transpose_frame(uint32_t *dst, const uint32_t *frame, uint32_t leds_num, uint32_t strip_leds, uint32_t lanes_mask, const uint8_t (*lut)[256])
+{
+  static const uint32_t  zero = 0;
+  const uint32_t        *lp[WS2812B_LANES];
+  uint32_t               lm[WS2812B_LANES]; //   . 0   ,     
+  uint32_t               c[WS2812B_LANES];
+  uint32_t               i, l;
+  uint32_t               pos  = 0;
+  uint32_t               full = strip_leds; //  ,      
+
+  for (i = 0; i < WS2812B_LANES; i++)
+  {
+    lp[i] = &zero;
+    lm[i] = 0;
+    if ((lanes_mask & (1u << i)) && (pos < leds_num))
+    {
+      lp[i] = &frame[pos];
+      lm[i] = 0xFFFFFFFF;
+      if ((leds_num - pos) < full) full = leds_num - pos;
+      pos += strip_leds;
+    }
+  }
+
+  for (l = 0; l < full; l++)
+  {
+    c[0] = TRP_LUT(lut, lp[0][l & lm[0]]);
+    c[1] = TRP_LUT(lut, lp[1][l & lm[1]]);
+    c[2] = TRP_LUT(lut, lp[2][l & lm[2]]);
+    c[3] = TRP_LUT(lut, lp[3][l & lm[3]]);
+    c[4] = TRP_LUT(lut, lp[4][l & lm[4]]);
+    c[5] = TRP_LUT(lut, lp[5][l & lm[5]]);
+    c[6] = TRP_LUT(lut, lp[6][l & lm[6]]);
+    c[7] = TRP_LUT(lut, lp[7][l & lm[7]]);
+    WS2812B_transpose8(dst, c);
+    dst += WS2812B_LANE_BYTES_PER_LED / 4;
+  }
+
+  //       
+  for (; l < strip_leds; l++)
+  {
+    for (i = 0; i < WS2812B_LANES; i++)
+    {
+      if ((lm[i] != 0) && ((lp[i] - frame) + l < leds_num)) c[i] = TRP_LUT(lut, lp[i][l]);
+      else c[i] = 0;
+    }
+    WS2812B_transpose8(dst, c);
+    dst += WS2812B_LANE_BYTES_PER_LED / 4;
+  }
+}
@@ -0,0 +1,10 @@
+#ifndef LEDSC_WS2812B_TRANSPOSE_H
+#define LEDSC_WS2812B_TRANSPOSE_H
+
+#define  WS2812B_LANES              8  //         GPIO
+#define  WS2812B_LANE_BYTES_PER_LED 24 //         
+
+void WS2812B_transpose8(uint32_t *dst, const uint32_t *rgb);
+void WS2812B_transpose_frame(uint32_t *dst, const uint32_t *frame, uint32_t leds_num, uint32_t strip_leds, uint32_t lanes_mask, const uint8_t (*lut)[256]);
+
+#endif // LEDSC_WS2812B_TRANSPOSE_H
@@ -0,0 +1,488 @@
+//   - ,    
+#include   <stdint.h>
+#include   "LEDSC_WS2812B_hsv.h"
+#include   "LEDSC_WS2812B_vm.h"
+
+#if defined(__ICCARM__)
+  #include <intrinsics.h>
+  #define  VM_CLAMP8(x)  ((int32_t)__USAT(x, 8))
+#else
+  #define  VM_CLAMP8(x)  (((x) < 0) ? 0 : (((x) > 255) ? 255 : (x)))
+#endif
+
+//      
+#define  VM_C_BAD   0
+#define  VM_C_LOAD  1 // -> x
+#define  VM_C_BIN   2 // a b -> x
+#define  VM_C_UN    3 // a -> x
+#define  VM_C_DUP   4
+#define  VM_C_DROP  5
+#define  VM_C_SWAP  6
+#define  VM_C_OVER  7
+#define  VM_C_SEL   8
+#define  VM_C_OUT   9 // h s v ->
+
+#define  VM_OPS_NUM (WS2812B_VM_RGB + 1)
+
+static const uint8_t vm_class[VM_OPS_NUM] =
+{
+  VM_C_BAD,  VM_C_LOAD, VM_C_LOAD, VM_C_LOAD, VM_C_LOAD, VM_C_LOAD, VM_C_LOAD, VM_C_BAD,  // 0x00
+  VM_C_DUP,  VM_C_DROP, VM_C_SWAP, VM_C_OVER, VM_C_BAD,  VM_C_BAD,  VM_C_BAD,  VM_C_BAD,  // 0x08
+  VM_C_BIN,  VM_C_BIN,  VM_C_BIN,  VM_C_BIN,  VM_C_BIN,  VM_C_BIN,  VM_C_BIN,  VM_C_BIN,  // 0x10
+  VM_C_BIN,  VM_C_BIN,  VM_C_BIN,  VM_C_BIN,  VM_C_BIN,  VM_C_BIN,  VM_C_BAD,  VM_C_BAD,  // 0x18
+  VM_C_UN,   VM_C_UN,   VM_C_UN,   VM_C_UN,   VM_C_UN,   VM_C_UN,   VM_C_BAD,  VM_C_BAD,  // 0x20
+  VM_C_SEL,  VM_C_BAD,  VM_C_BAD,  VM_C_BAD,  VM_C_BAD,  VM_C_BAD,  VM_C_BAD,  VM_C_BAD,  // 0x28
+  VM_C_OUT,  VM_C_OUT                                                                     // 0x30
+};
+
+//   256     Q15
+static const int16_t vm_sin_tab[256] =
+{
+       0,    804,   1608,   2410,   3212,   4011,   4808,   5602,   6393,   7179,   7962,   8739,   9512,  10278,  11039,  11793,
+   12539,  13279,  14010,  14732,  15446,  16151,  16846,  17530,  18204,  18868,  19519,  20159,  20787,  21403,  22005,  22594,
+   23170,  23731,  24279,  24811,  25329,  25832,  26319,  26790,  27245,  27683,  28105,  28510,  28898,  29268,  29621,  29956,
+   30273,  30571,  30852,  31113,  31356,  31580,  31785,  31971,  32137,  32285,  32412,  32521,  32609,  32678,  32728,  32757,
+   32767,  32757,  32728,  32678,  32609,  32521,  32412,  32285,  32137,  31971,  31785,  31580,  31356,  31113,  30852,  30571,
+   30273,  29956,  29621,  29268,  28898,  28510,  28105,  27683,  27245,  26790,  26319,  25832,  25329,  24811,  24279,  23731,
+   23170,  22594,  22005,  21403,  20787,  20159,  19519,  18868,  18204,  17530,  16846,  16151,  15446,  14732,  14010,  13279,
+   12539,  11793,  11039,  10278,   9512,   8739,   7962,   7179,   6393,   5602,   4808,   4011,   3212,   2410,   1608,    804,
+       0,   -804,  -1608,  -2410,  -3212,  -4011,  -4808,  -5602,  -6393,  -7179,  -7962,  -8739,  -9512, -10278, -11039, -11793,
+  -12539, -13279, -14010, -14732, -15446, -16151, -16846, -17530, -18204, -18868, -19519, -20159, -20787, -21403, -22005, -22594,
+  -23170, -23731, -24279, -24811, -25329, -25832, -26319, -26790, -27245, -27683, -28105, -28510, -28898, -29268, -29621, -29956,
+  -30273, -30571, -30852, -31113, -31356, -31580, -31785, -31971, -32137, -32285, -32412, -32521, -32609, -32678, -32728, -32757,
+  -32767, -32757, -32728, -32678, -32609, -32521, -32412, -32285, -32137, -31971, -31785, -31580, -31356, -31113, -30852, -30571,
+  -30273, -29956, -29621, -29268, -28898, -28510, -28105, -27683, -27245, -26790, -26319, -25832, -25329, -24811, -24279, -23731,
+  -23170, -22594, -22005, -21403, -20787, -20159, -19519, -18868, -18204, -17530, -16846, -16151, -15446, -14732, -14010, -13279,
+  -12539, -11793, -11039, -10278,  -9512,  -8739,  -7962,  -7179,  -6393,  -5602,  -4808,  -4011,  -3212,  -2410,  -1608,   -804,
+};
+
+/*
+   .          ,
+        ,   .
+        ,    
+*/
+#define  VM_NEG_(a)  ((int32_t)(0u - (uint32_t)(a)))
+
+#define  VM_BIN_OPS(X) \
+  X(WS2812B_VM_ADD,  (int32_t)((uint32_t)a + (uint32_t)b)) \
+  X(WS2812B_VM_SUB,  (int32_t)((uint32_t)a - (uint32_t)b)) \
+  X(WS2812B_VM_MUL,  (int32_t)((uint32_t)a * (uint32_t)b)) \
+  X(WS2812B_VM_MULQ, (int32_t)(((int64_t)a * b) >> 16)) \
+  X(WS2812B_VM_DIV,  Vm_div(a, b)) \
+  X(WS2812B_VM_MOD,  Vm_mod(a, b)) \
+  X(WS2812B_VM_AND,  a & b) \
+  X(WS2812B_VM_OR,   a | b) \
+  X(WS2812B_VM_XOR,  a ^ b) \
+  X(WS2812B_VM_SHL,  (int32_t)((uint32_t)a << (b & 31))) \
+  X(WS2812B_VM_SHR,  a >> (b & 31)) \
+  X(WS2812B_VM_MIN,  (a < b) ? a : b) \
+  X(WS2812B_VM_MAX,  (a > b) ? a : b) \
+  X(WS2812B_VM_LT,   (a < b) ? 1 : 0)
+
+#define  VM_UN_OPS(X) \
+  X(WS2812B_VM_NEG,    VM_NEG_(a)) \
+  X(WS2812B_VM_ABS,    (a < 0) ? VM_NEG_(a) : a) \
+  X(WS2812B_VM_SIN,    Vm_sin(a)) \
+  X(WS2812B_VM_TRI,    Vm_tri(a)) \
+  X(WS2812B_VM_RND,    Vm_rnd(a)) \
+  X(WS2812B_VM_CLAMP8, VM_CLAMP8(a))
+
+//   
+typedef struct
+{
+  T_WS2812B_vm_prog *prog;
+  uint32_t           max;   //   
+  int32_t            depth; //   
+  uint32_t           done;  //   
+} T_vm_build;
+
+static inline int32_t Vm_div(int32_t a, int32_t b)
+{
+  if (b == 0)  return 0;
+  if (b == -1) return VM_NEG_(a);
+  return a / b;
+}
+
+static inline int32_t Vm_mod(int32_t a, int32_t b)
+{
+  if ((b == 0) || (b == -1)) return 0;
+  return a % b;
+}
+
+/*-----------------------------------------------------------------------------------------------------
+      Q16       .    Q16
+-----------------------------------------------------------------------------------------------------*/
+static inline int32_t Vm_sin(int32_t a)
+{
+  uint32_t k = ((uint32_t)a >> 8) & 0xFF;
+  int32_t  s0 = vm_sin_tab[k];
+  int32_t  s1 = vm_sin_tab[(k + 1) & 0xFF];
+
+  return s0 * 2 + (((s1 - s0) * (int32_t)((uint32_t)a & 0xFF)) >> 7);
+}
+
+/*-----------------------------------------------------------------------------------------------------
+     Q16 : 0   , 0xFFFE  
+-----------------------------------------------------------------------------------------------------*/
+static inline int32_t Vm_tri(int32_t a)
+{
+  uint32_t x = (uint32_t)a & 0xFFFF;
+
+  return (int32_t)(((x ^ ((0u - (x >> 15)) & 0xFFFF)) & 0x7FFF) << 1);
+}
+
+/*-----------------------------------------------------------------------------------------------------
+    .    0..0xFFFF  ,
+          
+-----------------------------------------------------------------------------------------------------*/
+static inline int32_t Vm_rnd(int32_t a)
+{
+  uint32_t h = (uint32_t)a * 0x9E3779B1u;
+
+  h ^= h >> 15;
+  h *= 0x2C1B3C6Du;
+  h ^= h >> 12;
+  return (int32_t)(h & 0xFFFF);
+}
+
+static int32_t Vm_bin(uint32_t op, int32_t a, int32_t b)
+{
+  switch (op)
+  {
+#define X(code, expr) case code: return (expr);
+  VM_BIN_OPS(X)
+#undef X
+  }
+  return 0;
+}
+
+static int32_t Vm_un(uint32_t op, int32_t a)
+{
+  switch (op)
+  {
+#define X(code, expr) case code: return (expr);
+  VM_UN_OPS(X)
+#undef X
+  }
+  return 0;
+}
+
+/*-----------------------------------------------------------------------------------------------------
+      
+-----------------------------------------------------------------------------------------------------*/
+static uint32_t Vm_append(T_vm_build *b, uint32_t op, uint32_t arg, int32_t imm)
+{
+  T_WS2812B_vm_ins *ins;
+
+  if (b->prog->len >= b->max) return WS2812B_VM_ERR_LONG;
+  ins = &b->prog->code[b->prog->len++];
+  ins->op  = (uint8_t)op;
+  ins->arg = (uint8_t)arg;
+  ins->imm = imm;
+  return WS2812B_VM_OK;
+}
+
+/*-----------------------------------------------------------------------------------------------------
+              .
+           PUSH:
+        ,      PUSH    
+          .
+
+  b   -  
+  op  -   -
+  arg -    PARAM
+  imm -   PUSH
+
+   WS2812B_VM_OK   
+-----------------------------------------------------------------------------------------------------*/
+static uint32_t Vm_emit(T_vm_build *b, uint32_t op, uint32_t arg, int32_t imm)
+{
+  T_WS2812B_vm_ins *c = b->prog->code;
+  uint32_t          len = b->prog->len;
+  uint32_t          cls = vm_class[op];
+  uint32_t          k1;  //    
+  uint32_t          k2;  //     
+  int32_t           pop;
+  int32_t           push;
+
+  if (b->done != 0) return WS2812B_VM_ERR_END;
+
+  switch (cls)
+  {
+  case VM_C_LOAD: pop = 0; push = 1; break;
+  case VM_C_BIN:  pop = 2; push = 1; break;
+  case VM_C_UN:   pop = 1; push = 1; break;
+  case VM_C_DUP:  pop = 1; push = 2; break;
+  case VM_C_DROP: pop = 1; push = 0; break;
+  case VM_C_SWAP: pop = 2; push = 2; break;
+  case VM_C_OVER: pop = 2; push = 3; break;
+  case VM_C_SEL:  pop = 3; push = 1; break;
+  case VM_C_OUT:  pop = 3; push = 0; break;
+  default:        return WS2812B_VM_ERR_OPCODE;
+  }
+  if (b->depth < pop) return WS2812B_VM_ERR_STACK;
+  if ((cls == VM_C_OUT) && (b->depth != 3)) return WS2812B_VM_ERR_STACK;
+  b->depth += push - pop;
+  if (b->depth > WS2812B_VM_STACK_MAX) return WS2812B_VM_ERR_STACK;
+  if (b->depth > (int32_t)b->prog->depth) b->prog->depth = b->depth;
+
+  k1 = (len >= 1) && (c[len - 1].op == WS2812B_VM_PUSH);
+  k2 = k1 && (len >= 2) && (c[len - 2].op == WS2812B_VM_PUSH);
+
+  switch (cls)
+  {
+  case VM_C_LOAD:
+    return Vm_append(b, op, arg, imm);
+
+  case VM_C_BIN:
+    if (k2)
+    {
+      c[len - 2].imm = Vm_bin(op, c[len - 2].imm, c[len - 1].imm);
+      b->prog->len--;
+      return WS2812B_VM_OK;
+    }
+    if (k1)
+    {
+      imm = c[len - 1].imm;
+      //        
+      if (((op == WS2812B_VM_ADD) || (op == WS2812B_VM_SUB) || (op == WS2812B_VM_OR) || (op == WS2812B_VM_XOR)) && (imm == 0)) { b->prog->len--; return WS2812B_VM_OK; }
+      if (((op == WS2812B_VM_SHL) || (op == WS2812B_VM_SHR)) && ((imm & 31) == 0))                                          { b->prog->len--; return WS2812B_VM_OK; }
+      if (((op == WS2812B_VM_MUL) && (imm == 1)) || ((op == WS2812B_VM_MULQ) && (imm == 0x10000)))                            { b->prog->len--; return WS2812B_VM_OK; }
+      c[len - 1].op = (uint8_t)(op | WS2812B_VM_K);
+      return WS2812B_VM_OK;
+    }
+    return Vm_append(b, op, 0, 0);
+
+  case VM_C_UN:
+    if (k1)
+    {
+      c[len - 1].imm = Vm_un(op, c[len - 1].imm);
+      return WS2812B_VM_OK;
+    }
+    return Vm_append(b, op, 0, 0);
+
+  case VM_C_DUP:
+    if (k1) return Vm_append(b, WS2812B_VM_PUSH, 0, c[len - 1].imm);
+    return Vm_append(b, op, 0, 0);
+
+  case VM_C_DROP:
+    //  ,     
+    if ((len >= 1) && ((c[len - 1].op & WS2812B_VM_K) == 0) && (vm_class[c[len - 1].op] == VM_C_LOAD))
+    {
+      b->prog->len--;
+      return WS2812B_VM_OK;
+    }
+    return Vm_append(b, op, 0, 0);
+
+  case VM_C_SWAP:
+    if (k2)
+    {
+      imm = c[len - 1].imm;
+      c[len - 1].imm = c[len - 2].imm;
+      c[len - 2].imm = imm;
+      return WS2812B_VM_OK;
+    }
+    return Vm_append(b, op, 0, 0);
+
+  case VM_C_OVER:
+    if (k2) return Vm_append(b, WS2812B_VM_PUSH, 0, c[len - 2].imm);
+    return Vm_append(b, op, 0, 0);
+
+  case VM_C_SEL:
+    if (k2 && (len >= 3) && (c[len - 3].op == WS2812B_VM_PUSH))
+    {
+      if (c[len - 3].imm == 0) c[len - 3].imm = c[len - 1].imm;
+      else c[len - 3].imm = c[len - 2].imm;
+      b->prog->len -= 2;
+      return WS2812B_VM_OK;
+    }
+    return Vm_append(b, op, 0, 0);
+
+  default: // VM_C_OUT
+    b->done = 1;
+    return Vm_append(b, op, 0, 0);
+  }
+}
+
+static void Vm_build_init(T_vm_build *b, T_WS2812B_vm_prog *prog, uint32_t max)
+{
+  b->prog     = prog;
+  b->max      = max;
+  b->depth    = 0;
+  b->done     = 0;
+  prog->len   = 0;
+  prog->depth = 0;
+}
+
+/*-----------------------------------------------------------------------------------------------------
+     -     .
+    , ,  ,      ,
+          
+
+  prog -  
+  code - -
+  sz   -  -
+
+   WS2812B_VM_OK    WS2812B_VM_ERR_...,    
+-----------------------------------------------------------------------------------------------------*/
+uint32_t WS2812B_vm_load(T_WS2812B_vm_prog *prog, const uint8_t *code, uint32_t sz)
+{
+  T_vm_build  b;
+  uint32_t    pos = 0;
+  uint32_t    op;
+  uint32_t    arg;
+  int32_t     imm;
+  uint32_t    res = WS2812B_VM_OK;
+
+  Vm_build_init(&b, prog, WS2812B_VM_INS_MAX);
+  if (sz > WS2812B_VM_CODE_MAX) res = WS2812B_VM_ERR_LONG;
+
+  while ((res == WS2812B_VM_OK) && (pos < sz))
+  {
+    op  = code[pos++];
+    arg = 0;
+    imm = 0;
+    if ((op >= VM_OPS_NUM) || (vm_class[op] == VM_C_BAD))
+    {
+      res = WS2812B_VM_ERR_OPCODE;
+      break;
+    }
+    switch (op)
+    {
+    case WS2812B_VM_PUSH:
+      if (sz - pos < 4) { res = WS2812B_VM_ERR_TRUNC; break; }
+      imm = (int32_t)((uint32_t)code[pos] | ((uint32_t)code[pos + 1] << 8) | ((uint32_t)code[pos + 2] << 16) | ((uint32_t)code[pos + 3] << 24));
+      pos += 4;
+      break;
+    case WS2812B_VM_PUSH8:
+      if (sz - pos < 1) { res = WS2812B_VM_ERR_TRUNC; break; }
+      op  = WS2812B_VM_PUSH;
+      imm = (int8_t)code[pos++];
+      break;
+    case WS2812B_VM_PARAM:
+      if (sz - pos < 1) { res = WS2812B_VM_ERR_TRUNC; break; }
+      arg = code[pos++];
+      if (arg >= WS2812B_VM_PARAMS) res = WS2812B_VM_ERR_OPCODE;
+      break;
+    }
+    if (res == WS2812B_VM_OK) res = Vm_emit(&b, op, arg, imm);
+  }
+  if ((res == WS2812B_VM_OK) && (b.done == 0)) res = WS2812B_VM_ERR_END;
+  if (res != WS2812B_VM_OK) prog->len = 0;
+  return res;
+}
+
+/*-----------------------------------------------------------------------------------------------------
+    :          .
+     ,     .     ,
+              
+
+  prog   -  
+  frame  -  
+  ms     -    
+  params - WS2812B_VM_PARAMS  
+-----------------------------------------------------------------------------------------------------*/
+void WS2812B_vm_specialize(const T_WS2812B_vm_prog *prog, T_WS2812B_vm_prog *frame, uint32_t ms, const int32_t *params)
+{
+  T_vm_build               b;
+  const T_WS2812B_vm_ins  *ins;
+  uint32_t                 i;
+
+  Vm_build_init(&b, frame, WS2812B_VM_INS_MAX + 1);
+  for (i = 0; i < prog->len; i++)
+  {
+    ins = &prog->code[i];
+    if (ins->op == WS2812B_VM_TIME)
+    {
+      Vm_emit(&b, WS2812B_VM_PUSH, 0, (int32_t)ms);
+    }
+    else if (ins->op == WS2812B_VM_PARAM)
+    {
+      Vm_emit(&b, WS2812B_VM_PUSH, 0, params[ins->arg]);
+    }
+    else if (ins->op & WS2812B_VM_K)
+    {
+      Vm_emit(&b, WS2812B_VM_PUSH, 0, ins->imm);
+      Vm_emit(&b, ins->op & ~WS2812B_VM_K, 0, 0);
+    }
+    else
+    {
+      Vm_emit(&b, ins->op, ins->arg, ins->imm);
+    }
+  }
+}
+
+/*-----------------------------------------------------------------------------------------------------
+     HSV   
+-----------------------------------------------------------------------------------------------------*/
+static uint32_t Vm_hsv(int32_t h, int32_t s, int32_t v)
+{
+  h %= 360;
+  if (h < 0) h += 360;
+  return WS2812B_hsv_to_rgb((uint32_t)h, (uint32_t)VM_CLAMP8(s), (uint32_t)VM_CLAMP8(v));
+}
+
+/*-----------------------------------------------------------------------------------------------------
+       .
+      , sp      .
+       ,         
+
+  frame -  ,  WS2812B_vm_specialize
+  dst   -    RGB  n 
+  n     -  
+-----------------------------------------------------------------------------------------------------*/
+void WS2812B_vm_run(const T_WS2812B_vm_prog *frame, uint32_t *dst, uint32_t n)
+{
+  int32_t                  stk[WS2812B_VM_STACK_MAX + 1];
+  int32_t                 *sp;
+  int32_t                  tos;
+  int32_t                  a;
+  int32_t                  b;
+  const T_WS2812B_vm_ins  *ip;
+  const T_WS2812B_vm_ins  *last;
+  uint32_t                 i;
+
+  if (frame->len == 0)
+  {
+    for (i = 0; i < n; i++) dst[i] = 0;
+    return;
+  }
+  last = &frame->code[frame->len - 1];
+
+  for (i = 0; i < n; i++)
+  {
+    sp  = stk;
+    tos = 0;
+    for (ip = frame->code; ip != last; ip++)
+    {
+      switch (ip->op)
+      {
+      case WS2812B_VM_PUSH:  *++sp = tos; tos = ip->imm;       break;
+      case WS2812B_VM_LED:   *++sp = tos; tos = (int32_t)i;    break;
+      case WS2812B_VM_NUM:   *++sp = tos; tos = (int32_t)n;    break;
+      case WS2812B_VM_DUP:   *++sp = tos;                      break;
+      case WS2812B_VM_DROP:  tos = *sp--;                      break;
+      case WS2812B_VM_SWAP:  a = *sp; *sp = tos; tos = a;      break;
+      case WS2812B_VM_OVER:  a = *sp; *++sp = tos; tos = a;    break;
+      case WS2812B_VM_SEL:   tos = (sp[-1] != 0) ? sp[0] : tos; sp -= 2; break;
+#define X(code, expr) \
+      case code:                  b = tos; a = *sp--; tos = (expr); break; \
+      case code | WS2812B_VM_K:   a = tos; b = ip->imm; tos = (expr); break;
+      VM_BIN_OPS(X)
+#undef X
+#define X(code, expr) \
+      case code:                  a = tos; tos = (expr); break;
+      VM_UN_OPS(X)
+#undef X
+      }
+    }
+    if (last->op == WS2812B_VM_HSV)
+    {
+      dst[i] = Vm_hsv(sp[-1], sp[0], tos);
+    }
+    else
+    {
+      dst[i] = ((uint32_t)VM_CLAMP8(sp[-1]) << 16) | ((uint32_t)VM_CLAMP8(sp[0]) << 8) | (uint32_t)VM_CLAMP8(tos);
+    }
+  }
+}
@@ -0,0 +1,124 @@
+#ifndef LEDSC_WS2812B_VM_H
+#define LEDSC_WS2812B_VM_H
+
+#define  WS2812B_VM_CODE_MAX   256 //   -    
+#define  WS2812B_VM_INS_MAX    64  //      .    
+#define  WS2812B_VM_STACK_MAX  16  //   
+#define  WS2812B_VM_PARAMS     6   //     
+
+/*
+  -  .
+
+           .  ,  32-   .
+        Q16,    Q16  (0x10000 -  ).
+   ,       .     SEL.
+        ,    , 32-  -   .
+    ""  :    ( - ) -> .
+
+                        
+  0x01  PUSH     imm32     -> imm32           
+  0x02  PUSH8    imm8      -> imm8             -128..127
+  0x03  LED      -         -> i                
+  0x04  NUM      -         -> n                  
+  0x05  TIME     -         -> ms                   
+  0x06  PARAM    k8        -> p[k]             : 0 - speed, 1 - hue, 2 - sat, 3 - val, 4 - density, 5 - width
+  0x08  DUP      -         a -> a a
+  0x09  DROP     -         a ->
+  0x0A  SWAP     -         a b -> b a
+  0x0B  OVER     -         a b -> a b a
+  0x10  ADD      -         a b -> a + b
+  0x11  SUB      -         a b -> a - b
+  0x12  MUL      -         a b -> a * b
+  0x13  MULQ     -         a b -> (a * b) >> 16    Q16
+  0x14  DIV      -         a b -> a / b        b = 0  0
+  0x15  MOD      -         a b -> a % b        b = 0  0
+  0x16  AND      -         a b -> a & b
+  0x17  OR       -         a b -> a | b
+  0x18  XOR      -         a b -> a ^ b
+  0x19  SHL      -         a b -> a << b         5  b
+  0x1A  SHR      -         a b -> a >> b          5  b
+  0x1B  MIN      -         a b -> min(a, b)
+  0x1C  MAX      -         a b -> max(a, b)
+  0x1D  LT       -         a b -> a < b       1  0
+  0x20  NEG      -         a -> -a
+  0x21  ABS      -         a -> |a|
+  0x22  SIN      -         a -> sin(a)         Q16 ,  Q16 -0xFFFE..0xFFFE
+  0x23  TRI      -         a -> tri(a)           Q16 : 0..0xFFFE..0
+  0x24  RND      -         a -> hash(a)        0..0xFFFF,    a
+  0x25  CLAMP8   -         a -> 0..255          
+  0x28  SEL      -         c a b -> c ? a : b
+  0x30  HSV      -         h s v ->            :      360,    0..255
+  0x31  RGB      -         r g b ->            ,   0..255
+
+       HSV  RGB,        3 .
+*/
+#define  WS2812B_VM_PUSH       0x01
+#define  WS2812B_VM_PUSH8      0x02
+#define  WS2812B_VM_LED        0x03
+#define  WS2812B_VM_NUM        0x04
+#define  WS2812B_VM_TIME       0x05
+#define  WS2812B_VM_PARAM      0x06
+#define  WS2812B_VM_DUP        0x08
+#define  WS2812B_VM_DROP       0x09
+#define  WS2812B_VM_SWAP       0x0A
+#define  WS2812B_VM_OVER       0x0B
+#define  WS2812B_VM_ADD        0x10
+#define  WS2812B_VM_SUB        0x11
+#define  WS2812B_VM_MUL        0x12
+#define  WS2812B_VM_MULQ       0x13
+#define  WS2812B_VM_DIV        0x14
+#define  WS2812B_VM_MOD        0x15
+#define  WS2812B_VM_AND        0x16
+#define  WS2812B_VM_OR         0x17
+#define  WS2812B_VM_XOR        0x18
+#define  WS2812B_VM_SHL        0x19
+#define  WS2812B_VM_SHR        0x1A
+#define  WS2812B_VM_MIN        0x1B
+#define  WS2812B_VM_MAX        0x1C
+#define  WS2812B_VM_LT         0x1D
+#define  WS2812B_VM_NEG        0x20
+#define  WS2812B_VM_ABS        0x21
+#define  WS2812B_VM_SIN        0x22
+#define  WS2812B_VM_TRI        0x23
+#define  WS2812B_VM_RND        0x24
+#define  WS2812B_VM_CLAMP8     0x25
+#define  WS2812B_VM_SEL        0x28
+#define  WS2812B_VM_HSV        0x30
+#define  WS2812B_VM_RGB        0x31
+
+#define  WS2812B_VM_K          0x80 //    :      imm,    
+
+//        uint8_t
+#define  WS2812B_VM_P_PUSH(x)  WS2812B_VM_PUSH, (uint8_t)((x) & 0xFF), (uint8_t)(((x) >> 8) & 0xFF), (uint8_t)(((x) >> 16) & 0xFF), (uint8_t)(((x) >> 24) & 0xFF)
+#define  WS2812B_VM_P_PUSH8(x) WS2812B_VM_PUSH8, (uint8_t)((x) & 0xFF)
+#define  WS2812B_VM_P_PARAM(k) WS2812B_VM_PARAM, (k)
+
+//   
+#define  WS2812B_VM_OK         0
+#define  WS2812B_VM_ERR_OPCODE 1 //      
+#define  WS2812B_VM_ERR_TRUNC  2 //      -
+#define  WS2812B_VM_ERR_STACK  3 //    
+#define  WS2812B_VM_ERR_LONG   4 //      -
+#define  WS2812B_VM_ERR_END    5 //         
+
+//   
+typedef struct
+{
+  uint8_t   op;    //  ,         WS2812B_VM_K
+  uint8_t   arg;   //    PARAM
+  int32_t   imm;   // 
+} T_WS2812B_vm_ins;
+
+//  .   ,   
+typedef struct
+{
+  uint32_t          len;   //  
+  uint32_t          depth; //   
+  T_WS2812B_vm_ins  code[WS2812B_VM_INS_MAX + 1]; //       
+} T_WS2812B_vm_prog;
+
+uint32_t WS2812B_vm_load(T_WS2812B_vm_prog *prog, const uint8_t *code, uint32_t sz);
+void     WS2812B_vm_specialize(const T_WS2812B_vm_prog *prog, T_WS2812B_vm_prog *frame, uint32_t ms, const int32_t *params);
+void     WS2812B_vm_run(const T_WS2812B_vm_prog *frame, uint32_t *dst, uint32_t n);
+
+#endif // LEDSC_WS2812B_VM_H
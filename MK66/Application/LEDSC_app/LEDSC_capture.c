@@ -0,0 +1,230 @@
+//     SD       .
+//
+//            ,
+//     ,     ,     .
+//     CAPTURE_RGB_FILE_NAME   3  R, G, B    ,
+//    , : ffmpeg -f rawvideo -pix_fmt rgb24 -s <>x1 -i Capture.rgb
+//           CAPTURE_LOG_FILE_NAME.
+//
+//     ,    -    .
+//      LEDSC_CAPTURE_SLOTS       ,  .
+//         
+#include   "App.h"
+
+typedef struct
+{
+  uint32_t  render_cycles;
+  uint32_t  compose_cycles;
+  uint32_t  pt_cycles;
+  uint32_t  encoded_leds;
+  uint32_t  skipped;       //      ,        
+  uint8_t  *rgb;           //  , 3   
+} T_capture_slot;
+
+static T_capture_slot     cap_slots[LEDSC_CAPTURE_SLOTS];
+static uint32_t          *cap_dec;        //      
+static uint32_t           cap_leds;       //  ,    
+static volatile uint32_t  cap_on;         //  
+static volatile uint32_t  cap_wr;         //      
+static volatile uint32_t  cap_rd;         //     
+static uint32_t           cap_frames;     //     
+static uint32_t           cap_fill;       //      
+static uint32_t           cap_skipped;    //        
+static T_LEDSC_capture_stat cap_stat;
+static MQX_FILE_PTR       cap_frgb;
+static MQX_FILE_PTR       cap_flog;
+
+
+/*------------------------------------------------------------------------------
+         .
+     ,       
+
+ \return uint32_t - 1   
+ ------------------------------------------------------------------------------*/
+static uint32_t LEDSC_capture_alloc(uint32_t leds)
+{
+  uint32_t i;
+
+  if (cap_leds != 0) return (cap_leds == leds);
+  cap_dec = (uint32_t *)_mem_alloc_system_zero(leds * sizeof(uint32_t));
+  if (cap_dec == 0) return 0;
+  for (i = 0; i < LEDSC_CAPTURE_SLOTS; i++)
+  {
+    cap_slots[i].rgb = (uint8_t *)_mem_alloc_system_zero(leds * 3);
+    if (cap_slots[i].rgb == 0) return 0;
+  }
+  cap_leds = leds;
+  return 1;
+}
+
+/*------------------------------------------------------------------------------
+      .
+       
+
+ \param frames -  
+
+ \return _mqx_uint
+ ------------------------------------------------------------------------------*/
+_mqx_uint LEDSC_capture_open(uint32_t frames)
+{
+  const T_WS2812B_geometry *g = WS2812B_get_geometry();
+  static const char         hdr[] = "frame,skipped,render_cycles,compose_cycles,pt_cycles,encoded_leds\r\n";
+
+  if ((cap_on != 0) || (frames == 0) || (g->leds_num == 0)) return MQX_ERROR;
+  if (LEDSC_capture_alloc(g->leds_num) == 0)
+  {
+    LOGs(__FUNCTION__, __LINE__, SEVERITY_RED, "Unable to allocate capture buffers for %d LEDs.", g->leds_num);
+    return MQX_ERROR;
+  }
+
+  cap_frgb = _io_fopen(CAPTURE_RGB_FILE_NAME, "w+");
+  cap_flog = _io_fopen(CAPTURE_LOG_FILE_NAME, "w+");
+  if ((cap_frgb == NULL) || (cap_flog == NULL))
+  {
+    LOGs(__FUNCTION__, __LINE__, SEVERITY_RED, "Capture files opening error.");
+    if (cap_frgb != NULL) _io_fclose(cap_frgb);
+    if (cap_flog != NULL) _io_fclose(cap_flog);
+    cap_frgb = NULL;
+    cap_flog = NULL;
+    return MQX_ERROR;
+  }
+  _io_write(cap_flog, (void *)hdr, sizeof(hdr) - 1);
+
+  memset(&cap_stat, 0, sizeof(cap_stat));
+  cap_frames  = frames;
+  cap_wr      = 0;
+  cap_rd      = 0;
+  cap_fill    = 0;
+  cap_skipped = WS2812B_get_stat()->skipped_frames;
+  cap_on      = 1;
+  return MQX_OK;
+}
+
+/*------------------------------------------------------------------------------
+      .      
+
+ \return uint32_t - 1       
+ ------------------------------------------------------------------------------*/
+uint32_t LEDSC_capture_write(void)
+{
+  T_capture_slot *s;
+  char            str[96];
+  int             len;
+
+  if (cap_frgb == NULL) return 0;
+  while (cap_rd != cap_wr)
+  {
+    s = &cap_slots[cap_rd % LEDSC_CAPTURE_SLOTS];
+    if (_io_write(cap_frgb, s->rgb, cap_leds * 3) != cap_leds * 3)
+    {
+      LOGs(__FUNCTION__, __LINE__, SEVERITY_RED, "File %s write error.", CAPTURE_RGB_FILE_NAME);
+      cap_on = 0;
+      return 0;
+    }
+    len = snprintf(str, sizeof(str), "%u,%u,%u,%u,%u,%u\r\n", cap_rd, s->skipped, s->render_cycles, s->compose_cycles, s->pt_cycles, s->encoded_leds);
+    _io_write(cap_flog, str, len);
+    cap_rd++; //     
+  }
+  return (cap_on != 0) || (cap_rd != cap_wr);
+}
+
+/*------------------------------------------------------------------------------
+      
+
+ \param st -  ,   0
+ ------------------------------------------------------------------------------*/
+void LEDSC_capture_close(T_LEDSC_capture_stat *st)
+{
+  cap_on = 0;
+  if (cap_frgb != NULL)
+  {
+    LEDSC_capture_write();
+    _io_fclose(cap_frgb);
+    _io_fclose(cap_flog);
+    cap_frgb = NULL;
+    cap_flog = NULL;
+  }
+  cap_stat.frames = cap_rd;
+  if (st != 0) *st = cap_stat;
+}
+
+/*------------------------------------------------------------------------------
+     .             .
+         (  FTM),    RGB    
+
+ \param out   -  
+ \param frame -   RGB
+
+ \return uint32_t -     ,      
+ ------------------------------------------------------------------------------*/
+uint32_t LEDSC_capture_frame(const T_WS2812B_backend *out, const uint32_t *frame)
+{
+  uint32_t        t;
+  uint32_t        n;
+  uint32_t        c;
+  uint8_t        *d;
+  const uint8_t (*lut)[256] = ws2812b_out_lut;
+
+  if (cap_on == 0) return 0;
+  if ((cap_wr - cap_rd) >= LEDSC_CAPTURE_SLOTS)
+  {
+    cap_stat.dropped++; //     
+    return 0;
+  }
+
+  t = Get_cycles_counter();
+  d = cap_slots[cap_wr % LEDSC_CAPTURE_SLOTS].rgb;
+  if (out->decode(cap_dec, &cap_stat.errors) == cap_leds)
+  {
+    cap_stat.decoded++;
+    for (n = 0; n < cap_leds; n++)
+    {
+      c    = cap_dec[n];
+      d[0] = (uint8_t)(c >> 16);
+      d[1] = (uint8_t)(c >> 8);
+      d[2] = (uint8_t)c;
+      d += 3;
+    }
+  }
+  else
+  {
+    //    ,       
+    for (n = 0; n < cap_leds; n++)
+    {
+      c    = frame[n];
+      d[0] = lut[2][(c >> 16) & 0xFF];
+      d[1] = lut[1][(c >> 8) & 0xFF];
+      d[2] = lut[0][c & 0xFF];
+      d += 3;
+    }
+  }
+  cap_fill = 1;
+
+  t = Get_cycles_counter() - t;
+  if (t > cap_stat.decode_max_cycles) cap_stat.decode_max_cycles = t;
+  return t;
+}
+
+/*------------------------------------------------------------------------------
+       .       
+
+ \param ws -    
+ ------------------------------------------------------------------------------*/
+void LEDSC_capture_done(const T_WS2812B_stat *ws)
+{
+  T_capture_slot *s;
+
+  if (cap_fill == 0) return;
+  cap_fill = 0;
+
+  s = &cap_slots[cap_wr % LEDSC_CAPTURE_SLOTS];
+  s->render_cycles  = ws->render_cycles;
+  s->compose_cycles = ws->compose_cycles;
+  s->pt_cycles      = ws->pt_cycles;
+  s->encoded_leds   = ws->encoded_leds;
+  s->skipped        = ws->skipped_frames - cap_skipped;
+  cap_skipped       = ws->skipped_frames;
+
+  cap_wr++; //    
+  if (cap_wr >= cap_frames) cap_on = 0;
+}
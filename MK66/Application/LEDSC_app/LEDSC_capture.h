@@ -0,0 +1,22 @@
+#ifndef LEDSC_CAPTURE_H
+#define LEDSC_CAPTURE_H
+
+#define  LEDSC_CAPTURE_SLOTS   4 //            SD 
+
+//   
+typedef struct
+{
+  uint32_t  frames;            //   
+  uint32_t  dropped;           //    -   
+  uint32_t  decoded;           //       ,     RGB   
+  uint32_t  decode_max_cycles; //         
+  uint32_t  errors;            //        
+} T_LEDSC_capture_stat;
+
+_mqx_uint LEDSC_capture_open(uint32_t frames);
+uint32_t  LEDSC_capture_write(void);
+void      LEDSC_capture_close(T_LEDSC_capture_stat *st);
+uint32_t  LEDSC_capture_frame(const T_WS2812B_backend *out, const uint32_t *frame);
+void      LEDSC_capture_done(const T_WS2812B_stat *ws);
+
+#endif // LEDSC_CAPTURE_H
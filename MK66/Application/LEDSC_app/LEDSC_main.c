@@ -6,6 +6,9 @@
 
 #define EVENT_START           BIT( 0 )
 #define EVENT_STOP            BIT( 1 )
+#define EVENT_SCRIPT          BIT( 2 ) //   
+
+#define PT_ADC_POLL_MS        20 //       
 
 
 extern uint32_t  enable_led_strip;
@@ -71,19 +74,35 @@ _mqx_uint LEDSC_wait_get_events(uint32_t *pevt, uint32_t ticks)
 -------------------------------------------------------------------------------------------------------------*/
 void LEDSC_task(void)
 {
-  uint32_t evt;
+  uint32_t   evt;
+  uint32_t   ticks;
+  T_ADC_res *adc;
+  uint32_t   level;
 
   LEDSC_create_sync_obj();
   FTM_init_PWM_DMA(FTM0_BASE_PTR); //  PWM        WS2812B
   WS2812B_Demo_DMA();
+  _task_create(0, WS2812B_RENDER_IDX, 0); //        ws2812b_fps
+  LEDSC_script_restore();
 
   MKW40_subscibe(MKW40_SUBS_CMDMAN, LEDSC_cmd_receiver, 0);
 
   enable_led_strip =1;
   do
   {
-    evt = EVENT_START + EVENT_STOP;
-    LEDSC_wait_get_events(&evt, 0); //   
+    evt = EVENT_START + EVENT_STOP + EVENT_SCRIPT;
+    //           
+    ticks = (wvar.ws2812b_pt_adc != 0) ? Conv_ms_to_ticks(PT_ADC_POLL_MS) : 0;
+    if (LEDSC_wait_get_events(&evt, ticks) != MQX_OK) evt = 0;
+
+    if ((wvar.ws2812b_pt_adc != 0) && (wvar.ws2812b_pt_adc <= sizeof(T_ADC_res) / sizeof(uint16_t)))
+    {
+      //   12     0..255.
+      //          ,     
+      Get_ADC_samples(&adc);
+      level = ((uint16_t *)adc)[wvar.ws2812b_pt_adc - 1] >> 4;
+      WS2812B_pt_level(level);
+    }
 
     if (evt & EVENT_START)
     {
@@ -93,6 +112,10 @@ void LEDSC_task(void)
     {
       enable_led_strip = 0; 
     }
+    if (evt & EVENT_SCRIPT)
+    {
+      LEDSC_script_apply();
+    }
   }
   while (1);
 
@@ -112,9 +135,13 @@ void LEDSC_task(void)
 static void LEDSC_cmd_receiver(uint8_t *data, uint32_t sz, void *ptr)
 {
   uint32_t cmd;
+  uint16_t v;
+  T_WS2812B_fx_params fxp;
+  T_WS2812B_pt_spawn  pts;
+  uint16_t            w[2];
   //   
 
-  if (sz == 4) memcpy(&cmd, data, 4);
+  if (sz >= 4) memcpy(&cmd, data, 4);
   else cmd = 0;
 
   switch (cmd)
@@ -127,6 +154,59 @@ static void LEDSC_cmd_receiver(uint8_t *data, uint32_t sz, void *ptr)
     LEDSC_set_events(EVENT_STOP);
     break;
 
+  case CMD_EFFECT:
+    //     
+    if (sz == 4 + sizeof(fxp))
+    {
+      memcpy(&fxp, data + 4, sizeof(fxp));
+      WS2812B_Set_effect(&fxp);
+    }
+    break;
+
+  case CMD_SCRIPT_BEGIN:
+    //    
+    if (sz == 4 + sizeof(v))
+    {
+      memcpy(&v, data + 4, sizeof(v));
+      LEDSC_script_begin(v);
+    }
+    break;
+
+  case CMD_SCRIPT_DATA:
+    if (sz > 4 + sizeof(v))
+    {
+      memcpy(&v, data + 4, sizeof(v));
+      LEDSC_script_data(v, data + 4 + sizeof(v), sz - 4 - sizeof(v));
+    }
+    break;
+
+  case CMD_SCRIPT_END:
+    if (sz == 4 + sizeof(v))
+    {
+      memcpy(&v, data + 4, sizeof(v));
+      if (LEDSC_script_end(v)) LEDSC_set_events(EVENT_SCRIPT);
+    }
+    break;
+
+  case CMD_SPAWN:
+    //   
+    if (sz == 4 + sizeof(pts))
+    {
+      memcpy(&pts, data + 4, sizeof(pts));
+      WS2812B_Spawn_particles(&pts);
+    }
+    break;
+
+  case CMD_EMITTER:
+    //  :  ,     
+    if (sz == 4 + sizeof(pts) + sizeof(w))
+    {
+      memcpy(&pts, data + 4, sizeof(pts));
+      memcpy(w, data + 4 + sizeof(pts), sizeof(w));
+      WS2812B_Set_emitter(&pts, w[0], w[1]);
+    }
+    break;
+
   case 0:
     //  
 
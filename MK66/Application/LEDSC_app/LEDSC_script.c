@@ -0,0 +1,175 @@
+//    WS2812B_FX_SCRIPT        SD .
+// -      Task_MKW40   . ,   
+//      LEDSC_task,         MKW40
+#include   "App.h"
+
+#define SCRIPT_IDLE   0 //  
+#define SCRIPT_RECV   1 //   -
+#define SCRIPT_READY  2 // -      LEDSC_task
+
+static uint8_t            script_buf[WS2812B_VM_CODE_MAX]; //   -
+static uint32_t           script_sz;    //   -
+static uint32_t           script_rcv;   //   
+static volatile uint32_t  script_state;
+static T_WS2812B_vm_prog  script_prog;  //  .     LEDSC_task
+
+
+/*------------------------------------------------------------------------------
+    .    .
+      Task_MKW40
+
+ \param sz -  -
+ ------------------------------------------------------------------------------*/
+void LEDSC_script_begin(uint32_t sz)
+{
+  if (script_state == SCRIPT_READY) return; //     
+  if ((sz == 0) || (sz > WS2812B_VM_CODE_MAX))
+  {
+    script_state = SCRIPT_IDLE;
+    return;
+  }
+  script_sz    = sz;
+  script_rcv   = 0;
+  script_state = SCRIPT_RECV;
+}
+
+/*------------------------------------------------------------------------------
+    -.    ,    .
+      Task_MKW40
+
+ \param offs -    -
+ \param data -  
+ \param len  -  
+ ------------------------------------------------------------------------------*/
+void LEDSC_script_data(uint32_t offs, const uint8_t *data, uint32_t len)
+{
+  if (script_state != SCRIPT_RECV) return;
+  if ((offs != script_rcv) || (len > script_sz - script_rcv))
+  {
+    script_state = SCRIPT_IDLE;
+    return;
+  }
+  memcpy(script_buf + offs, data, len);
+  script_rcv += len;
+}
+
+/*------------------------------------------------------------------------------
+   .    CRC  -.
+      Task_MKW40
+
+ \param crc - CRC CCITT -
+
+ \return uint32_t - 1  -     LEDSC_script_apply
+ ------------------------------------------------------------------------------*/
+uint32_t LEDSC_script_end(uint16_t crc)
+{
+  if (script_state != SCRIPT_RECV) return 0;
+  if ((script_rcv != script_sz) || (Get_CCITT_CRC_of_block(script_buf, script_sz, 0xFFFF) != crc))
+  {
+    LOGs(__FUNCTION__, __LINE__, SEVERITY_RED, "Effect script transfer error. Received %d of %d bytes.", script_rcv, script_sz);
+    script_state = SCRIPT_IDLE;
+    return 0;
+  }
+  script_state = SCRIPT_READY;
+  return 1;
+}
+
+/*------------------------------------------------------------------------------
+   -    EFFECT_SCRIPT_FILE_NAME
+
+ \param code - -
+ \param sz   -  -
+
+ \return _mqx_uint
+ ------------------------------------------------------------------------------*/
+static _mqx_uint LEDSC_script_save(const uint8_t *code, uint32_t sz)
+{
+  MQX_FILE_PTR       f;
+  T_LEDSC_script_hdr hdr;
+  _mqx_int           res;
+
+  hdr.magic = LEDSC_SCRIPT_MAGIC;
+  hdr.sz    = (uint16_t)sz;
+  hdr.crc   = Get_CCITT_CRC_of_block((void *)code, sz, 0xFFFF);
+
+  f = _io_fopen(EFFECT_SCRIPT_FILE_NAME, "w+");
+  if (f == NULL)
+  {
+    LOGs(__FUNCTION__, __LINE__, SEVERITY_RED, "File %s opening error.", EFFECT_SCRIPT_FILE_NAME);
+    return MQX_ERROR;
+  }
+  res = _io_write(f, &hdr, sizeof(hdr));
+  if (res == sizeof(hdr)) res = _io_write(f, (void *)code, sz);
+  _io_fclose(f);
+  if (res != sz)
+  {
+    LOGs(__FUNCTION__, __LINE__, SEVERITY_RED, "File %s write error %d.", EFFECT_SCRIPT_FILE_NAME, res);
+    return MQX_ERROR;
+  }
+  return MQX_OK;
+}
+
+/*------------------------------------------------------------------------------
+      ,    .
+     LEDSC_task   LEDSC_script_end
+ ------------------------------------------------------------------------------*/
+void LEDSC_script_apply(void)
+{
+  uint32_t res;
+
+  if (script_state != SCRIPT_READY) return;
+  res = WS2812B_vm_load(&script_prog, script_buf, script_sz);
+  if (res == WS2812B_VM_OK)
+  {
+    WS2812B_Set_script(&script_prog);
+    if (LEDSC_script_save(script_buf, script_sz) == MQX_OK)
+    {
+      LOGs(__FUNCTION__, __LINE__, SEVERITY_DEFAULT, "Effect script loaded. %d bytes, %d instructions.", script_sz, script_prog.len);
+    }
+  }
+  else
+  {
+    LOGs(__FUNCTION__, __LINE__, SEVERITY_RED, "Effect script rejected. Error %d.", res);
+  }
+  script_state = SCRIPT_IDLE;
+}
+
+/*------------------------------------------------------------------------------
+        .
+     LEDSC_task
+
+ \return _mqx_uint
+ ------------------------------------------------------------------------------*/
+_mqx_uint LEDSC_script_restore(void)
+{
+  MQX_FILE_PTR       f;
+  T_LEDSC_script_hdr hdr;
+  _mqx_int           res;
+  uint32_t           err;
+
+  f = _io_fopen(EFFECT_SCRIPT_FILE_NAME, "r");
+  if (f == NULL) return MQX_ERROR; //    
+
+  res = _io_read(f, &hdr, sizeof(hdr));
+  if ((res != sizeof(hdr)) || (hdr.magic != LEDSC_SCRIPT_MAGIC) || (hdr.sz > WS2812B_VM_CODE_MAX))
+  {
+    _io_fclose(f);
+    LOGs(__FUNCTION__, __LINE__, SEVERITY_RED, "File %s format error.", EFFECT_SCRIPT_FILE_NAME);
+    return MQX_ERROR;
+  }
+  res = _io_read(f, script_buf, hdr.sz);
+  _io_fclose(f);
+  if ((res != hdr.sz) || (Get_CCITT_CRC_of_block(script_buf, hdr.sz, 0xFFFF) != hdr.crc))
+  {
+    LOGs(__FUNCTION__, __LINE__, SEVERITY_RED, "File %s CRC error.", EFFECT_SCRIPT_FILE_NAME);
+    return MQX_ERROR;
+  }
+  err = WS2812B_vm_load(&script_prog, script_buf, hdr.sz);
+  if (err != WS2812B_VM_OK)
+  {
+    LOGs(__FUNCTION__, __LINE__, SEVERITY_RED, "Effect script from %s rejected. Error %d.", EFFECT_SCRIPT_FILE_NAME, err);
+    return MQX_ERROR;
+  }
+  WS2812B_Set_script(&script_prog);
+  return MQX_OK;
+}
@@ -0,0 +1,20 @@
+#ifndef LEDSC_SCRIPT_H
+#define LEDSC_SCRIPT_H
+
+#define  LEDSC_SCRIPT_MAGIC   0x314D564C // "LVM1" -    
+
+//    .    -
+typedef struct
+{
+  uint32_t  magic;
+  uint16_t  sz;    //  -
+  uint16_t  crc;   // CRC CCITT -    0xFFFF
+} T_LEDSC_script_hdr;
+
+void      LEDSC_script_begin(uint32_t sz);
+void      LEDSC_script_data(uint32_t offs, const uint8_t *data, uint32_t len);
+uint32_t  LEDSC_script_end(uint16_t crc);
+void      LEDSC_script_apply(void);
+_mqx_uint LEDSC_script_restore(void);
+
+#endif // LEDSC_SCRIPT_H
@@ -21,6 +21,12 @@
 //  
   #define  CMD_START                0x00000002
   #define  CMD_STOP                0x00000003
+  #define  CMD_EFFECT              0x00000004 //       T_WS2812B_fx_params
+  #define  CMD_SCRIPT_BEGIN        0x00000005 //    .      - uint16
+  #define  CMD_SCRIPT_DATA         0x00000006 //  -.      uint16   
+  #define  CMD_SCRIPT_END          0x00000007 //  .     CRC CCITT - uint16
+  #define  CMD_SPAWN               0x00000008 //  .      T_WS2812B_pt_spawn
+  #define  CMD_EMITTER             0x00000009 //  .     T_WS2812B_pt_spawn,  uint16   uint16
 
 
 typedef void (*T_MKW40_receiver)(uint8_t *data, uint32_t sz, void *ptr);
@@ -18,6 +18,7 @@ const TASK_TEMPLATE_STRUCT  MQX_template_list[] =
   { FILELOG_IDX,        Task_file_log,      1500,   FILELOG_ID_PRIO,           "FileLog",    MQX_TIME_SLICE_TASK,                                                 0,     2 },
   { SHELL_IDX,          Task_shell,         2000,   SHELL_ID_PRIO,             "Shell",      MQX_TIME_SLICE_TASK,                                                 0,     2 },
   { SUPERVISOR_IDX,     Task_supervisor,    500,    SUPRVIS_ID_PRIO,           "SUPRVIS",    MQX_TIME_SLICE_TASK,                                                 0,     2 },
+  { WS2812B_RENDER_IDX, Task_WS2812B_render, WS2812B_RENDER_STACK, WS2812B_RENDER_PRIO,       "WS2812B",    0,                                                                   0,     0 },
   { BACKGR_IDX,         Task_background,    1000,   BACKGR_ID_PRIO,            "BACKGR",     MQX_FLOATING_POINT_TASK,                                             0,     0 },
   { 0 }
 };
@@ -9,6 +9,7 @@ static void        FTM1_isr(void *user_isr_ptr);
 static T_qdec_isr  qdec_isr;
 
 #define QDEC_CNT_MOD 4
+//#define FTM3_TOF_ISR   //   FTM3.   ADC   
 
 
 /*-------------------------------------------------------------------------------------------------------------
@@ -37,6 +38,7 @@ static void FTM1_isr(void *user_isr_ptr)
  
             
 -------------------------------------------------------------------------------------------------------------*/
+#ifdef FTM3_TOF_ISR
 static void FTM3_isr(void *user_isr_ptr)
 {
   FTM_MemMapPtr FTM3 = FTM3_BASE_PTR;
@@ -55,6 +57,7 @@ static void FTM3_isr(void *user_isr_ptr)
 //  }
 
 }
+#endif
 
 /*------------------------------------------------------------------------------
    FTM1       
@@ -695,7 +698,9 @@ void FTM3_init_motor_PWM(void)
   FTM->CONTROLS[6].CnV = 0;
   FTM->CONTROLS[7].CnV = 0;
 
-  //  Install_and_enable_isr(INT_FTM3, FTM3_ISR_PRIO, FTM3_isr);
+#ifdef FTM3_TOF_ISR
+  Install_and_enable_isr(INT_FTM3, FTM3_ISR_PRIO, FTM3_isr);
+#endif
   //   
   FTM->SC = sc_reg | LSHIFT(1, 3); // CLKS  | 01 System clock;
 
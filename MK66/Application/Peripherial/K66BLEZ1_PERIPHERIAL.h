@@ -64,11 +64,41 @@
 
 // -----------------------------------------------------------------------------
 //     DMA  DMA MUX       LED    WS2812B
-//   DMA   
+//   DMA        
 
 #define DMA_WS2812B_DMUX_PTR    DMAMUX_BASE_PTR   //    DMUX        SPI  DMA
 #define DMA_WS2812B_DMUX_SRC    DMUX_SRC_FTM0_CH2 //  DMUX      DMA
 #define DMA_WS2812B_CH          4                 //  DMA     WS2812B
+#define DMA_WS2812B_INT_NUM     INT_DMA4_DMA20    //      DMA     WS2812B
+//  DMA         FTM0.       
+#define DMA_WS2812B_CH1         6
+#define DMA_WS2812B_CH2         7
+#define DMA_WS2812B_CH3         8
+#define DMA_WS2812B_CH4         9
+#define DMA_WS2812B_CH5         10
+#define DMA_WS2812B_CH6         11
+#define DMA_WS2812B_CH7         12
+
+//       GPIO.  DMA   FTM0  ,
+//      FTM0 5..7     
+#define WS2812B_GPIO_PTR          PTD_BASE_PTR    //   .   -   
+#define WS2812B_GPIO_LANES_MASK   0xFE            //  PTD1..PTD7. PTD0   INH_A
+#define WS2812B_GPIO_FTM_SET_CH   FTM_CH_5        //  FTM0       
+#define WS2812B_GPIO_FTM_DAT_CH   FTM_CH_6        //  FTM0      T0H
+#define WS2812B_GPIO_FTM_CLR_CH   FTM_CH_7        //  FTM0      T1H
+#define DMA_WS2812B_GPIO_SET_CH   13              //  DMA     PSOR
+#define DMA_WS2812B_GPIO_DAT_CH   14              //  DMA     PDOR
+#define DMA_WS2812B_GPIO_CLR_CH   15              //  DMA     PCOR
+#define DMA_WS2812B_GPIO_INT_NUM  INT_DMA15_DMA31 //      
+
+//     DSPI.    SOUT, SCK  PCS    
+#define WS2812B_SPI               SPI0            //  SPI 
+#define WS2812B_SPI_SOUT_PORT     PORTA_BASE_PTR  //   SOUT
+#define WS2812B_SPI_SOUT_PIN      16              // PTA16 - SPI0_SOUT
+#define WS2812B_SPI_SOUT_MUX      2               // ALT2
+#define DMA_WS2812B_SPI_CH        19              //  DMA     SPI. ->FIFO.
+#define DMA_WS2812B_SPI_DMUX_SRC  DMUX_SRC_SPI0_TX //  DMUX      DMA
+#define DMA_WS2812B_SPI_INT_NUM   INT_DMA3_DMA19  //      
 
 
 #ifdef ADC_GLOBAL
@@ -1,5 +1,8 @@
 #include "App.h"
 
+static T_pit_isr pit1_isr;
+static T_pit_isr pit2_isr;
+
 /*-------------------------------------------------------------------------------------------------------------
     Periodic Interrupt Timer (PIT)
      PIT        ADC
@@ -60,3 +63,121 @@ uint32_t Get_PIT0_load_val(void)
 }
 
 
+/*-------------------------------------------------------------------------------------------------------------
+     1  PIT
+-------------------------------------------------------------------------------------------------------------*/
+static void PIT1_isr(void *user_isr_ptr)
+{
+  PIT_MemMapPtr PIT = PIT_BASE_PTR;
+
+  PIT->CHANNEL[1].TFLG = BIT(0); //   TIF
+  if (pit1_isr != 0) pit1_isr();
+}
+
+/*-------------------------------------------------------------------------------------------------------------
+     1  PIT  
+           .
+         
+
+   period -    
+   isr    -     
+
+      Bus Clock -> CPU_BUS_CLK_HZ = 60 
+ -------------------------------------------------------------------------------------------------------------*/
+void Init_PIT1(uint32_t period, T_pit_isr isr)
+{
+  PIT_MemMapPtr PIT = PIT_BASE_PTR;
+
+  PIT->CHANNEL[1].TCTRL = 0; //     
+  pit1_isr = isr;
+  // Timer Load Value Register.   LDVAL + 1 
+  PIT->CHANNEL[1].LDVAL = (CPU_BUS_CLK_HZ/1000000ul) * period - 1;
+  PIT->CHANNEL[1].TFLG  = BIT(0);
+  Install_and_enable_isr(INT_PIT1, PIT1_ISR_PRIO, PIT1_isr);
+
+  PIT->CHANNEL[1].TCTRL = 0
+    + LSHIFT(1, 1) // TIE | Timer Interrupt Enable Bit. | 1 Interrupt will be requested whenever TIF is set.
+    + LSHIFT(1, 0) // TEN | Timer Enable Bit.           | 1 Timer n is active.
+;
+}
+
+/*-------------------------------------------------------------------------------------------------------------
+      1  PIT,  Init_PIT1.
+     LDVAL:        .
+    Stop_PIT1   
+
+   period -    
+ -------------------------------------------------------------------------------------------------------------*/
+void Set_PIT1_period(uint32_t period)
+{
+  PIT_MemMapPtr PIT = PIT_BASE_PTR;
+
+  PIT->CHANNEL[1].LDVAL = (CPU_BUS_CLK_HZ/1000000ul) * period - 1;
+  if ((PIT->CHANNEL[1].TCTRL & BIT(0)) == 0)
+  {
+    PIT->CHANNEL[1].TFLG  = BIT(0);
+    PIT->CHANNEL[1].TCTRL = 0
+      + LSHIFT(1, 1) // TIE | Timer Interrupt Enable Bit. | 1 Interrupt will be requested whenever TIF is set.
+      + LSHIFT(1, 0) // TEN | Timer Enable Bit.           | 1 Timer n is active.
+;
+  }
+}
+
+/*-------------------------------------------------------------------------------------------------------------
+     1  PIT
+ -------------------------------------------------------------------------------------------------------------*/
+void Stop_PIT1(void)
+{
+  PIT_MemMapPtr PIT = PIT_BASE_PTR;
+
+  PIT->CHANNEL[1].TCTRL = 0;
+  PIT->CHANNEL[1].TFLG  = BIT(0);
+}
+
+
+/*-------------------------------------------------------------------------------------------------------------
+     2  PIT.       
+-------------------------------------------------------------------------------------------------------------*/
+static void PIT2_isr(void *user_isr_ptr)
+{
+  PIT_MemMapPtr PIT = PIT_BASE_PTR;
+
+  PIT->CHANNEL[2].TCTRL = 0;
+  PIT->CHANNEL[2].TFLG  = BIT(0); //   TIF
+  if (pit2_isr != 0) pit2_isr();
+}
+
+/*-------------------------------------------------------------------------------------------------------------
+     2  PIT   
+            .
+        Start_PIT2
+
+   isr    -     
+ -------------------------------------------------------------------------------------------------------------*/
+void Init_PIT2(T_pit_isr isr)
+{
+  PIT_MemMapPtr PIT = PIT_BASE_PTR;
+
+  PIT->CHANNEL[2].TCTRL = 0;
+  pit2_isr = isr;
+  PIT->CHANNEL[2].TFLG  = BIT(0);
+  Install_and_enable_isr(INT_PIT2, PIT2_ISR_PRIO, PIT2_isr);
+}
+
+/*-------------------------------------------------------------------------------------------------------------
+       2  PIT.   
+
+   cnt -      CPU_BUS_CLK_HZ
+ -------------------------------------------------------------------------------------------------------------*/
+void Start_PIT2(uint32_t cnt)
+{
+  PIT_MemMapPtr PIT = PIT_BASE_PTR;
+
+  PIT->CHANNEL[2].TCTRL = 0;       //   LDVAL  
+  PIT->CHANNEL[2].LDVAL = cnt - 1; //   LDVAL + 1 
+  PIT->CHANNEL[2].TFLG  = BIT(0);
+  PIT->CHANNEL[2].TCTRL = 0
+    + LSHIFT(1, 1) // TIE | Timer Interrupt Enable Bit. | 1 Interrupt will be requested whenever TIF is set.
+    + LSHIFT(1, 0) // TEN | Timer Enable Bit.           | 1 Timer n is active.
+;
+}
@@ -2,9 +2,16 @@
   #define __K66BLEZ_PIT
 
 
+typedef void (*T_pit_isr)(void);
+
 void     Init_PIT_module(void);
 void     Init_PIT0(uint32_t period);
 uint32_t Get_PIT0_curr_val(void);
 uint32_t Get_PIT0_load_val(void);
+void     Init_PIT1(uint32_t period, T_pit_isr isr);
+void     Set_PIT1_period(uint32_t period);
+void     Stop_PIT1(void);
+void     Init_PIT2(T_pit_isr isr);
+void     Start_PIT2(uint32_t cnt);
 
 #endif
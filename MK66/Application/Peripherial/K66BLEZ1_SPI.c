@@ -145,6 +145,8 @@ void SPI_master_init(uint8_t modn, T_SPI_bits fsz, uint8_t cpol, uint8_t cpha, T
     pbr = PBR_5; br = BR_6; pcssck = PCSSCK_3; cssck = CSSCK_2;  break;   //
   case SPI_BAUD_3MHZ  :
     pbr = PBR_5; br = BR_8; pcssck = PCSSCK_5; cssck = CSSCK_2;  break;   //
+  case SPI_BAUD_3_3MHZ :
+    dbr = 0; pbr = PBR_3; br = BR_6; pcssck = PCSSCK_5; cssck = CSSCK_2;  break;   // 60  / 3 / 6 = 3.33 ,  
   case SPI_BAUD_1_5MHZ :
     pbr = PBR_5; br = BR_16; pcssck = PCSSCK_5; cssck = CSSCK_4;  break;   //
   }
@@ -320,7 +322,6 @@ void SPI_push_data(uint8_t modn, uint32_t cs, uint16_t data)
 _mqx_uint SPI_wait_tx_complete(uint8_t modn, uint16_t *pdata, _mqx_uint ticks)
 {
   SPI_MemMapPtr  SPI   = spi_mods[modn].spi;
-  static uint16_t dummy;
 
   if (_lwevent_wait_ticks(&spi_cbl[modn].spi_event, SPI_TX_COMPLETE, FALSE, ticks) != MQX_OK)
   {
@@ -328,7 +329,7 @@ _mqx_uint SPI_wait_tx_complete(uint8_t modn, uint16_t *pdata, _mqx_uint ticks)
     return  MQX_ERROR;
   }
   if (pdata != 0) *pdata = SPI->POPR;
-  else dummy = SPI->POPR;
+  else (void)SPI->POPR; //      FIFO
 
   return MQX_OK;
 }
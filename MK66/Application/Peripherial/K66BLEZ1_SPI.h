@@ -61,6 +61,7 @@ typedef enum
   SPI_BAUD_4MHZ   ,
   SPI_BAUD_1_5MHZ,
   SPI_BAUD_3MHZ ,
+  SPI_BAUD_3_3MHZ ,
 
 } T_SPI_bauds;
 
@@ -30,7 +30,6 @@ void Task_supervisor(unsigned int initial_data)
     }
 
     LEDS_state_automat();
-    WS2812B_periodic_refresh();
 
 
     tps = _time_get_ticks_per_sec();
@@ -71,4 +71,14 @@ uint32_t  Get_usage_time(void)
   return Eval_meas_time(t1,t2);
 }
 
+/*-------------------------------------------------------------------------------------------------------------
+        DWT
+         .
+    :    ,      
+-------------------------------------------------------------------------------------------------------------*/
+void Cycles_counter_init(void)
+{
+  DEMCR |= BIT(24);    // TRCENA.    DWT  ITM
+  DWT_CTRL |= BIT(0);  // CYCCNTENA.   
+}
 
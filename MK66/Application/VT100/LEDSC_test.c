@@ -0,0 +1,1685 @@
+#include "App.h"
+#include "LEDSC_test.h"
+
+#if defined(LEDSC_APP) && defined(LEDSC_TEST)
+
+  #define TEST_LEDS_NUM     122    //       
+  #define TEST_PASSES       16     //   .      
+  #define TEST_RAND_COLORS  100000 //         
+  #define TEST_RAMP_SEGMENTS 1000  //           
+  #define TEST_RAMP_MAX_TICKS 2000 //       
+  #define TEST_RAMP_EXACT_TICKS 256 //     Q16      
+  #define TEST_TRP_STRIP_LEDS 64     //      8-    
+  #define TEST_TRP_FRAMES     200    //          
+  #define TEST_DEC_FRAMES     200    //         
+  #define TEST_HSV_SAT        200    //      HSV -> RGB
+  #define TEST_HSV_VAL        180    //      HSV -> RGB
+  #define TEST_PAL_FRAMES     200    //        
+  #define TEST_PAL_BLEND      16     //          Q8
+  #define TEST_COMP_LEDS      1000   //      
+  #define TEST_COMP_LAYERS    3      //      
+  #define TEST_COMP_PASSES    20     //           
+  #define TEST_VM_FPS         60     //        
+  #define TEST_PT_FRAMES      2000   //     
+  #define TEST_PT_FRAME_MS    16     //       
+  #define TEST_NOISE_SAMPLES  20000  //        
+  #define TEST_NOISE_ROWS     50     //        
+  #define TEST_NOISE_ERR_MAX  64     //     
+
+#ifdef __ICCARM__
+#pragma data_alignment= 4
+#endif
+static uint16_t ref_buf[TEST_LEDS_NUM][WS2812B_BITS_PER_LED_MAX];
+#ifdef __ICCARM__
+#pragma data_alignment= 4
+#endif
+static uint16_t tst_buf[TEST_LEDS_NUM][WS2812B_BITS_PER_LED_MAX];
+
+static T_WS2812B_ramp ramps[TEST_LEDS_NUM];
+static uint32_t       ramp_res[TEST_LEDS_NUM];
+
+static uint32_t       trp_frame[WS2812B_LANES * TEST_TRP_STRIP_LEDS];
+static uint32_t       trp_ref[TEST_TRP_STRIP_LEDS * WS2812B_LANE_BYTES_PER_LED / 4];
+static uint32_t       trp_tst[TEST_TRP_STRIP_LEDS * WS2812B_LANE_BYTES_PER_LED / 4];
+
+static uint32_t       dec_frame[TEST_LEDS_NUM];
+static uint32_t       spi_buf[TEST_LEDS_NUM][WS2812B_SPI_BYTES_PER_LED_MAX / 4];
+
+static uint8_t        pal_test_idx[WS2812B_LEDS_MAX];
+static uint32_t       comp_src[TEST_COMP_LAYERS][TEST_COMP_LEDS];
+static uint32_t       comp_tst[TEST_COMP_LEDS];
+static uint32_t       comp_ref[TEST_COMP_LEDS];
+static uint8_t        fx_test_heat[TEST_COMP_LEDS];
+static T_WS2812B_fx   fx_test;
+static uint32_t       pal_test_fire[256];
+static T_WS2812B_vm_prog vm_test_prog;
+static T_WS2812B_pt_pool pt_test_pool;
+static int16_t        noise_test_row[TEST_COMP_LEDS];
+
+// : h = i * 360 / width + ((ms * speed) >> 6), s = sat, v = val
+static const uint8_t  vm_test_rainbow[] =
+{
+  WS2812B_VM_LED, WS2812B_VM_P_PUSH(360), WS2812B_VM_MUL, WS2812B_VM_P_PARAM(5), WS2812B_VM_DIV,
+  WS2812B_VM_TIME, WS2812B_VM_P_PARAM(0), WS2812B_VM_MUL, WS2812B_VM_P_PUSH8(6), WS2812B_VM_SHR, WS2812B_VM_ADD,
+  WS2812B_VM_P_PARAM(2), WS2812B_VM_P_PARAM(3),
+  WS2812B_VM_HSV
+};
+
+//  : h = hue * 360 / 256, s = sat, v = 128 + 127 * sin(i / 32 + ms * speed / 65536)    RND
+static const uint8_t  vm_test_waves[] =
+{
+  WS2812B_VM_P_PARAM(1), WS2812B_VM_P_PUSH(360), WS2812B_VM_MUL, WS2812B_VM_P_PUSH8(8), WS2812B_VM_SHR,
+  WS2812B_VM_P_PARAM(2),
+  WS2812B_VM_LED, WS2812B_VM_P_PUSH(2048), WS2812B_VM_MUL, WS2812B_VM_TIME, WS2812B_VM_P_PARAM(0), WS2812B_VM_MUL, WS2812B_VM_ADD,
+  WS2812B_VM_SIN, WS2812B_VM_P_PUSH8(127), WS2812B_VM_MULQ, WS2812B_VM_P_PUSH(128), WS2812B_VM_ADD,
+  WS2812B_VM_LED, WS2812B_VM_TIME, WS2812B_VM_P_PUSH8(7), WS2812B_VM_SHR, WS2812B_VM_P_PUSH(1000), WS2812B_VM_MUL, WS2812B_VM_ADD,
+  WS2812B_VM_RND, WS2812B_VM_P_PUSH8(5), WS2812B_VM_SHR, WS2812B_VM_P_PUSH(1024), WS2812B_VM_SUB, WS2812B_VM_P_PUSH8(0), WS2812B_VM_MAX,
+  WS2812B_VM_ADD,
+  WS2812B_VM_HSV
+};
+
+static uint32_t       test_failures; //        LEDSC_test_failures
+
+extern const uint8_t dim_curve[256];
+
+/*-------------------------------------------------------------------------------------------------------------
+    .         0
+      
+-------------------------------------------------------------------------------------------------------------*/
+static uint32_t Test_check(uint32_t err)
+{
+  if (err != 0) test_failures++;
+  return err;
+}
+
+/*-------------------------------------------------------------------------------------------------------------
+           .  
+-------------------------------------------------------------------------------------------------------------*/
+uint32_t LEDSC_test_failures(void)
+{
+  uint32_t n = test_failures;
+
+  test_failures = 0;
+  return n;
+}
+
+/*-------------------------------------------------------------------------------------------------------------
+               
+-------------------------------------------------------------------------------------------------------------*/
+static uint32_t Ref_correct_rgb(uint32_t rgb)
+{
+  uint32_t scale[WS2812B_COLRS_MAX];
+  uint32_t c;
+  uint32_t b;
+  uint32_t res = 0;
+
+  scale[0] = wvar.ws2812b_wb_blue;
+  scale[1] = wvar.ws2812b_wb_green;
+  scale[2] = wvar.ws2812b_wb_red;
+  scale[3] = 255;
+  for (c = 0; c < WS2812B_COLRS_MAX; c++)
+  {
+    b = (rgb >> (c * 8)) & 0xFF;
+    b = dim_curve[(b * wvar.ws2812b_brightness + 127) / 255];
+    b = (b * scale[c] + 127) / 255;
+    res |= b << (c * 8);
+  }
+  return res;
+}
+
+/*-------------------------------------------------------------------------------------------------------------
+         PWM
+     WS2812B_set_led_state          
+-------------------------------------------------------------------------------------------------------------*/
+static void Ref_encode_rgb(uint16_t *dst, uint32_t rgb)
+{
+  const T_WS2812B_geometry *g = WS2812B_get_geometry();
+  uint32_t i, c;
+  uint8_t  b;
+
+  rgb = Ref_correct_rgb(rgb);
+  for (c = 0; c < g->colrs; c++)
+  {
+    b = (rgb >> g->shift[c]) & 0xFF;
+    for (i = 0; i < 8; i++)
+    {
+      if ((b >> (7 - i)) & 1) dst[c * 8 + i] = FTM_WS2812B_1;
+      else dst[c * 8 + i] = FTM_WS2812B_0;
+    }
+  }
+}
+
+/*-------------------------------------------------------------------------------------------------------------
+         
+   1  
+-------------------------------------------------------------------------------------------------------------*/
+static uint32_t Check_encoded_color(uint32_t rgb)
+{
+  Ref_encode_rgb(ref_buf[0], rgb);
+  WS2812B_encode_rgb(tst_buf[0], rgb);
+  if (memcmp(ref_buf[0], tst_buf[0], WS2812B_get_geometry()->bits_per_led * sizeof(uint16_t)) != 0) return 1;
+  return 0;
+}
+
+/*-------------------------------------------------------------------------------------------------------------
+          .
+   0      
+-------------------------------------------------------------------------------------------------------------*/
+static uint32_t Test_color_mask(T_monitor_cbl *pvt100_cb)
+{
+  const T_WS2812B_geometry *g = WS2812B_get_geometry();
+
+  if (g->colrs == 0)
+  {
+    pvt100_cb->_printf("LED strip output is not initialized\r\n");
+    Test_check(1);
+    return 0;
+  }
+  pvt100_cb->_printf("LEDs %d, strips %d, color order %d\r\n", g->leds_num, g->strips_num, g->order);
+  if (g->colrs > 3) return 0xFFFFFFFF;
+  return 0x00FFFFFF;
+}
+
+/*-------------------------------------------------------------------------------------------------------------
+     WS2812B      
+            
+-------------------------------------------------------------------------------------------------------------*/
+void LEDSC_test_encoder(void)
+{
+  uint32_t       i, n;
+  uint32_t       rgb;
+  uint32_t       err_cnt = 0;
+  uint32_t       t;
+  uint32_t       ref_min = 0xFFFFFFFF;
+  uint32_t       tst_min = 0xFFFFFFFF;
+  uint32_t       mask;
+  T_monitor_cbl *pvt100_cb;
+  pvt100_cb = (T_monitor_cbl *)_task_get_environment(_task_get_id());
+
+  pvt100_cb->_printf("\r\n--------- WS2812B encoder test ---------\r\n");
+  mask = Test_color_mask(pvt100_cb);
+  if (mask == 0) return;
+
+  //      
+  for (i = 0; i < 256; i++)
+  {
+    err_cnt += Check_encoded_color((i << 24) & mask);
+    err_cnt += Check_encoded_color(i << 16);
+    err_cnt += Check_encoded_color(i << 8);
+    err_cnt += Check_encoded_color(i);
+  }
+  //  
+  srand(1);
+  for (i = 0; i < TEST_RAND_COLORS; i++)
+  {
+    rgb = ((rand() << 16) ^ (rand() << 8) ^ rand()) & mask;
+    err_cnt += Check_encoded_color(rgb);
+  }
+  pvt100_cb->_printf("Golden output mismatches : %d\r\n", Test_check(err_cnt));
+
+  //  
+  Cycles_counter_init();
+  for (n = 0; n < TEST_PASSES; n++)
+  {
+    t = Get_cycles_counter();
+    for (i = 0; i < TEST_LEDS_NUM; i++)
+    {
+      Ref_encode_rgb(ref_buf[i], i * 0x020305);
+    }
+    t = Get_cycles_counter() - t;
+    if (t < ref_min) ref_min = t;
+
+    t = Get_cycles_counter();
+    for (i = 0; i < TEST_LEDS_NUM; i++)
+    {
+      WS2812B_encode_rgb(tst_buf[i], i * 0x020305);
+    }
+    t = Get_cycles_counter() - t;
+    if (t < tst_min) tst_min = t;
+  }
+  pvt100_cb->_printf("Bitwise encoder          : %d cycles per LED\r\n", ref_min / TEST_LEDS_NUM);
+  pvt100_cb->_printf("Table encoder            : %d cycles per LED\r\n", tst_min / TEST_LEDS_NUM);
+}
+
+/*-------------------------------------------------------------------------------------------------------------
+        .
+     WS2812B_state_automat     .
+  cnt -   
+-------------------------------------------------------------------------------------------------------------*/
+static int32_t Ref_ramp_chan(int32_t from, int32_t to, uint32_t cnt, uint32_t duration)
+{
+  return to - ((to - from) * (int32_t)cnt) / (int32_t)duration;
+}
+
+/*-------------------------------------------------------------------------------------------------------------
+          
+-------------------------------------------------------------------------------------------------------------*/
+static uint32_t Ref_ramp_hsv(uint32_t prev_hsv, uint32_t hsv, uint32_t cnt, uint32_t duration)
+{
+  uint32_t hue;
+  uint32_t sat;
+  uint32_t val;
+
+  hue = Ref_ramp_chan((prev_hsv >> 16) & 0x1FF, (hsv >> 16) & 0x1FF, cnt, duration);
+  sat = Ref_ramp_chan((prev_hsv >> 8) & 0xFF, (hsv >> 8) & 0xFF, cnt, duration);
+  val = Ref_ramp_chan(prev_hsv & 0xFF, hsv & 0xFF, cnt, duration);
+  return (hue << 16) | (sat << 8) | val;
+}
+
+/*-------------------------------------------------------------------------------------------------------------
+    .      
+-------------------------------------------------------------------------------------------------------------*/
+static uint32_t Ramp_diff(int32_t a, int32_t b, uint32_t is_hue)
+{
+  int32_t d;
+
+  d = a - b;
+  if (d < 0) d = -d;
+  if (is_hue && (d > 180)) d = 360 - d;
+  return d;
+}
+
+/*-------------------------------------------------------------------------------------------------------------
+        Q16       
+             .
+
+         , ..      .
+     TEST_RAMP_EXACT_TICKS     ,
+           -  
+-------------------------------------------------------------------------------------------------------------*/
+void LEDSC_test_ramp(void)
+{
+  uint32_t       i, k, n;
+  uint32_t       from, to, dur, hsv;
+  int32_t        h0, h1;
+  uint32_t       d, max_d = 0;
+  uint32_t       steps = 0;
+  uint32_t       lsb_cnt = 0;
+  uint32_t       err_cnt = 0;
+  uint32_t       exact_cnt = 0;
+  uint32_t       t;
+  uint32_t       ref_min = 0xFFFFFFFF;
+  uint32_t       tst_min = 0xFFFFFFFF;
+  T_monitor_cbl *pvt100_cb;
+  pvt100_cb = (T_monitor_cbl *)_task_get_environment(_task_get_id());
+
+  pvt100_cb->_printf("\r\n--------- WS2812B ramp test ---------\r\n");
+
+  srand(2);
+  for (i = 0; i < TEST_RAMP_SEGMENTS; i++)
+  {
+    from = ((rand() % 360) << 16) | ((rand() & 0xFF) << 8) | (rand() & 0xFF);
+    to   = ((rand() % 360) << 16) | ((rand() & 0xFF) << 8) | (rand() & 0xFF);
+    dur  = 1 + (rand() % TEST_RAMP_MAX_TICKS);
+
+    h0 = (from >> 16) & 0x1FF;
+    h1 = (to >> 16) & 0x1FF;
+    if ((h1 - h0) > 180) h1 -= 360;
+    else if ((h1 - h0) < -180) h1 += 360;
+
+    WS2812B_ramp_init(&ramps[0], from, to, dur);
+    for (k = 1; k < dur; k++)
+    {
+      hsv = WS2812B_ramp_value(&ramps[0], k);
+
+      n = 0;
+      d = Ramp_diff((hsv >> 16) & 0x1FF, (Ref_ramp_chan(h0, h1, dur - k, dur) + 360) % 360, 1);
+      if (d > n) n = d;
+      d = Ramp_diff((hsv >> 8) & 0xFF, Ref_ramp_chan((from >> 8) & 0xFF, (to >> 8) & 0xFF, dur - k, dur), 0);
+      if (d > n) n = d;
+      d = Ramp_diff(hsv & 0xFF, Ref_ramp_chan(from & 0xFF, to & 0xFF, dur - k, dur), 0);
+      if (d > n) n = d;
+
+      if (n > max_d) max_d = n;
+      if (n == 1) lsb_cnt++;
+      if (n > 1) err_cnt++;
+      if ((n != 0) && (dur <= TEST_RAMP_EXACT_TICKS)) exact_cnt++;
+      steps++;
+    }
+  }
+  pvt100_cb->_printf("Ramp steps checked       : %d\r\n", steps);
+  pvt100_cb->_printf("1 LSB differences        : %d\r\n", lsb_cnt);
+  pvt100_cb->_printf("Mismatches over 1 LSB    : %d\r\n", Test_check(err_cnt));
+  pvt100_cb->_printf("Differences <= %3d ticks : %d\r\n", TEST_RAMP_EXACT_TICKS, Test_check(exact_cnt));
+  pvt100_cb->_printf("Max difference           : %d\r\n", max_d);
+
+  //  
+  Cycles_counter_init();
+  for (i = 0; i < TEST_LEDS_NUM; i++)
+  {
+    WS2812B_ramp_init(&ramps[i], HSV_RED, HSV_BLUE - i, 80 + i);
+  }
+  for (n = 0; n < TEST_PASSES; n++)
+  {
+    t = Get_cycles_counter();
+    for (i = 0; i < TEST_LEDS_NUM; i++)
+    {
+      ramp_res[i] = Ref_ramp_hsv(HSV_RED, HSV_BLUE - i, 40 + n, 80 + i);
+    }
+    t = Get_cycles_counter() - t;
+    if (t < ref_min) ref_min = t;
+
+    t = Get_cycles_counter();
+    for (i = 0; i < TEST_LEDS_NUM; i++)
+    {
+      ramp_res[i] = WS2812B_ramp_value(&ramps[i], 40 + n);
+    }
+    t = Get_cycles_counter() - t;
+    if (t < tst_min) tst_min = t;
+  }
+  pvt100_cb->_printf("Division ramp            : %d cycles per LED\r\n", ref_min / TEST_LEDS_NUM);
+  pvt100_cb->_printf("Q16 ramp                 : %d cycles per LED\r\n", tst_min / TEST_LEDS_NUM);
+}
+
+/*-------------------------------------------------------------------------------------------------------------
+      8-      
+-------------------------------------------------------------------------------------------------------------*/
+static void Ref_transpose_frame(uint8_t *dst, const uint32_t *frame, uint32_t strip_leds)
+{
+  uint32_t l, b, i;
+  uint32_t grb;
+  uint8_t  v;
+
+  for (l = 0; l < strip_leds; l++)
+  {
+    for (b = 0; b < WS2812B_BITS_PER_LED; b++)
+    {
+      v = 0;
+      for (i = 0; i < WS2812B_LANES; i++)
+      {
+        grb = Ref_correct_rgb(frame[i * strip_leds + l]);
+        grb = (((grb >> 8) & 0xFF) << 16) | (((grb >> 16) & 0xFF) << 8) | (grb & 0xFF);
+        if ((grb >> (23 - b)) & 1) v |= (1 << i);
+      }
+      *dst++ = v;
+    }
+  }
+}
+
+/*-------------------------------------------------------------------------------------------------------------
+         GPIO     
+        
+-------------------------------------------------------------------------------------------------------------*/
+void LEDSC_test_transpose(void)
+{
+  uint32_t       i, n;
+  uint32_t       err_cnt = 0;
+  uint32_t       t;
+  uint32_t       ref_min = 0xFFFFFFFF;
+  uint32_t       tst_min = 0xFFFFFFFF;
+  T_monitor_cbl *pvt100_cb;
+  pvt100_cb = (T_monitor_cbl *)_task_get_environment(_task_get_id());
+
+  pvt100_cb->_printf("\r\n--------- WS2812B lanes transpose test ---------\r\n");
+  if (Test_color_mask(pvt100_cb) == 0) return; //       
+
+  srand(3);
+  for (n = 0; n < TEST_TRP_FRAMES; n++)
+  {
+    for (i = 0; i < WS2812B_LANES * TEST_TRP_STRIP_LEDS; i++)
+    {
+      trp_frame[i] = ((rand() << 16) ^ rand()) & 0xFFFFFF;
+    }
+    Ref_transpose_frame((uint8_t *)trp_ref, trp_frame, TEST_TRP_STRIP_LEDS);
+    WS2812B_transpose_frame(trp_tst, trp_frame, WS2812B_LANES * TEST_TRP_STRIP_LEDS, TEST_TRP_STRIP_LEDS, 0xFF, ws2812b_out_lut);
+    if (memcmp(trp_ref, trp_tst, sizeof(trp_ref)) != 0) err_cnt++;
+  }
+  pvt100_cb->_printf("Golden frame mismatches  : %d of %d\r\n", Test_check(err_cnt), TEST_TRP_FRAMES);
+
+  //  
+  Cycles_counter_init();
+  for (n = 0; n < TEST_PASSES; n++)
+  {
+    t = Get_cycles_counter();
+    Ref_transpose_frame((uint8_t *)trp_ref, trp_frame, TEST_TRP_STRIP_LEDS);
+    t = Get_cycles_counter() - t;
+    if (t < ref_min) ref_min = t;
+
+    t = Get_cycles_counter();
+    WS2812B_transpose_frame(trp_tst, trp_frame, WS2812B_LANES * TEST_TRP_STRIP_LEDS, TEST_TRP_STRIP_LEDS, 0xFF, ws2812b_out_lut);
+    t = Get_cycles_counter() - t;
+    if (t < tst_min) tst_min = t;
+  }
+  pvt100_cb->_printf("Bitwise transpose        : %d cycles per LED\r\n", ref_min / (WS2812B_LANES * TEST_TRP_STRIP_LEDS));
+  pvt100_cb->_printf("Block transpose          : %d cycles per LED\r\n", tst_min / (WS2812B_LANES * TEST_TRP_STRIP_LEDS));
+  pvt100_cb->_printf("Block transpose of %d LEDs : %d us\r\n", WS2812B_LANES * TEST_TRP_STRIP_LEDS, tst_min / 180);
+}
+
+/*-------------------------------------------------------------------------------------------------------------
+     PWM      RGB.
+          
+   0xFFFFFFFF       0  1
+-------------------------------------------------------------------------------------------------------------*/
+static uint32_t Decode_ftm_led(const uint16_t *src)
+{
+  const T_WS2812B_geometry *g = WS2812B_get_geometry();
+  uint32_t i;
+  uint32_t b = 0;
+  uint32_t rgb = 0;
+
+  for (i = 0; i < g->bits_per_led; i++)
+  {
+    if ((i & 7) == 0) b = 0;
+    b <<= 1;
+    if (src[i] == FTM_WS2812B_1) b |= 1;
+    else if (src[i] != FTM_WS2812B_0) return 0xFFFFFFFF;
+    if ((i & 7) == 7) rgb |= b << g->shift[i >> 3];
+  }
+  return rgb;
+}
+
+/*-------------------------------------------------------------------------------------------------------------
+    SPI      RGB.
+          SOUT
+   0xFFFFFFFF       0  1
+-------------------------------------------------------------------------------------------------------------*/
+static uint32_t Decode_spi_led(const uint8_t *src)
+{
+  const T_WS2812B_geometry *g = WS2812B_get_geometry();
+  uint32_t i;
+  uint32_t sym;
+  uint32_t b = 0;
+  uint32_t rgb = 0;
+
+  for (i = 0; i < g->bits_per_led; i++)
+  {
+    sym = (src[i / 2] >> ((i & 1) ? 0 : 4)) & 0x0F;
+    if ((i & 7) == 0) b = 0;
+    b <<= 1;
+    if (sym == WS2812B_SPI_SYM_1) b |= 1;
+    else if (sym != WS2812B_SPI_SYM_0) return 0xFFFFFFFF;
+    if ((i & 7) == 7) rgb |= b << g->shift[i >> 3];
+  }
+  return rgb;
+}
+
+/*-------------------------------------------------------------------------------------------------------------
+     FTM  SPI.
+       ,     
+         
+-------------------------------------------------------------------------------------------------------------*/
+void LEDSC_test_backends(void)
+{
+  uint32_t       i, n;
+  uint32_t       ftm_rgb, spi_rgb;
+  uint32_t       ftm_err = 0;
+  uint32_t       spi_err = 0;
+  uint32_t       diff_cnt = 0;
+  uint32_t       t;
+  uint32_t       ftm_min = 0xFFFFFFFF;
+  uint32_t       spi_min = 0xFFFFFFFF;
+  uint32_t       mask;
+  const T_WS2812B_geometry *g;
+  T_monitor_cbl *pvt100_cb;
+  pvt100_cb = (T_monitor_cbl *)_task_get_environment(_task_get_id());
+
+  pvt100_cb->_printf("\r\n--------- WS2812B output backends test ---------\r\n");
+  pvt100_cb->_printf("Active backend           : %s\r\n", WS2812B_get_backend()->name);
+  mask = Test_color_mask(pvt100_cb);
+  if (mask == 0) return;
+  g = WS2812B_get_geometry();
+
+  WS2812B_SPI_init_lut(g);
+  srand(4);
+  for (n = 0; n < TEST_DEC_FRAMES; n++)
+  {
+    for (i = 0; i < TEST_LEDS_NUM; i++)
+    {
+      dec_frame[i] = ((rand() << 16) ^ (rand() << 8) ^ rand()) & mask;
+      WS2812B_encode_rgb(tst_buf[i], dec_frame[i]);
+      WS2812B_SPI_encode_rgb((uint8_t *)spi_buf[i], dec_frame[i]);
+    }
+    for (i = 0; i < TEST_LEDS_NUM; i++)
+    {
+      ftm_rgb = Decode_ftm_led(tst_buf[i]);
+      spi_rgb = Decode_spi_led((uint8_t *)spi_buf[i]);
+      if (ftm_rgb != (Ref_correct_rgb(dec_frame[i]) & mask)) ftm_err++;
+      if (spi_rgb != (Ref_correct_rgb(dec_frame[i]) & mask)) spi_err++;
+      if (ftm_rgb != spi_rgb) diff_cnt++;
+    }
+  }
+  pvt100_cb->_printf("FTM decoded LED errors   : %d of %d\r\n", Test_check(ftm_err), TEST_DEC_FRAMES * TEST_LEDS_NUM);
+  pvt100_cb->_printf("SPI decoded LED errors   : %d of %d\r\n", Test_check(spi_err), TEST_DEC_FRAMES * TEST_LEDS_NUM);
+  pvt100_cb->_printf("FTM/SPI frame differences: %d\r\n", Test_check(diff_cnt));
+
+  //  
+  Cycles_counter_init();
+  for (n = 0; n < TEST_PASSES; n++)
+  {
+    t = Get_cycles_counter();
+    for (i = 0; i < TEST_LEDS_NUM; i++)
+    {
+      WS2812B_encode_rgb(tst_buf[i], dec_frame[i]);
+    }
+    t = Get_cycles_counter() - t;
+    if (t < ftm_min) ftm_min = t;
+
+    t = Get_cycles_counter();
+    for (i = 0; i < TEST_LEDS_NUM; i++)
+    {
+      WS2812B_SPI_encode_rgb((uint8_t *)spi_buf[i], dec_frame[i]);
+    }
+    t = Get_cycles_counter() - t;
+    if (t < spi_min) spi_min = t;
+  }
+  pvt100_cb->_printf("FTM encoder              : %d cycles per LED, %d DMA bytes per LED\r\n", ftm_min / TEST_LEDS_NUM, g->bits_per_led * 2);
+  pvt100_cb->_printf("SPI encoder              : %d cycles per LED, %d DMA bytes per LED\r\n", spi_min / TEST_LEDS_NUM, g->colrs * WS2812B_SPI_BYTES_PER_COLR);
+}
+
+//   WS2812B  datasheet  : T0H 0.4 , T1H 0.8 , T0L 0.85 , T1L 0.45    150 ,
+//   1.25    600 ,     50 
+#define  WS_T0H_MIN       250
+#define  WS_T0H_MAX       550
+#define  WS_T1H_MIN       650
+#define  WS_T1H_MAX       950
+#define  WS_T0L_MIN       700
+#define  WS_T0L_MAX       1000
+#define  WS_T1L_MIN       300
+#define  WS_T1L_MAX       600
+#define  WS_BIT_MIN       650
+#define  WS_BIT_MAX       1850
+#define  WS_RESET_MIN     50000
+#define  WS_RESET_NEW_MIN 280000 //    WS2812B  
+
+#define  TEST_WAVE_STOP_TICKS 20 //        ,     
+
+extern uint32_t enable_led_strip;
+
+/*-------------------------------------------------------------------------------------------------------------
+           lane    RGB
+-------------------------------------------------------------------------------------------------------------*/
+static uint32_t Decode_gpio_led(const uint8_t *src, uint32_t lane)
+{
+  uint32_t k;
+  uint32_t grb = 0;
+
+  for (k = 0; k < WS2812B_BITS_PER_LED; k++)
+  {
+    grb = (grb << 1) | ((src[k] >> lane) & 1);
+  }
+  return (((grb >> 8) & 0xFF) << 16) | (((grb >> 16) & 0xFF) << 8) | (grb & 0xFF);
+}
+
+//    0  1        
+typedef struct
+{
+  uint32_t  num[2];   //   
+  uint32_t  h_min[2]; //  
+  uint32_t  h_max[2];
+  uint32_t  l_min[2]; //  
+  uint32_t  l_max[2];
+} T_wave_meas;
+
+#define  WS_TH_SPLIT      ((WS_T0H_MAX + WS_T1H_MIN) / 2) //      0  1
+
+/*-------------------------------------------------------------------------------------------------------------
+     .      
+-------------------------------------------------------------------------------------------------------------*/
+static void Wave_add(T_wave_meas *m, uint32_t high, uint32_t low)
+{
+  uint32_t b = (high > WS_TH_SPLIT);
+
+  if (m->num[b] == 0)
+  {
+    m->h_min[b] = m->h_max[b] = high;
+    m->l_min[b] = m->l_max[b] = low;
+  }
+  if (high < m->h_min[b]) m->h_min[b] = high;
+  if (high > m->h_max[b]) m->h_max[b] = high;
+  if (low  < m->l_min[b]) m->l_min[b] = low;
+  if (low  > m->l_max[b]) m->l_max[b] = low;
+  m->num[b]++;
+}
+
+/*-------------------------------------------------------------------------------------------------------------
+     FTM:   CnV   ,    - 
+-------------------------------------------------------------------------------------------------------------*/
+static void Wave_ftm(T_wave_meas *m, uint32_t leds)
+{
+  uint32_t n, k;
+  uint32_t c;
+
+  for (n = 0; n < leds; n++)
+  {
+    for (k = 0; k < WS2812B_get_geometry()->bits_per_led; k++)
+    {
+      c = tst_buf[n][k];
+      Wave_add(m, WS2812B_FTM_NS(c), WS2812B_FTM_NS(FTM_WS2812B_MOD + 1 - c));
+    }
+  }
+}
+
+/*-------------------------------------------------------------------------------------------------------------
+     SPI.  SPI        ,
+    -     .    SPI ()  
+      WS2812B_SPI_GAP_NS
+-------------------------------------------------------------------------------------------------------------*/
+static void Wave_spi(T_wave_meas *m, uint32_t leds)
+{
+  const uint8_t *src;
+  uint32_t       bytes = WS2812B_get_geometry()->colrs * WS2812B_SPI_BYTES_PER_COLR;
+  uint32_t       n, i, k;
+  uint32_t       lvl;
+  uint32_t       prev = 0;
+  uint32_t       high = 0;
+  uint32_t       low  = 0;
+
+  for (n = 0; n < leds; n++)
+  {
+    src = (const uint8_t *)spi_buf[n];
+    for (i = 0; i < bytes; i++)
+    {
+      for (k = 0; k < 8; k++)
+      {
+        lvl = (src[i] >> (7 - k)) & 1;
+        if ((lvl != 0) && (prev == 0) && (high != 0))
+        {
+          Wave_add(m, high, low);
+          high = 0;
+          low  = 0;
+        }
+        if (lvl != 0) high += WS2812B_SPI_NS(1);
+        else low += WS2812B_SPI_NS(1);
+        prev = lvl;
+      }
+      if (prev != 0) high += WS2812B_SPI_GAP_NS;
+      else low += WS2812B_SPI_GAP_NS;
+    }
+  }
+}
+
+/*-------------------------------------------------------------------------------------------------------------
+          datasheet.
+       ,      .
+       0  1           ,
+        
+
+   1    
+-------------------------------------------------------------------------------------------------------------*/
+static uint32_t Check_wave(T_monitor_cbl *pvt100_cb, const T_WS2812B_backend *out, const T_wave_meas *m)
+{
+  uint32_t ok = 1;
+
+  if ((m->num[0] == 0) || (m->num[1] == 0))
+  {
+    pvt100_cb->_printf("%s: %d zero and %d one bits in the stream - FAIL\r\n", out->name, m->num[0], m->num[1]);
+    return 0;
+  }
+  if ((m->h_min[0] < WS_T0H_MIN) || (m->h_max[0] > WS_T0H_MAX)) ok = 0;
+  if ((m->h_min[1] < WS_T1H_MIN) || (m->h_max[1] > WS_T1H_MAX)) ok = 0;
+  if ((m->l_min[0] < WS_T0L_MIN) || (m->l_max[0] > WS_T0L_MAX)) ok = 0;
+  if ((m->l_min[1] < WS_T1L_MIN) || (m->l_max[1] > WS_T1L_MAX)) ok = 0;
+  if ((m->h_min[0] + m->l_min[0] < WS_BIT_MIN) || (m->h_min[1] + m->l_min[1] < WS_BIT_MIN)) ok = 0;
+  if ((m->h_max[0] + m->l_max[0] > WS_BIT_MAX) || (m->h_max[1] + m->l_max[1] > WS_BIT_MAX)) ok = 0;
+  if (out->wave->reset < WS_RESET_MIN) ok = 0;
+
+  pvt100_cb->_printf("%s: T0H %d..%d, T1H %d..%d, T0L %d..%d, T1L %d..%d ns, reset %d us - %s\r\n",
+                     out->name, m->h_min[0], m->h_max[0], m->h_min[1], m->h_max[1], m->l_min[0], m->l_max[0], m->l_min[1], m->l_max[1],
+                     out->wave->reset / 1000, ok ? "OK" : "FAIL");
+  if (out->wave->reset < WS_RESET_NEW_MIN)
+  {
+    pvt100_cb->_printf("  reset shorter than %d us required by recent WS2812B revisions\r\n", WS_RESET_NEW_MIN / 1000);
+  }
+  return ok;
+}
+
+/*-------------------------------------------------------------------------------------------------------------
+        :
+  -    FTM, SPI  GPIO    datasheet,
+     FTM  SPI     ;
+  -              
+      ,       ;
+  -     GPIO       ;
+  -           
+         
+-------------------------------------------------------------------------------------------------------------*/
+void LEDSC_test_waveform(void)
+{
+  const T_WS2812B_backend  *out = WS2812B_get_backend();
+  const T_WS2812B_geometry *g;
+  uint32_t                 *frame;
+  uint32_t                  i, n, l;
+  uint32_t                  t;
+  volatile uint32_t         dec_sink = 0; //    ,      
+  uint32_t                  errs    = 0;
+  uint32_t                  err_cnt = 0;
+  uint32_t                  en;
+  uint32_t                  mins[6];
+  uint32_t                  mask;
+  T_wave_meas               wm;
+  const T_WS2812B_wave     *w;
+  T_monitor_cbl            *pvt100_cb;
+  pvt100_cb = (T_monitor_cbl *)_task_get_environment(_task_get_id());
+
+  pvt100_cb->_printf("\r\n--------- WS2812B waveform test ---------\r\n");
+  mask = Test_color_mask(pvt100_cb);
+  if (mask == 0) return;
+  g = WS2812B_get_geometry();
+
+  //      FTM  SPI  .  GPIO 
+  //    FTM,       
+  WS2812B_SPI_init_lut(g);
+  srand(6);
+  for (i = 0; i < TEST_LEDS_NUM; i++)
+  {
+    dec_frame[i] = ((rand() << 16) ^ (rand() << 8) ^ rand()) & mask;
+    WS2812B_encode_rgb(tst_buf[i], dec_frame[i]);
+    WS2812B_SPI_encode_rgb((uint8_t *)spi_buf[i], dec_frame[i]);
+  }
+  memset(&wm, 0, sizeof(wm));
+  Wave_ftm(&wm, TEST_LEDS_NUM);
+  n  = Check_wave(pvt100_cb, &ws2812b_ftm_backend, &wm);
+  memset(&wm, 0, sizeof(wm));
+  Wave_spi(&wm, TEST_LEDS_NUM);
+  n &= Check_wave(pvt100_cb, &ws2812b_spi_backend, &wm);
+  memset(&wm, 0, sizeof(wm));
+  w = ws2812b_gpio_backend.wave;
+  Wave_add(&wm, w->t0h, w->bit - w->t0h);
+  Wave_add(&wm, w->t1h, w->bit - w->t1h);
+  n &= Check_wave(pvt100_cb, &ws2812b_gpio_backend, &wm);
+  pvt100_cb->_printf("Waveform timing          : %s\r\n", Test_check(n == 0) ? "FAIL" : "OK");
+
+  //   .      ,   
+  frame = (uint32_t *)_mem_alloc_zero(g->leds_num * sizeof(uint32_t));
+  if (frame != 0)
+  {
+    en = enable_led_strip;
+    enable_led_strip = 0;
+    _time_delay_ticks(TEST_WAVE_STOP_TICKS);
+    Cycles_counter_init();
+    t = Get_cycles_counter();
+    n = out->decode(frame, &errs);
+    t = Get_cycles_counter() - t;
+    enable_led_strip = en;
+    if (n == 0)
+    {
+      pvt100_cb->_printf("Active backend buffer    : %s, whole frame is not stored\r\n", out->name);
+    }
+    else
+    {
+      pvt100_cb->_printf("Active backend buffer    : %s, %d symbol errors in %d LEDs\r\n", out->name, Test_check(errs), n);
+      pvt100_cb->_printf("Active backend decoder   : %d cycles per LED\r\n", t / n);
+    }
+    _mem_free(frame);
+  }
+
+  //  GPIO,  8 
+  srand(5);
+  for (n = 0; n < TEST_TRP_FRAMES; n++)
+  {
+    for (i = 0; i < WS2812B_LANES * TEST_TRP_STRIP_LEDS; i++)
+    {
+      trp_frame[i] = ((rand() << 16) ^ rand()) & 0xFFFFFF;
+    }
+    WS2812B_transpose_frame(trp_tst, trp_frame, WS2812B_LANES * TEST_TRP_STRIP_LEDS, TEST_TRP_STRIP_LEDS, 0xFF, ws2812b_out_lut);
+    for (l = 0; l < WS2812B_LANES; l++)
+    {
+      for (i = 0; i < TEST_TRP_STRIP_LEDS; i++)
+      {
+        if (Decode_gpio_led((uint8_t *)trp_tst + i * WS2812B_LANE_BYTES_PER_LED, l) != (Ref_correct_rgb(trp_frame[l * TEST_TRP_STRIP_LEDS + i]) & 0xFFFFFF)) err_cnt++;
+      }
+    }
+  }
+  pvt100_cb->_printf("GPIO decoded LED errors  : %d of %d\r\n", Test_check(err_cnt), TEST_TRP_FRAMES * WS2812B_LANES * TEST_TRP_STRIP_LEDS);
+
+  //     
+  WS2812B_SPI_init_lut(g);
+  for (i = 0; i < TEST_LEDS_NUM; i++)
+  {
+    dec_frame[i] = ((rand() << 16) ^ (rand() << 8) ^ rand()) & mask;
+  }
+  for (i = 0; i < 6; i++) mins[i] = 0xFFFFFFFF;
+  Cycles_counter_init();
+  for (n = 0; n < TEST_PASSES; n++)
+  {
+    t = Get_cycles_counter();
+    for (i = 0; i < TEST_LEDS_NUM; i++) Ref_encode_rgb(ref_buf[i], dec_frame[i]);
+    t = Get_cycles_counter() - t;
+    if (t < mins[0]) mins[0] = t;
+
+    t = Get_cycles_counter();
+    for (i = 0; i < TEST_LEDS_NUM; i++) WS2812B_encode_rgb(tst_buf[i], dec_frame[i]);
+    t = Get_cycles_counter() - t;
+    if (t < mins[1]) mins[1] = t;
+
+    t = Get_cycles_counter();
+    for (i = 0; i < TEST_LEDS_NUM; i++) WS2812B_SPI_encode_rgb((uint8_t *)spi_buf[i], dec_frame[i]);
+    t = Get_cycles_counter() - t;
+    if (t < mins[2]) mins[2] = t;
+
+    t = Get_cycles_counter();
+    WS2812B_transpose_frame(trp_tst, trp_frame, WS2812B_LANES * TEST_TRP_STRIP_LEDS, TEST_TRP_STRIP_LEDS, 0xFF, ws2812b_out_lut);
+    t = Get_cycles_counter() - t;
+    if (t < mins[3]) mins[3] = t;
+
+    t = Get_cycles_counter();
+    for (i = 0; i < TEST_LEDS_NUM; i++) dec_sink ^= Decode_ftm_led(tst_buf[i]);
+    t = Get_cycles_counter() - t;
+    if (t < mins[4]) mins[4] = t;
+
+    t = Get_cycles_counter();
+    for (i = 0; i < TEST_LEDS_NUM; i++) dec_sink ^= Decode_spi_led((uint8_t *)spi_buf[i]);
+    t = Get_cycles_counter() - t;
+    if (t < mins[5]) mins[5] = t;
+  }
+  pvt100_cb->_printf("LED transfer time        : %d cycles\r\n", out->wave->bit * g->bits_per_led * 180 / 1000);
+  pvt100_cb->_printf("FTM bitwise encoder      : %d cycles per LED\r\n", mins[0] / TEST_LEDS_NUM);
+  pvt100_cb->_printf("FTM table encoder        : %d cycles per LED\r\n", mins[1] / TEST_LEDS_NUM);
+  pvt100_cb->_printf("SPI table encoder        : %d cycles per LED\r\n", mins[2] / TEST_LEDS_NUM);
+  pvt100_cb->_printf("GPIO block transpose     : %d cycles per LED\r\n", mins[3] / (WS2812B_LANES * TEST_TRP_STRIP_LEDS));
+  pvt100_cb->_printf("FTM decoder              : %d cycles per LED\r\n", mins[4] / TEST_LEDS_NUM);
+  pvt100_cb->_printf("SPI decoder              : %d cycles per LED\r\n", mins[5] / TEST_LEDS_NUM);
+}
+
+/*-------------------------------------------------------------------------------------------------------------
+    HSV -> RGB   ,      60.
+   360   0
+-------------------------------------------------------------------------------------------------------------*/
+static uint32_t Ref_hsv_to_rgb(uint32_t hue, uint32_t sat, uint32_t val)
+{
+  uint32_t   r;
+  uint32_t   g;
+  uint32_t   b;
+  uint32_t   base;
+
+  sat = 255 - dim_curve[255 - sat];
+  if (sat == 0) return val | (val << 8) | (val << 16);
+  if (hue >= 360) hue -= 360;
+
+  base = ((255 - sat) * val) >> 8;
+  switch (hue / 60)
+  {
+  case 0:
+    r = val;
+    g = (((val - base) * hue) / 60) + base;
+    b = base;
+    break;
+  case 1:
+    r = (((val - base) * (60 - (hue % 60))) / 60) + base;
+    g = val;
+    b = base;
+    break;
+  case 2:
+    r = base;
+    g = val;
+    b = (((val - base) * (hue % 60)) / 60) + base;
+    break;
+  case 3:
+    r = base;
+    g = (((val - base) * (60 - (hue % 60))) / 60) + base;
+    b = val;
+    break;
+  case 4:
+    r = (((val - base) * (hue % 60)) / 60) + base;
+    g = base;
+    b = val;
+    break;
+  default:
+    r = val;
+    g = base;
+    b = (((val - base) * (60 - (hue % 60))) / 60) + base;
+    break;
+  }
+  return ((r & 0xFF) << 16) | ((g & 0xFF) << 8) | (b & 0xFF);
+}
+
+/*-------------------------------------------------------------------------------------------------------------
+     HSV -> RGB       361 * 256 * 256  
+      .     
+-------------------------------------------------------------------------------------------------------------*/
+void LEDSC_test_hsv(void)
+{
+  uint32_t       hue, sat, val;
+  uint32_t       ref, tst;
+  uint32_t       d, k;
+  uint32_t       err_cnt = 0;
+  uint32_t       lsb_cnt = 0;
+  uint32_t       t;
+  uint32_t       n;
+  uint32_t       ref_min = 0xFFFFFFFF;
+  uint32_t       tst_min = 0xFFFFFFFF;
+  volatile uint32_t acc = 0;
+  T_monitor_cbl *pvt100_cb;
+  pvt100_cb = (T_monitor_cbl *)_task_get_environment(_task_get_id());
+
+  pvt100_cb->_printf("\r\n--------- HSV to RGB conversion test ---------\r\n");
+
+  for (hue = 0; hue <= 360; hue++)
+  {
+    for (sat = 0; sat < 256; sat++)
+    {
+      for (val = 0; val < 256; val++)
+      {
+        ref = Ref_hsv_to_rgb(hue, sat, val);
+        tst = WS2812B_hsv_to_rgb(hue, sat, val);
+        if (ref == tst) continue;
+        err_cnt++;
+        //           
+        for (k = 0; k < 24; k += 8)
+        {
+          d = ((ref >> k) & 0xFF) - ((tst >> k) & 0xFF);
+          if ((d + 1) > 2)
+          {
+            lsb_cnt++;
+            break;
+          }
+        }
+      }
+    }
+  }
+  pvt100_cb->_printf("Checked colors           : %d\r\n", 361 * 256 * 256);
+  pvt100_cb->_printf("Mismatches               : %d\r\n", Test_check(err_cnt));
+  pvt100_cb->_printf("Mismatches over 1 LSB    : %d\r\n", Test_check(lsb_cnt));
+
+  //        
+  Cycles_counter_init();
+  for (n = 0; n < TEST_PASSES; n++)
+  {
+    t = Get_cycles_counter();
+    for (hue = 0; hue < 360; hue++) acc += Ref_hsv_to_rgb(hue, TEST_HSV_SAT, TEST_HSV_VAL);
+    t = Get_cycles_counter() - t;
+    if (t < ref_min) ref_min = t;
+
+    t = Get_cycles_counter();
+    for (hue = 0; hue < 360; hue++) acc += WS2812B_hsv_to_rgb(hue, TEST_HSV_SAT, TEST_HSV_VAL);
+    t = Get_cycles_counter() - t;
+    if (t < tst_min) tst_min = t;
+  }
+  pvt100_cb->_printf("Reference conversion     : %d cycles, %d ns\r\n", ref_min / 360, ref_min * 1000 / (360 * 180));
+  pvt100_cb->_printf("Fast conversion          : %d cycles, %d ns\r\n", tst_min / 360, tst_min * 1000 / (360 * 180));
+}
+
+/*-------------------------------------------------------------------------------------------------------------
+       .        .
+            .
+    ,     :       
+-------------------------------------------------------------------------------------------------------------*/
+static void Pal_test_phase(T_monitor_cbl *pvt100_cb, const char *name, uint32_t blend)
+{
+  const T_WS2812B_stat *st = WS2812B_get_stat();
+  uint32_t              n;
+  uint32_t              skipped;
+  uint32_t              sum = 0;
+  uint32_t              max = 0;
+  uint32_t              changed = 0;
+
+  for (n = 0; n < TEST_PAL_FRAMES; n++)
+  {
+    if (blend != 0) WS2812B_pal_blend(pal_test_fire, blend);
+    else WS2812B_pal_rotate(1);
+    skipped = st->skipped_frames;
+    if (WS2812B_wait_frame_done(Conv_ms_to_ticks(100)) != MQX_OK)
+    {
+      if ((blend != 0) && (st->skipped_frames != skipped) && (n != 0)) break;
+      pvt100_cb->_printf("Frame wait timeout\r\n");
+      Test_check(1);
+      return;
+    }
+    sum += st->render_cycles;
+    if (st->render_cycles > max) max = st->render_cycles;
+    changed += st->changed_leds;
+  }
+  pvt100_cb->_printf("%s: %d frames, render %d cycles avg, %d max, %d LEDs changed avg\r\n", name, n, sum / n, max, changed / n);
+}
+
+/*-------------------------------------------------------------------------------------------------------------
+      .
+         ,      .
+        
+-------------------------------------------------------------------------------------------------------------*/
+void LEDSC_test_palette(void)
+{
+  const T_WS2812B_geometry *g = WS2812B_get_geometry();
+  uint32_t       i;
+  T_monitor_cbl *pvt100_cb;
+  pvt100_cb = (T_monitor_cbl *)_task_get_environment(_task_get_id());
+
+  pvt100_cb->_printf("\r\n--------- WS2812B palette mode test ---------\r\n");
+  if (Test_color_mask(pvt100_cb) == 0) return;
+
+  for (i = 0; i < 256; i++)
+  {
+    WS2812B_pal_set_hsv(i, WS2812B_HUE_DEG(i), 255, 255);
+    pal_test_fire[i] = WS2812B_hsv_to_rgb((i * 60) / 255, 255 - (i >> 2), i); //      
+  }
+  for (i = 0; i < g->leds_num; i++)
+  {
+    pal_test_idx[i] = (i * 256) / g->leds_num;
+  }
+  WS2812B_pal_set_index(0, pal_test_idx, g->leds_num);
+  WS2812B_set_source(WS2812B_SRC_PALETTE);
+
+  Pal_test_phase(pvt100_cb, "Rotate ", 0);
+  Pal_test_phase(pvt100_cb, "Blend  ", TEST_PAL_BLEND);
+
+  WS2812B_set_source(WS2812B_SRC_PATTERNS);
+}
+
+/*-------------------------------------------------------------------------------------------------------------
+          
+-------------------------------------------------------------------------------------------------------------*/
+static uint32_t Ref_blend(uint32_t d, uint32_t s, uint32_t mode, uint32_t alpha)
+{
+  uint32_t k;
+  uint32_t a, b, c;
+  uint32_t res = 0;
+
+  for (k = 0; k < 32; k += 8)
+  {
+    a = (d >> k) & 0xFF;
+    b = (s >> k) & 0xFF;
+    switch (mode)
+    {
+    case WS2812B_BLEND_ADD:
+      c = a + b;
+      if (c > 255) c = 255;
+      break;
+    case WS2812B_BLEND_MAX:
+      c = (a > b) ? a : b;
+      break;
+    case WS2812B_BLEND_MUL:
+      c = (a * b * 2 + 255) / 510;
+      break;
+    default:
+      c = b;
+      break;
+    }
+    c = (c * alpha + a * (WS2812B_ALPHA_MAX - alpha)) >> 8;
+    res |= c << k;
+  }
+  return res;
+}
+
+/*-------------------------------------------------------------------------------------------------------------
+              
+      TEST_COMP_LAYERS   TEST_COMP_LEDS 
+-------------------------------------------------------------------------------------------------------------*/
+void LEDSC_test_compose(void)
+{
+  static const uint32_t alphas[] = { 1, 77, WS2812B_ALPHA_MAX / 2, 255, WS2812B_ALPHA_MAX };
+  T_WS2812B_layer layers[TEST_COMP_LAYERS];
+  uint32_t       i, n;
+  uint32_t       mode, a;
+  uint32_t       err_cnt = 0;
+  uint32_t       t;
+  uint32_t       tst_min = 0xFFFFFFFF;
+  T_monitor_cbl *pvt100_cb;
+  pvt100_cb = (T_monitor_cbl *)_task_get_environment(_task_get_id());
+
+  pvt100_cb->_printf("\r\n--------- WS2812B layers compose test ---------\r\n");
+
+  srand(5);
+  for (n = 0; n < TEST_COMP_PASSES; n++)
+  {
+    for (i = 0; i < TEST_COMP_LEDS; i++)
+    {
+      comp_src[0][i] = ((rand() << 16) ^ rand()) & 0xFFFFFF;
+      comp_src[1][i] = ((rand() << 16) ^ rand()) & 0xFFFFFF;
+    }
+    for (mode = 0; mode < WS2812B_BLEND_NUM; mode++)
+    {
+      for (a = 0; a < sizeof(alphas) / sizeof(alphas[0]); a++)
+      {
+        for (i = 0; i < TEST_COMP_LEDS; i++)
+        {
+          comp_tst[i] = comp_src[0][i];
+          comp_ref[i] = Ref_blend(comp_src[0][i], comp_src[1][i], mode, alphas[a]);
+        }
+        WS2812B_blend(comp_tst, comp_src[1], TEST_COMP_LEDS, mode, alphas[a]);
+        if (memcmp(comp_tst, comp_ref, sizeof(comp_ref)) != 0) err_cnt++;
+      }
+    }
+  }
+  pvt100_cb->_printf("Golden blend mismatches  : %d of %d\r\n", Test_check(err_cnt), TEST_COMP_PASSES * WS2812B_BLEND_NUM * sizeof(alphas) / sizeof(alphas[0]));
+
+  // ,    .     -  
+  for (i = 0; i < TEST_COMP_LAYERS; i++)
+  {
+    layers[i].pix   = comp_src[i];
+    layers[i].mode  = (i == 0) ? WS2812B_BLEND_ALPHA : ((i == 1) ? WS2812B_BLEND_ADD : WS2812B_BLEND_MAX);
+    layers[i].alpha = 77;
+  }
+  Cycles_counter_init();
+  for (n = 0; n < TEST_PASSES; n++)
+  {
+    memcpy(comp_tst, comp_ref, sizeof(comp_tst));
+    t = Get_cycles_counter();
+    WS2812B_compose(comp_tst, layers, TEST_COMP_LAYERS, TEST_COMP_LEDS);
+    t = Get_cycles_counter() - t;
+    if (t < tst_min) tst_min = t;
+  }
+  pvt100_cb->_printf("Compose %d layers        : %d cycles per LED\r\n", TEST_COMP_LAYERS, tst_min / TEST_COMP_LEDS);
+  pvt100_cb->_printf("Compose of %d LEDs     : %d us of 16000 us frame\r\n", TEST_COMP_LEDS, tst_min / 180);
+}
+
+/*-------------------------------------------------------------------------------------------------------------
+         TEST_COMP_LEDS .
+         16 ,     
+-------------------------------------------------------------------------------------------------------------*/
+void LEDSC_test_effects(void)
+{
+  static const char *names[WS2812B_FX_NUM] = { "", "Rainbow", "Chase  ", "Fire   ", "Twinkle", "", "Noise  " };
+  T_WS2812B_fx_params p;
+  uint32_t       id;
+  uint32_t       n;
+  uint32_t       t;
+  uint32_t       tst_min;
+  T_monitor_cbl *pvt100_cb;
+  pvt100_cb = (T_monitor_cbl *)_task_get_environment(_task_get_id());
+
+  pvt100_cb->_printf("\r\n--------- WS2812B procedural effects test ---------\r\n");
+
+  Cycles_counter_init();
+  for (id = WS2812B_FX_RAINBOW; id < WS2812B_FX_NUM; id++)
+  {
+    if (id == WS2812B_FX_SCRIPT) continue; //     
+    p.id      = id;
+    p.speed   = 255;
+    p.hue     = 0;
+    p.sat     = 255;
+    p.val     = 255;
+    p.density = 128;
+    p.width   = 60;
+    WS2812B_fx_init(&fx_test, &p, fx_test_heat, TEST_COMP_LEDS, 0);
+    tst_min = 0xFFFFFFFF;
+    for (n = 1; n <= TEST_PASSES; n++)
+    {
+      t = Get_cycles_counter();
+      WS2812B_fx_render(&fx_test, comp_tst, TEST_COMP_LEDS, n * 16);
+      t = Get_cycles_counter() - t;
+      if (t < tst_min) tst_min = t;
+    }
+    pvt100_cb->_printf("%s : %d cycles, %d ns per LED\r\n", names[id], tst_min / TEST_COMP_LEDS, (tst_min * 1000 / 180) / TEST_COMP_LEDS);
+  }
+}
+
+/*-------------------------------------------------------------------------------------------------------------
+          TEST_COMP_LEDS .
+            
+
+        
+-------------------------------------------------------------------------------------------------------------*/
+static uint32_t Vm_test_timing(T_WS2812B_fx_params *p)
+{
+  uint32_t       n;
+  uint32_t       t;
+  uint32_t       tst_min;
+
+  WS2812B_fx_init(&fx_test, p, fx_test_heat, TEST_COMP_LEDS, 0);
+  fx_test.prog = &vm_test_prog;
+  tst_min = 0xFFFFFFFF;
+  for (n = 1; n <= TEST_PASSES; n++)
+  {
+    t = Get_cycles_counter();
+    WS2812B_fx_render(&fx_test, comp_tst, TEST_COMP_LEDS, n * 16);
+    t = Get_cycles_counter() - t;
+    if (t < tst_min) tst_min = t;
+  }
+  return tst_min;
+}
+
+/*-------------------------------------------------------------------------------------------------------------
+       .         K66:
+     Linux       Linux,    
+    Linux,   host_ledsc bench script
+-------------------------------------------------------------------------------------------------------------*/
+static void Vm_test_print(T_monitor_cbl *pvt100_cb, const char *name, uint32_t t)
+{
+#ifdef __ICCARM__
+  pvt100_cb->_printf("%s : %d -> %d instructions, %d cycles, %d ns per LED, %d%% CPU for %d LEDs at %d fps\r\n",
+                     name, vm_test_prog.len, fx_test.vm_frame.len, t / TEST_COMP_LEDS, (t * 1000 / 180) / TEST_COMP_LEDS,
+                     t * TEST_VM_FPS / 1800000, TEST_COMP_LEDS, TEST_VM_FPS);
+#else
+  pvt100_cb->_printf("%s : %d -> %d instructions, %d host ns per LED\r\n",
+                     name, vm_test_prog.len, fx_test.vm_frame.len, (t * 1000 / 180) / TEST_COMP_LEDS);
+#endif
+}
+
+/*-------------------------------------------------------------------------------------------------------------
+      .
+        C,      .
+                 
+-------------------------------------------------------------------------------------------------------------*/
+void LEDSC_test_vm(void)
+{
+  static const uint8_t bad_opcode[] = { WS2812B_VM_LED, 0x07 };
+  static const uint8_t bad_trunc[]  = { WS2812B_VM_LED, WS2812B_VM_PUSH, 1, 2 };
+  static const uint8_t bad_stack[]  = { WS2812B_VM_LED, WS2812B_VM_ADD };
+  static const uint8_t bad_end[]    = { WS2812B_VM_LED, WS2812B_VM_LED, WS2812B_VM_LED };
+  T_WS2812B_fx_params p;
+  uint32_t       res;
+  uint32_t       i;
+  uint32_t       ms;
+  uint32_t       err;
+  T_monitor_cbl *pvt100_cb;
+  pvt100_cb = (T_monitor_cbl *)_task_get_environment(_task_get_id());
+
+  pvt100_cb->_printf("\r\n--------- WS2812B effect script VM test ---------\r\n");
+
+  err = 0;
+  if (WS2812B_vm_load(&vm_test_prog, bad_opcode, sizeof(bad_opcode)) != WS2812B_VM_ERR_OPCODE) err++;
+  if (WS2812B_vm_load(&vm_test_prog, bad_trunc, sizeof(bad_trunc)) != WS2812B_VM_ERR_TRUNC) err++;
+  if (WS2812B_vm_load(&vm_test_prog, bad_stack, sizeof(bad_stack)) != WS2812B_VM_ERR_STACK) err++;
+  if (WS2812B_vm_load(&vm_test_prog, bad_end, sizeof(bad_end)) != WS2812B_VM_ERR_END) err++;
+  pvt100_cb->_printf("Invalid programs rejection   : %s\r\n", (Test_check(err) == 0) ? "Ok" : "Error");
+
+  p.id      = WS2812B_FX_SCRIPT;
+  p.speed   = 200;
+  p.hue     = 100;
+  p.sat     = 230;
+  p.val     = 255;
+  p.density = 0;
+  p.width   = 60;
+
+  res = WS2812B_vm_load(&vm_test_prog, vm_test_rainbow, sizeof(vm_test_rainbow));
+  if (res != WS2812B_VM_OK)
+  {
+    pvt100_cb->_printf("Rainbow program load error %d\r\n", Test_check(res));
+    return;
+  }
+  WS2812B_fx_init(&fx_test, &p, fx_test_heat, TEST_COMP_LEDS, 0);
+  fx_test.prog = &vm_test_prog;
+  err = 0;
+  for (ms = 0; ms < 100000; ms += 3331)
+  {
+    WS2812B_fx_render(&fx_test, comp_tst, TEST_COMP_LEDS, ms);
+    for (i = 0; i < TEST_COMP_LEDS; i++)
+    {
+      if (comp_tst[i] != WS2812B_hsv_to_rgb((i * 360 / p.width + ((ms * p.speed) >> 6)) % 360, p.sat, p.val)) err++;
+    }
+  }
+  pvt100_cb->_printf("Rainbow program check        : %s, %d errors\r\n", (Test_check(err) == 0) ? "Ok" : "Error", err);
+
+  Cycles_counter_init();
+  Vm_test_print(pvt100_cb, "Rainbow", Vm_test_timing(&p));
+
+  res = WS2812B_vm_load(&vm_test_prog, vm_test_waves, sizeof(vm_test_waves));
+  if (res != WS2812B_VM_OK)
+  {
+    pvt100_cb->_printf("Waves program load error %d\r\n", Test_check(res));
+    return;
+  }
+  Vm_test_print(pvt100_cb, "Waves  ", Vm_test_timing(&p));
+}
+
+/*-------------------------------------------------------------------------------------------------------------
+            .
+     ,   ,       
+-------------------------------------------------------------------------------------------------------------*/
+static float Ref_noise_fade(float t)
+{
+  return t * t * t * (t * (t * 6.0f - 15.0f) + 10.0f);
+}
+
+static float Ref_noise_lerp(float a, float b, float t)
+{
+  return a + (b - a) * t;
+}
+
+static float Ref_noise_grad2(uint32_t h, float x, float y)
+{
+  static const int8_t g[8][2] = { { 1, 1 }, { -1, 1 }, { 1, -1 }, { -1, -1 }, { 1, 0 }, { -1, 0 }, { 0, 1 }, { 0, -1 } };
+
+  return g[h & 7][0] * x + g[h & 7][1] * y;
+}
+
+static float Ref_noise_grad3(uint32_t h, float x, float y, float z)
+{
+  static const int8_t g[16][3] =
+  {
+    { 1, 1, 0 }, { -1, 1, 0 }, { 1, -1, 0 }, { -1, -1, 0 }, { 1, 0, 1 }, { -1, 0, 1 }, { 1, 0, -1 }, { -1, 0, -1 },
+    { 0, 1, 1 }, { 0, -1, 1 }, { 0, 1, -1 }, { 0, -1, -1 }, { 1, 1, 0 }, { -1, 1, 0 }, { 0, -1, 1 }, { 0, -1, -1 }
+  };
+
+  return g[h & 15][0] * x + g[h & 15][1] * y + g[h & 15][2] * z;
+}
+
+static float Ref_noise2(uint32_t x, uint32_t y)
+{
+  const uint8_t *p = ws2812b_noise_perm;
+  uint32_t xi = (x >> 16) & 0xFF;
+  uint32_t yi = (y >> 16) & 0xFF;
+  float    fx = (x & 0xFFFF) / 65536.0f;
+  float    fy = (y & 0xFFFF) / 65536.0f;
+  uint32_t a  = p[xi] + yi;
+  uint32_t b  = p[(xi + 1) & 0xFF] + yi;
+
+  return Ref_noise_lerp(Ref_noise_lerp(Ref_noise_grad2(p[a & 0xFF], fx, fy), Ref_noise_grad2(p[(a + 1) & 0xFF], fx, fy - 1.0f), Ref_noise_fade(fy)),
+                        Ref_noise_lerp(Ref_noise_grad2(p[b & 0xFF], fx - 1.0f, fy), Ref_noise_grad2(p[(b + 1) & 0xFF], fx - 1.0f, fy - 1.0f), Ref_noise_fade(fy)),
+                        Ref_noise_fade(fx));
+}
+
+static float Ref_noise3(uint32_t x, uint32_t y, uint32_t z)
+{
+  const uint8_t *p = ws2812b_noise_perm;
+  uint32_t xi = (x >> 16) & 0xFF;
+  uint32_t yi = (y >> 16) & 0xFF;
+  uint32_t zi = (z >> 16) & 0xFF;
+  float    fx = (x & 0xFFFF) / 65536.0f;
+  float    fy = (y & 0xFFFF) / 65536.0f;
+  float    fz = (z & 0xFFFF) / 65536.0f;
+  float    u  = Ref_noise_fade(fx);
+  float    v  = Ref_noise_fade(fy);
+  uint32_t a  = p[xi] + yi;
+  uint32_t aa = p[a & 0xFF] + zi;
+  uint32_t ab = p[(a + 1) & 0xFF] + zi;
+  uint32_t b  = p[(xi + 1) & 0xFF] + yi;
+  uint32_t ba = p[b & 0xFF] + zi;
+  uint32_t bb = p[(b + 1) & 0xFF] + zi;
+  float    n0;
+  float    n1;
+
+  n0 = Ref_noise_lerp(Ref_noise_lerp(Ref_noise_grad3(p[aa & 0xFF], fx, fy, fz), Ref_noise_grad3(p[ba & 0xFF], fx - 1.0f, fy, fz), u),
+                      Ref_noise_lerp(Ref_noise_grad3(p[ab & 0xFF], fx, fy - 1.0f, fz), Ref_noise_grad3(p[bb & 0xFF], fx - 1.0f, fy - 1.0f, fz), u), v);
+  n1 = Ref_noise_lerp(Ref_noise_lerp(Ref_noise_grad3(p[(aa + 1) & 0xFF], fx, fy, fz - 1.0f), Ref_noise_grad3(p[(ba + 1) & 0xFF], fx - 1.0f, fy, fz - 1.0f), u),
+                      Ref_noise_lerp(Ref_noise_grad3(p[(ab + 1) & 0xFF], fx, fy - 1.0f, fz - 1.0f), Ref_noise_grad3(p[(bb + 1) & 0xFF], fx - 1.0f, fy - 1.0f, fz - 1.0f), u), v);
+  return Ref_noise_lerp(n0, n1, Ref_noise_fade(fz));
+}
+
+/*-------------------------------------------------------------------------------------------------------------
+     ,    -WS2812B_NOISE_ONE..WS2812B_NOISE_ONE
+-------------------------------------------------------------------------------------------------------------*/
+static uint32_t Noise_diff(int32_t v, float ref)
+{
+  int32_t r;
+
+  ref = ref * 4.0f * 8192.0f;
+  if (ref > WS2812B_NOISE_ONE) ref = WS2812B_NOISE_ONE;
+  if (ref < -WS2812B_NOISE_ONE) ref = -WS2812B_NOISE_ONE;
+  r = (int32_t)ref - v;
+  return (r < 0) ? -r : r;
+}
+
+/*-------------------------------------------------------------------------------------------------------------
+    .
+   2D  3D      ,   -      .
+         TEST_COMP_LEDS 
+-------------------------------------------------------------------------------------------------------------*/
+void LEDSC_test_noise(void)
+{
+  uint32_t       i;
+  uint32_t       k;
+  uint32_t       d;
+  uint32_t       x, y, z, dx;
+  uint32_t       err2 = 0;
+  uint32_t       err3 = 0;
+  uint32_t       err_row = 0;
+  uint32_t       t;
+  uint32_t       tst_min;
+  uint32_t       rnd = 1;
+  volatile int32_t sum = 0;
+  T_monitor_cbl *pvt100_cb;
+  pvt100_cb = (T_monitor_cbl *)_task_get_environment(_task_get_id());
+
+  pvt100_cb->_printf("\r\n--------- WS2812B Perlin noise test ---------\r\n");
+
+  for (i = 0; i < TEST_NOISE_SAMPLES; i++)
+  {
+    x = WS2812B_fx_rand(&rnd);
+    y = WS2812B_fx_rand(&rnd);
+    z = WS2812B_fx_rand(&rnd);
+    d = Noise_diff(WS2812B_noise2(x, y), Ref_noise2(x, y));
+    if (d > err2) err2 = d;
+    d = Noise_diff(WS2812B_noise3(x, y, z), Ref_noise3(x, y, z));
+    if (d > err3) err3 = d;
+  }
+  pvt100_cb->_printf("Noise 2D vs float reference  : %s, max error %d of %d\r\n", (Test_check(err2 > TEST_NOISE_ERR_MAX) == 0) ? "Ok" : "Error", err2, WS2812B_NOISE_ONE);
+  pvt100_cb->_printf("Noise 3D vs float reference  : %s, max error %d of %d\r\n", (Test_check(err3 > TEST_NOISE_ERR_MAX) == 0) ? "Ok" : "Error", err3, WS2812B_NOISE_ONE);
+
+  for (k = 0; k < TEST_NOISE_ROWS; k++)
+  {
+    x  = WS2812B_fx_rand(&rnd);
+    y  = WS2812B_fx_rand(&rnd);
+    z  = WS2812B_fx_rand(&rnd);
+    dx = WS2812B_fx_rand(&rnd) % 0x30000;
+    WS2812B_noise3_row(noise_test_row, TEST_COMP_LEDS, x, dx, y, z);
+    for (i = 0; i < TEST_COMP_LEDS; i++)
+    {
+      if (noise_test_row[i] != WS2812B_noise3(x + i * dx, y, z)) err_row++;
+    }
+    WS2812B_noise2_row(noise_test_row, TEST_COMP_LEDS, x, dx, y);
+    for (i = 0; i < TEST_COMP_LEDS; i++)
+    {
+      if (noise_test_row[i] != WS2812B_noise2(x + i * dx, y)) err_row++;
+    }
+  }
+  pvt100_cb->_printf("Row evaluation vs single     : %s, %d errors\r\n", (Test_check(err_row) == 0) ? "Ok" : "Error", err_row);
+
+  //   1/16  -   16 
+  Cycles_counter_init();
+  tst_min = 0xFFFFFFFF;
+  for (k = 0; k < TEST_PASSES; k++)
+  {
+    t = Get_cycles_counter();
+    for (i = 0; i < TEST_COMP_LEDS; i++) sum += WS2812B_noise1(i << 12);
+    t = Get_cycles_counter() - t;
+    if (t < tst_min) tst_min = t;
+  }
+  pvt100_cb->_printf("Noise 1D single   : %d cycles, %d ksamples/s\r\n", tst_min / TEST_COMP_LEDS, TEST_COMP_LEDS * 180000 / tst_min);
+  tst_min = 0xFFFFFFFF;
+  for (k = 0; k < TEST_PASSES; k++)
+  {
+    t = Get_cycles_counter();
+    for (i = 0; i < TEST_COMP_LEDS; i++) sum += WS2812B_noise2(i << 12, k << 10);
+    t = Get_cycles_counter() - t;
+    if (t < tst_min) tst_min = t;
+  }
+  pvt100_cb->_printf("Noise 2D single   : %d cycles, %d ksamples/s\r\n", tst_min / TEST_COMP_LEDS, TEST_COMP_LEDS * 180000 / tst_min);
+  tst_min = 0xFFFFFFFF;
+  for (k = 0; k < TEST_PASSES; k++)
+  {
+    t = Get_cycles_counter();
+    for (i = 0; i < TEST_COMP_LEDS; i++) sum += WS2812B_noise3(i << 12, k << 10, k << 9);
+    t = Get_cycles_counter() - t;
+    if (t < tst_min) tst_min = t;
+  }
+  pvt100_cb->_printf("Noise 3D single   : %d cycles, %d ksamples/s\r\n", tst_min / TEST_COMP_LEDS, TEST_COMP_LEDS * 180000 / tst_min);
+  tst_min = 0xFFFFFFFF;
+  for (k = 0; k < TEST_PASSES; k++)
+  {
+    t = Get_cycles_counter();
+    WS2812B_noise2_row(noise_test_row, TEST_COMP_LEDS, 0, 1 << 12, k << 10);
+    t = Get_cycles_counter() - t;
+    if (t < tst_min) tst_min = t;
+  }
+  pvt100_cb->_printf("Noise 2D row      : %d cycles, %d ksamples/s\r\n", tst_min / TEST_COMP_LEDS, TEST_COMP_LEDS * 180000 / tst_min);
+  tst_min = 0xFFFFFFFF;
+  for (k = 0; k < TEST_PASSES; k++)
+  {
+    t = Get_cycles_counter();
+    WS2812B_noise3_row(noise_test_row, TEST_COMP_LEDS, 0, 1 << 12, k << 10, k << 9);
+    t = Get_cycles_counter() - t;
+    if (t < tst_min) tst_min = t;
+  }
+  pvt100_cb->_printf("Noise 3D row      : %d cycles, %d ksamples/s\r\n", tst_min / TEST_COMP_LEDS, TEST_COMP_LEDS * 180000 / tst_min);
+}
+
+/*-------------------------------------------------------------------------------------------------------------
+      TEST_COMP_LEDS .
+          . ,   
+      ,          .
+         
+-------------------------------------------------------------------------------------------------------------*/
+void LEDSC_test_particles(void)
+{
+  T_WS2812B_pt_spawn   s;
+  T_WS2812B_pt_emitter em;
+  uint32_t       f;
+  uint32_t       i;
+  uint32_t       c;
+  uint32_t       err;
+  uint32_t       spawned;
+  uint32_t       live_max;
+  uint32_t       t;
+  uint32_t       tst_min;
+  uint32_t       rnd = 1;
+  T_monitor_cbl *pvt100_cb;
+  pvt100_cb = (T_monitor_cbl *)_task_get_environment(_task_get_id());
+
+  pvt100_cb->_printf("\r\n--------- WS2812B particles test ---------\r\n");
+
+  WS2812B_pt_init(&pt_test_pool);
+  em.s.pos        = 0;
+  em.s.speed      = 16 * 60;
+  em.s.jitter     = 30;
+  em.s.count      = 1;
+  em.s.hue        = 20;
+  em.s.hue_jitter = 30;
+  em.s.sat        = 255;
+  em.s.val        = 255;
+  em.s.life       = 50;
+  em.s.tail       = 4;
+  em.width        = TEST_COMP_LEDS;
+  em.rate         = 4000;
+  em.acc          = 0;
+
+  err      = 0;
+  spawned  = 0;
+  live_max = 0;
+  for (f = 0; f < TEST_PT_FRAMES; f++)
+  {
+    if ((f % 10) == 0)
+    {
+      //         
+      s        = em.s;
+      s.pos    = WS2812B_fx_rand(&rnd) % TEST_COMP_LEDS;
+      s.speed  = 0;
+      s.jitter = 80;
+      s.count  = 64;
+      s.tail   = 0;
+      spawned += WS2812B_pt_spawn(&pt_test_pool, &s);
+    }
+    WS2812B_pt_emit(&pt_test_pool, &em, WS2812B_fx_rand(&rnd) & 0xFF, TEST_PT_FRAME_MS);
+    WS2812B_pt_update(&pt_test_pool, TEST_PT_FRAME_MS, TEST_COMP_LEDS);
+    if (pt_test_pool.num > WS2812B_PT_MAX) err++;
+    if (pt_test_pool.num > live_max) live_max = pt_test_pool.num;
+
+    for (i = 0; i < TEST_COMP_LEDS; i++)
+    {
+      comp_ref[i] = WS2812B_fx_rand(&rnd) & 0x00FFFFFF;
+      comp_tst[i] = comp_ref[i];
+    }
+    WS2812B_pt_splat(&pt_test_pool, comp_tst, TEST_COMP_LEDS);
+    for (i = 0; i < TEST_COMP_LEDS; i++)
+    {
+      for (c = 0; c < 24; c += 8)
+      {
+        if (((comp_tst[i] >> c) & 0xFF) < ((comp_ref[i] >> c) & 0xFF)) err++;
+      }
+    }
+  }
+  pvt100_cb->_printf("Pool bound and saturation    : %s, %d errors\r\n", (Test_check(err) == 0) ? "Ok" : "Error", err);
+  pvt100_cb->_printf("Burst particles spawned      : %d, max live %d of %d\r\n", spawned, live_max, WS2812B_PT_MAX);
+
+  //          
+  em.rate = 60000;
+  for (f = 0; f < 20; f++)
+  {
+    WS2812B_pt_emit(&pt_test_pool, &em, 255, TEST_PT_FRAME_MS);
+  }
+  Cycles_counter_init();
+  tst_min = 0xFFFFFFFF;
+  for (f = 0; f < TEST_PASSES; f++)
+  {
+    t = Get_cycles_counter();
+    WS2812B_pt_update(&pt_test_pool, 0, TEST_COMP_LEDS);
+    WS2812B_pt_splat(&pt_test_pool, comp_tst, TEST_COMP_LEDS);
+    t = Get_cycles_counter() - t;
+    if (t < tst_min) tst_min = t;
+  }
+  pvt100_cb->_printf("Update and splat %d particles : %d cycles, %d cycles per particle, %d us\r\n",
+                     pt_test_pool.num, tst_min, tst_min / WS2812B_PT_MAX, tst_min / 180);
+}
+
+#define  TEST_CAPTURE_FRAMES   400  //   , 2     200 
+#define  TEST_CAPTURE_IDLE_MS  5000 //           
+#define  TEST_CAPTURE_POLL_TICKS 2  //       .      LEDSC_CAPTURE_SLOTS 
+
+/*-------------------------------------------------------------------------------------------------------------
+      SD .      .
+      
+-------------------------------------------------------------------------------------------------------------*/
+void LEDSC_test_capture(void)
+{
+  T_LEDSC_capture_stat  cs;
+  uint8_t               b;
+  uint32_t              idle = 0;
+  uint32_t              last = 0;
+  uint32_t              n;
+  uint32_t              idle_max;
+  T_monitor_cbl        *pvt100_cb;
+  pvt100_cb = (T_monitor_cbl *)_task_get_environment(_task_get_id());
+
+  pvt100_cb->_printf("\r\n--------- WS2812B frames capture ---------\r\n");
+  if (LEDSC_capture_open(TEST_CAPTURE_FRAMES) != MQX_OK)
+  {
+    pvt100_cb->_printf("Capture start error.\r\n");
+    Test_check(1);
+    return;
+  }
+  pvt100_cb->_printf("Capturing %d frames of %d LEDs from %s backend. Press any key to stop.\r\n", TEST_CAPTURE_FRAMES, WS2812B_get_geometry()->leds_num, WS2812B_get_backend()->name);
+
+  idle_max = Conv_ms_to_ticks(TEST_CAPTURE_IDLE_MS) / TEST_CAPTURE_POLL_TICKS;
+  while (LEDSC_capture_write() != 0)
+  {
+    if (pvt100_cb->_wait_char(&b, TEST_CAPTURE_POLL_TICKS) == MQX_OK) break;
+    n = WS2812B_get_stat()->frames;
+    if (n != last) idle = 0;
+    else if (++idle >= idle_max) break;
+    last = n;
+  }
+  LEDSC_capture_close(&cs);
+
+  pvt100_cb->_printf("Written frames           : %d\r\n", cs.frames);
+  pvt100_cb->_printf("Decoded from backend     : %d\r\n", cs.decoded);
+  pvt100_cb->_printf("Dropped frames           : %d\r\n", cs.dropped);
+  pvt100_cb->_printf("Waveform symbol errors   : %d\r\n", Test_check(cs.errors));
+  pvt100_cb->_printf("Max decode time          : %d cycles\r\n", cs.decode_max_cycles);
+  pvt100_cb->_printf("Files                    : %s, %s\r\n", CAPTURE_RGB_FILE_NAME, CAPTURE_LOG_FILE_NAME);
+}
+
+/*-------------------------------------------------------------------------------------------------------------
+           .
+             
+          .
+    FTM - 60 ,   - 180 
+-------------------------------------------------------------------------------------------------------------*/
+void LEDSC_test_stream_stat(void)
+{
+  const T_WS2812B_stat *st;
+  uint32_t              i;
+  T_monitor_cbl        *pvt100_cb;
+  pvt100_cb = (T_monitor_cbl *)_task_get_environment(_task_get_id());
+
+  st = WS2812B_get_stat();
+  pvt100_cb->_printf("\r\n--------- WS2812B stream statistic ---------\r\n");
+  pvt100_cb->_printf("Output backend           : %s\r\n", WS2812B_get_backend()->name);
+  pvt100_cb->_printf("Frames                   : %d\r\n", st->frames);
+  pvt100_cb->_printf("Underruns                : %d\r\n", st->underruns);
+  pvt100_cb->_printf("Refill ISR max time      : %d cycles\r\n", st->isr_max_cycles);
+  pvt100_cb->_printf("Refill ISR time budget   : %d cycles\r\n", WS2812B_STREAM_LEDS * WS2812B_get_geometry()->bits_per_led * FTM_WS2812B_MOD * 3);
+  pvt100_cb->_printf("Skipped static frames    : %d\r\n", st->skipped_frames);
+  pvt100_cb->_printf("Last render changed LEDs : %d\r\n", st->changed_leds);
+  pvt100_cb->_printf("Last render HSV converts : %d\r\n", st->converted_leds);
+  pvt100_cb->_printf("Last render encoded LEDs : %d\r\n", st->encoded_leds);
+  pvt100_cb->_printf("Last render time         : %d cycles\r\n", st->render_cycles);
+  pvt100_cb->_printf("Max render time          : %d cycles\r\n", st->render_max_cycles);
+  pvt100_cb->_printf("Frame rate               : %d fps\r\n", wvar.ws2812b_fps);
+  pvt100_cb->_printf("Render time budget       : %d cycles\r\n", st->render_budget_cycles);
+  pvt100_cb->_printf("Render overruns          : %d\r\n", st->render_overruns);
+  pvt100_cb->_printf("Dropped frames           : %d\r\n", st->dropped_frames);
+  pvt100_cb->_printf("Last tick due LEDs       : %d\r\n", st->due_leds);
+  pvt100_cb->_printf("Last render ramping LEDs : %d\r\n", st->ramp_leds);
+  pvt100_cb->_printf("State machines time      : %d ticks\r\n", st->sm_ticks);
+  pvt100_cb->_printf("Lost catch-up ticks      : %d\r\n", st->lost_ticks);
+  pvt100_cb->_printf("Strips max end skew      : %d cycles\r\n", st->strips_skew_max_cycles);
+  pvt100_cb->_printf("Last compose time        : %d cycles\r\n", st->compose_cycles);
+  pvt100_cb->_printf("Live particles           : %d\r\n", st->pt_live);
+  pvt100_cb->_printf("Last particles time      : %d cycles\r\n", st->pt_cycles);
+  for (i = 0; i < WS2812B_get_strips_num(); i++)
+  {
+    pvt100_cb->_printf("Strip %d frames           : %d\r\n", i, st->strip_frames[i]);
+  }
+}
+
+#endif
@@ -0,0 +1,21 @@
+#ifndef __LEDSC_TEST
+  #define __LEDSC_TEST
+
+
+void  LEDSC_test_encoder(void);
+void  LEDSC_test_stream_stat(void);
+void  LEDSC_test_ramp(void);
+void  LEDSC_test_transpose(void);
+void  LEDSC_test_backends(void);
+void  LEDSC_test_hsv(void);
+void  LEDSC_test_palette(void);
+void  LEDSC_test_compose(void);
+void  LEDSC_test_effects(void);
+void  LEDSC_test_vm(void);
+void  LEDSC_test_particles(void);
+void  LEDSC_test_noise(void);
+void  LEDSC_test_capture(void);
+void  LEDSC_test_waveform(void);
+uint32_t LEDSC_test_failures(void);
+
+#endif
@@ -1,6 +1,7 @@
 #include "App.h"
 //#include "SFFS_test.h"
 #include "MFS_test.h"
+#include "LEDSC_test.h"
 
 #define CNTLQ      0x11
 #define CNTLS      0x13
@@ -25,6 +26,9 @@ static void Do_SFFS_test(uint8_t keycode);
 #ifdef MFS_TEST
 static void Do_MFS_test(uint8_t keycode);
 #endif
+#if defined(LEDSC_APP) && defined(LEDSC_TEST)
+static void Do_LEDSC_test(uint8_t keycode);
+#endif
 #ifdef MQX_SHELL
 static void Do_Shell(uint8_t keycode);
 #endif
@@ -113,6 +117,9 @@ const T_VT100_Menu_item MENU_SPEC_ITEMS[] =
 #ifdef MFS_TEST
   { '3', Do_MFS_test, 0 },
 #endif
+#if defined(LEDSC_APP) && defined(LEDSC_TEST)
+  { '4', Do_LEDSC_test, 0 },
+#endif
 
   { '7', Do_malloc_test, 0 },
   { '8', Do_watchdog_test, 0 },
@@ -132,6 +139,9 @@ const T_VT100_Menu      MENU_SPEC  =
 #ifdef MFS_TEST
   "\033[5C <3> - MFS test\r\n"
 #endif
+#if defined(LEDSC_APP) && defined(LEDSC_TEST)
+  "\033[5C <4> - LED strip encoder test\r\n"
+#endif
 
   "\033[5C <7> - Malloc test\r\n"
   "\033[5C <8> - Watchdog test\r\n"
@@ -1101,6 +1111,109 @@ static void Do_MFS_test(uint8_t keycode)
 }
 #endif
 
+#if defined(LEDSC_APP) && defined(LEDSC_TEST)
+/*-----------------------------------------------------------------------------------------------------
+
+-----------------------------------------------------------------------------------------------------*/
+static void Do_LEDSC_test(uint8_t keycode)
+{
+  uint8_t        b;
+  T_monitor_cbl *mcbl;
+  mcbl = (T_monitor_cbl *)_task_get_environment(_task_get_id());
+
+  mcbl->_printf(VT100_CLEAR_AND_HOME);
+  mcbl->_printf(" ===  LED strip encoder test ===\n\r");
+  mcbl->_printf("Press 'E'- encoder test, 'P'- ramp test, 'T'- lanes transpose test, 'B'- backends test, 'D'- waveform test, 'H'- HSV test, 'L'- palette test, 'C'- compose test, 'F'- effects test, 'V'- script VM test, 'K'- particles test, 'N'- noise test, 'W'- frames capture, 'S'- stream statistic, 'R'- exit.\n\r");
+  mcbl->_printf(DASH_LINE);
+
+  do
+  {
+    if (mcbl->_wait_char(&b, 2) == MQX_OK)
+    {
+      switch (b)
+      {
+      case 'E':
+      case 'e':
+        LEDSC_test_encoder();
+        mcbl->_printf("\n\r\n\r");
+        break;
+      case 'P':
+      case 'p':
+        LEDSC_test_ramp();
+        mcbl->_printf("\n\r\n\r");
+        break;
+      case 'T':
+      case 't':
+        LEDSC_test_transpose();
+        mcbl->_printf("\n\r\n\r");
+        break;
+      case 'B':
+      case 'b':
+        LEDSC_test_backends();
+        mcbl->_printf("\n\r\n\r");
+        break;
+      case 'D':
+      case 'd':
+        LEDSC_test_waveform();
+        mcbl->_printf("\n\r\n\r");
+        break;
+      case 'H':
+      case 'h':
+        LEDSC_test_hsv();
+        mcbl->_printf("\n\r\n\r");
+        break;
+      case 'L':
+      case 'l':
+        LEDSC_test_palette();
+        mcbl->_printf("\n\r\n\r");
+        break;
+      case 'C':
+      case 'c':
+        LEDSC_test_compose();
+        mcbl->_printf("\n\r\n\r");
+        break;
+      case 'F':
+      case 'f':
+        LEDSC_test_effects();
+        mcbl->_printf("\n\r\n\r");
+        break;
+      case 'V':
+      case 'v':
+        LEDSC_test_vm();
+        mcbl->_printf("\n\r\n\r");
+        break;
+      case 'K':
+      case 'k':
+        LEDSC_test_particles();
+        mcbl->_printf("\n\r\n\r");
+        break;
+      case 'N':
+      case 'n':
+        LEDSC_test_noise();
+        mcbl->_printf("\n\r\n\r");
+        break;
+      case 'W':
+      case 'w':
+        LEDSC_test_capture();
+        mcbl->_printf("\n\r\n\r");
+        break;
+      case 'S':
+      case 's':
+        LEDSC_test_stream_stat();
+        mcbl->_printf("\n\r\n\r");
+        break;
+      case 'R':
+      case 'r':
+        return;
+      default:
+        break;
+      }
+    }
+  }
+  while (1);
+}
+#endif
+
 
 #ifdef MQX_SHELL
 /*-----------------------------------------------------------------------------------------------------
@@ -0,0 +1,90 @@
+#ifndef HOST_APP_H
+  #define HOST_APP_H
+
+//         Linux.
+//  MK66/Host     ,        Application/App.h.
+//    Application/App.h   ,    LEDSC
+
+#include   <stdint.h>
+#include   <stdbool.h>
+#include   <stddef.h>
+#include   <stdio.h>
+#include   <stdlib.h>
+#include   <string.h>
+#include   <ctype.h>
+#include   <math.h>
+#include   <limits.h>
+
+#include   "Host_mqx.h"
+#include   "Host_regs.h"
+
+#define BIT(n) (1u << n)
+#define LSHIFT(v,n) (((unsigned int)(v) << n))
+
+#define LEDSC_TEST //        
+
+#define BSP_CORE_CLOCK      180000000ul
+#define CPU_BUS_CLK_HZ      60000000ul
+
+#define MAIN_TASK_IDX           1
+#define VT100_IDX               5
+#define WS2812B_RENDER_IDX      11
+
+#define WS2812B_RENDER_PRIO     7
+#define MAIN_TASK_PRIO          8
+
+#define MAX_MQX_PRIO        BSP_DEFAULT_MQX_HARDWARE_INTERRUPT_LEVEL_MAX
+
+#define FTM3_ISR_PRIO       MAX_MQX_PRIO
+#define FTM1_ISR_PRIO       MAX_MQX_PRIO + 1
+#define WS2812B_DMA_ISR_PRIO MAX_MQX_PRIO
+#define PIT1_ISR_PRIO       MAX_MQX_PRIO + 1
+#define PIT2_ISR_PRIO       MAX_MQX_PRIO
+#define SPI0_PRIO           MAX_MQX_PRIO + 1
+#define SPI1_PRIO           MAX_MQX_PRIO + 1
+#define SPI2_PRIO           MAX_MQX_PRIO + 1
+
+#define    DISK_NAME      "a:"
+#define EFFECT_SCRIPT_FILE_NAME DISK_NAME"Effect.vm"
+#define CAPTURE_RGB_FILE_NAME   DISK_NAME"Capture.rgb"
+#define CAPTURE_LOG_FILE_NAME   DISK_NAME"Capture.csv"
+
+#define   SEVERITY_RED             0
+#define   SEVERITY_GREEN           1
+#define   SEVERITY_YELLOW          2
+#define   SEVERITY_DEFAULT         4
+
+#define __DMB()        __sync_synchronize()
+//      32-    unsigned long,  Linux  64-
+#define __LDREX(p)     (*(volatile uint32_t *)(p))
+#define __STREX(v, p)  (*(volatile uint32_t *)(p) = (v), 0)
+#define __CLREX()      ((void)0)
+
+#include   "K66BLEZ1_PERIPHERIAL.h"
+#include   "RTOS_utils.h"
+#include   "MonitorVT100.h"
+#include   "CRC_utils.h"
+#include   "LEDSC_Params.h"
+#include   "LEDSC_app/LEDSC.h"
+#include   "LEDSC_test.h"
+#include   "Host_sim.h"
+#include   "Host_wave.h"
+#include   "Host_bench.h"
+#include   "Host_stack.h"
+#include   "Host_sched.h"
+#include   "Host_blend.h"
+
+void      LOGs(const char *name, unsigned int line_num, unsigned int severity, const char *fmt_ptr, ...);
+void      Cycles_counter_init(void);
+void      FTM_init_PWM_DMA(FTM_MemMapPtr FTM);
+void      Task_WS2812B_render(uint32_t initial_data);
+void      Return_def_params(void);
+
+#define   Get_cycles_counter() Host_cycles() //   Linux   180 
+
+extern WVAR_TYPE           wvar;
+extern uint32_t            enable_led_strip;
+extern const char         *host_disk_dir;
+extern uint32_t            host_verbose;
+
+#endif
@@ -0,0 +1,246 @@
+//    ,      Linux.
+//    BENCH_LEDS  BENCH_REPEAT   ,     BENCH_PASSES .
+//         Linux,  K66     
+#include   "App.h"
+
+#define BENCH_LEDS       1024
+#define BENCH_REPEAT     200
+#define BENCH_PASSES     9
+#define BENCH_STRIP_LEDS (BENCH_LEDS / WS2812B_LANES)
+#define BENCH_FX_MS      16   //     ,   60   
+
+static uint32_t         bench_frame[BENCH_LEDS];
+static uint32_t         bench_out[BENCH_LEDS];
+static uint16_t         bench_ftm[BENCH_LEDS][WS2812B_BITS_PER_LED_MAX];
+static uint32_t         bench_spi[BENCH_LEDS][WS2812B_SPI_BYTES_PER_LED_MAX / 4];
+static uint32_t         bench_lanes[BENCH_STRIP_LEDS * WS2812B_LANE_BYTES_PER_LED / 4];
+static T_WS2812B_ramp   bench_ramps[BENCH_LEDS];
+static uint32_t         bench_layer[2][BENCH_LEDS];
+static T_WS2812B_layer  bench_layers[3];
+static int16_t          bench_noise[BENCH_LEDS];
+static T_WS2812B_fx     bench_fx[WS2812B_FX_NUM];
+static uint32_t         bench_fx_ms[WS2812B_FX_NUM];
+static uint8_t          bench_heat[BENCH_LEDS]; //  ,     
+static T_WS2812B_vm_prog bench_prog;
+
+//   ,   LEDSC_test_vm: h = i * 360 / width + ms * speed / 64, s = sat, v = val
+static const uint8_t    bench_rainbow[] =
+{
+  WS2812B_VM_LED, WS2812B_VM_P_PUSH(360), WS2812B_VM_MUL, WS2812B_VM_P_PARAM(5), WS2812B_VM_DIV,
+  WS2812B_VM_TIME, WS2812B_VM_P_PARAM(0), WS2812B_VM_MUL, WS2812B_VM_P_PUSH8(6), WS2812B_VM_SHR, WS2812B_VM_ADD,
+  WS2812B_VM_P_PARAM(2), WS2812B_VM_P_PARAM(3),
+  WS2812B_VM_HSV
+};
+static uint32_t         bench_k;
+
+/*-----------------------------------------------------------------------------------------------------
+       WS2812B_set_led_state:         
+-----------------------------------------------------------------------------------------------------*/
+static void Bench_bitwise(void)
+{
+  const T_WS2812B_geometry *g = WS2812B_get_geometry();
+  uint32_t                  n, c, i;
+  uint32_t                  rgb;
+  uint8_t                   b;
+
+  for (n = 0; n < BENCH_LEDS; n++)
+  {
+    rgb = bench_frame[n];
+    for (c = 0; c < g->colrs; c++)
+    {
+      b = ws2812b_out_lut[g->shift[c] >> 3][(rgb >> g->shift[c]) & 0xFF];
+      for (i = 0; i < 8; i++)
+      {
+        if ((b >> (7 - i)) & 1) bench_ftm[n][c * 8 + i] = FTM_WS2812B_1;
+        else bench_ftm[n][c * 8 + i] = FTM_WS2812B_0;
+      }
+    }
+  }
+}
+
+static void Bench_ftm(void)
+{
+  uint32_t n;
+
+  for (n = 0; n < BENCH_LEDS; n++) WS2812B_encode_rgb(bench_ftm[n], bench_frame[n]);
+}
+
+static void Bench_spi(void)
+{
+  uint32_t n;
+
+  for (n = 0; n < BENCH_LEDS; n++) WS2812B_SPI_encode_rgb((uint8_t *)bench_spi[n], bench_frame[n]);
+}
+
+static void Bench_gpio(void)
+{
+  WS2812B_transpose_frame(bench_lanes, bench_frame, BENCH_LEDS, BENCH_STRIP_LEDS, 0xFF, ws2812b_out_lut);
+}
+
+static void Bench_hsv(void)
+{
+  uint32_t n;
+
+  for (n = 0; n < BENCH_LEDS; n++) bench_out[n] = WS2812B_hsv_to_rgb(n % 361, (n * 7) & 0xFF, (n * 13) & 0xFF);
+}
+
+static void Bench_ramp(void)
+{
+  uint32_t n;
+
+  bench_k = (bench_k + 1) % 80;
+  for (n = 0; n < BENCH_LEDS; n++) bench_out[n] = WS2812B_ramp_value(&bench_ramps[n], bench_k);
+}
+
+static void Bench_compose(void)
+{
+  WS2812B_compose(bench_out, bench_layers, 3, BENCH_LEDS);
+}
+
+static void Bench_noise(void)
+{
+  bench_k++;
+  WS2812B_noise3_row(bench_noise, BENCH_LEDS, 0, 1 << 12, bench_k << 8, bench_k << 6);
+}
+
+/*-----------------------------------------------------------------------------------------------------
+    .     ,    BENCH_FX_MS
+-----------------------------------------------------------------------------------------------------*/
+static void Bench_fx(uint32_t id)
+{
+  bench_fx_ms[id] += BENCH_FX_MS;
+  WS2812B_fx_render(&bench_fx[id], bench_out, BENCH_LEDS, bench_fx_ms[id]);
+}
+
+static void Bench_fx_rainbow(void)
+{
+  Bench_fx(WS2812B_FX_RAINBOW);
+}
+
+static void Bench_fx_chase(void)
+{
+  Bench_fx(WS2812B_FX_CHASE);
+}
+
+static void Bench_fx_fire(void)
+{
+  Bench_fx(WS2812B_FX_FIRE);
+}
+
+static void Bench_fx_twinkle(void)
+{
+  Bench_fx(WS2812B_FX_TWINKLE);
+}
+
+static void Bench_fx_noise(void)
+{
+  Bench_fx(WS2812B_FX_NOISE);
+}
+
+//        
+static void Bench_fx_script(void)
+{
+  Bench_fx(WS2812B_FX_SCRIPT);
+}
+
+typedef struct
+{
+  const char *key;   //     
+  const char *name;
+  void      (*func)(void);
+} T_bench;
+
+static const T_bench benches[] =
+{
+  { "bitwise",  "FTM bitwise encoder",  Bench_bitwise },
+  { "ftm",      "FTM table encoder",    Bench_ftm     },
+  { "spi",      "SPI table encoder",    Bench_spi     },
+  { "gpio",     "GPIO block transpose", Bench_gpio    },
+  { "hsv",      "HSV to RGB",           Bench_hsv     },
+  { "ramp",     "Q16 ramp",             Bench_ramp    },
+  { "compose",  "Compose 3 layers",     Bench_compose },
+  { "noise",    "Noise 3D row",         Bench_noise   },
+  { "rainbow",  "Effect rainbow",       Bench_fx_rainbow },
+  { "chase",    "Effect chase",         Bench_fx_chase   },
+  { "fire",     "Effect fire",          Bench_fx_fire    },
+  { "twinkle",  "Effect twinkle",       Bench_fx_twinkle },
+  { "fxnoise",  "Effect noise",         Bench_fx_noise   },
+  { "script",   "Script VM rainbow",    Bench_fx_script  },
+};
+
+/*-----------------------------------------------------------------------------------------------------
+   .  LEDSC   :       .
+
+  keys -   ,  num = 0  
+     
+-----------------------------------------------------------------------------------------------------*/
+int Host_bench(char **keys, uint32_t num)
+{
+  const T_WS2812B_geometry *g = WS2812B_get_geometry();
+  uint32_t                  i, k, n, p;
+  uint64_t                  t;
+  uint64_t                  t_min;
+  double                    ns;
+  double                    ns_ref = 0;
+  uint32_t                  rnd = 1;
+  T_WS2812B_fx_params       fp;
+
+  WS2812B_SPI_init_lut(g);
+  for (i = 0; i < BENCH_LEDS; i++)
+  {
+    bench_frame[i]    = WS2812B_fx_rand(&rnd) & 0xFFFFFF;
+    bench_layer[0][i] = WS2812B_fx_rand(&rnd) & 0xFFFFFF;
+    bench_layer[1][i] = WS2812B_fx_rand(&rnd) & 0xFFFFFF;
+    WS2812B_ramp_init(&bench_ramps[i], HSV_RED, HSV_BLUE - i, 80 + (i & 0xFF));
+  }
+  // ,    ,   LEDSC_test_compose
+  for (i = 0; i < 3; i++)
+  {
+    bench_layers[i].pix   = (i == 0) ? bench_frame : bench_layer[i - 1];
+    bench_layers[i].mode  = (i == 0) ? WS2812B_BLEND_ALPHA : ((i == 1) ? WS2812B_BLEND_ADD : WS2812B_BLEND_MAX);
+    bench_layers[i].alpha = 77;
+  }
+  //    LEDSC_test_effects
+  fp.speed   = 255;
+  fp.hue     = 0;
+  fp.sat     = 255;
+  fp.val     = 255;
+  fp.density = 128;
+  fp.width   = 60;
+  for (i = WS2812B_FX_RAINBOW; i < WS2812B_FX_NUM; i++)
+  {
+    fp.id = i;
+    WS2812B_fx_init(&bench_fx[i], &fp, bench_heat, BENCH_LEDS, 0);
+    bench_fx_ms[i] = 0;
+  }
+  if (WS2812B_vm_load(&bench_prog, bench_rainbow, sizeof(bench_rainbow)) != WS2812B_VM_OK)
+  {
+    fprintf(stderr, "Script program load error\n");
+    return 2;
+  }
+  bench_fx[WS2812B_FX_SCRIPT].prog = &bench_prog;
+
+  printf("LEDs %u, color order %u, %u LEDs x %u repeats, min of %u passes\n", g->leds_num, g->order, BENCH_LEDS, BENCH_REPEAT, BENCH_PASSES);
+  for (i = 0; i < sizeof(benches) / sizeof(benches[0]); i++)
+  {
+    for (k = 0; k < num; k++)
+    {
+      if (strcmp(keys[k], benches[i].key) == 0) break;
+    }
+    if ((num != 0) && (k == num)) continue;
+    t_min = UINT64_MAX;
+    for (p = 0; p < BENCH_PASSES; p++)
+    {
+      t = Host_cpu_ns();
+      for (n = 0; n < BENCH_REPEAT; n++) benches[i].func();
+      t = Host_cpu_ns() - t;
+      if (t < t_min) t_min = t;
+    }
+    ns = (double)t_min / ((double)BENCH_REPEAT * BENCH_LEDS);
+    if (i == 0) ns_ref = ns;
+    printf("%-24s : %7.3f ns per LED, %7.1f MLEDs/s", benches[i].name, ns, 1000.0 / ns);
+    if ((i > 0) && (i < 4) && (ns_ref != 0)) printf(", x%.1f vs bitwise", ns_ref / ns);
+    printf("\n");
+  }
+  return 0;
+}
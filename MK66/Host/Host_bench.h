@@ -0,0 +1,8 @@
+#ifndef HOST_BENCH_H
+  #define HOST_BENCH_H
+
+//       Linux.  -      
+
+int       Host_bench(char **keys, uint32_t num);
+
+#endif
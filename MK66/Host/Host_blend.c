@@ -0,0 +1,107 @@
+//      Linux.
+//            ,       
+//  0..WS2812B_ALPHA_MAX.         SIMD
+#include   "App.h"
+
+#define BLEND_PAIRS   65536 //    d, s
+#define BLEND_LANE    16411 //      ,      
+
+typedef struct
+{
+  const char *name;
+  void      (*blend)(uint32_t *dst, const uint32_t *src, uint32_t n, uint32_t mode, uint32_t alpha);
+} T_blend_impl;
+
+static const T_blend_impl blend_impls[] =
+{
+  { "portable", WS2812B_blend     },
+  { "SIMD",     WS2812B_blend_dsp },
+};
+
+#define BLEND_IMPLS (sizeof(blend_impls) / sizeof(blend_impls[0]))
+
+static uint32_t blend_d[BLEND_PAIRS];
+static uint32_t blend_s[BLEND_PAIRS];
+static uint32_t blend_r[BLEND_PAIRS];
+static uint8_t  blend_ref[BLEND_PAIRS];
+
+/*-----------------------------------------------------------------------------------------------------
+     s    d     LEDSC_WS2812B_blend.h
+-----------------------------------------------------------------------------------------------------*/
+static uint32_t Blend_ref(uint32_t d, uint32_t s, uint32_t mode, uint32_t alpha)
+{
+  uint32_t c;
+
+  switch (mode)
+  {
+  case WS2812B_BLEND_ADD:
+    c = d + s;
+    if (c > 255) c = 255;
+    break;
+  case WS2812B_BLEND_MAX:
+    c = (d > s) ? d : s;
+    break;
+  case WS2812B_BLEND_MUL:
+    c = (d * s * 2 + 255) / 510;
+    break;
+  default:
+    c = s;
+    break;
+  }
+  return (c * alpha + d * (WS2812B_ALPHA_MAX - alpha)) >> 8;
+}
+
+/*-----------------------------------------------------------------------------------------------------
+    .       
+-----------------------------------------------------------------------------------------------------*/
+uint32_t Host_test_blend(void)
+{
+  uint32_t i, k, p;
+  uint32_t mode;
+  uint32_t alpha;
+  uint32_t m;
+  uint32_t err[BLEND_IMPLS] = { 0 };
+  uint32_t total = 0;
+
+  printf("\n--------- WS2812B layers exhaustive blend test ---------\n");
+
+  for (i = 0; i < BLEND_PAIRS; i++)
+  {
+    blend_d[i] = 0;
+    blend_s[i] = 0;
+    for (k = 0; k < 4; k++)
+    {
+      p = (i + k * BLEND_LANE) & (BLEND_PAIRS - 1);
+      blend_d[i] |= (p >> 8) << (k * 8);
+      blend_s[i] |= (p & 0xFF) << (k * 8);
+    }
+  }
+
+  for (mode = 0; mode < WS2812B_BLEND_NUM; mode++)
+  {
+    for (alpha = 0; alpha <= WS2812B_ALPHA_MAX; alpha++)
+    {
+      for (p = 0; p < BLEND_PAIRS; p++) blend_ref[p] = (uint8_t)Blend_ref(p >> 8, p & 0xFF, mode, alpha);
+      for (m = 0; m < BLEND_IMPLS; m++)
+      {
+        memcpy(blend_r, blend_d, sizeof(blend_r));
+        blend_impls[m].blend(blend_r, blend_s, BLEND_PAIRS, mode, alpha);
+        for (i = 0; i < BLEND_PAIRS; i++)
+        {
+          for (k = 0; k < 4; k++)
+          {
+            p = (i + k * BLEND_LANE) & (BLEND_PAIRS - 1);
+            if (((blend_r[i] >> (k * 8)) & 0xFF) != blend_ref[p]) err[m]++;
+          }
+        }
+      }
+    }
+  }
+
+  for (m = 0; m < BLEND_IMPLS; m++)
+  {
+    printf("Blend %-8s mismatches : %u of %u bytes\n", blend_impls[m].name, err[m], BLEND_PAIRS * 4 * WS2812B_BLEND_NUM * (WS2812B_ALPHA_MAX + 1));
+    total += err[m];
+  }
+  return total;
+}
@@ -0,0 +1,11 @@
+#ifndef HOST_BLEND_H
+  #define HOST_BLEND_H
+
+//             LEDSC_WS2812B_blend
+
+//  LEDSC_WS2812B_blend      __ARM_MEDIA__    SIMD  intrinsics.h
+void      WS2812B_blend_dsp(uint32_t *dst, const uint32_t *src, uint32_t n, uint32_t mode, uint32_t alpha);
+
+uint32_t  Host_test_blend(void);
+
+#endif
@@ -0,0 +1,345 @@
+//      Linux   .
+//
+// host_ledsc render [] -   :     FTM0,
+//                                         -o
+// host_ledsc sweep []  -     -lat :    
+//                                      
+// host_ledsc test [] [] -     ,   -  .
+//                                   1       
+// host_ledsc stack []  -      : , , ,  ,
+//                                 ,    
+// host_ledsc bench [] [] -  ,        
+#include   "App.h"
+#include   <unistd.h>
+#include   <sys/wait.h>
+
+#define HOST_SWEEP_LAT_US   150 //      
+#define HOST_SWEEP_STEP_US  5
+#define HOST_STACK_TICKS    100 //         
+
+//  
+typedef struct
+{
+  uint32_t    frames;   //    
+  const char *dir;      //   
+  int32_t     leds;     //  , -1 -  
+  int32_t     strips;   //  
+  int32_t     order;    //  
+  int32_t     fps;      //  
+  uint32_t    lat_us;   //     
+  uint32_t    jit_us;   //       
+  uint32_t    refill;   //          
+  char      **names;    //  
+  uint32_t    names_num;
+} T_host_opts;
+
+typedef struct
+{
+  const char *name;
+  void      (*func)(void);     //  ,    LEDSC_test_failures
+  uint32_t  (*check)(void);    //   Linux,   
+} T_host_test;
+
+//      Linux   .         
+static const T_host_test host_tests[] =
+{
+  { "encoder",    LEDSC_test_encoder     },
+  { "ramp",       LEDSC_test_ramp        },
+  { "sched",      0, Host_test_sched     },
+  { "transpose",  LEDSC_test_transpose   },
+  { "backends",   LEDSC_test_backends    },
+  { "waveform",   LEDSC_test_waveform    },
+  { "hsv",        LEDSC_test_hsv         },
+  { "compose",    LEDSC_test_compose     },
+  { "blend",      0, Host_test_blend     },
+  { "effects",    LEDSC_test_effects     },
+  { "vm",         LEDSC_test_vm          },
+  { "noise",      LEDSC_test_noise       },
+  { "particles",  LEDSC_test_particles   },
+  { "palette",    LEDSC_test_palette     },
+  { "capture",    LEDSC_test_capture     },
+  { "stat",       LEDSC_test_stream_stat },
+};
+
+#define HOST_TESTS_NUM (sizeof(host_tests) / sizeof(host_tests[0]))
+
+static T_host_opts opts = { 100, ".", -1, -1, -1, -1, 0, 0, HOST_REFILL_CYCLES, 0, 0 };
+static uint32_t    capture_pending; //      ,   
+
+uint32_t __real_LEDSC_capture_frame(const T_WS2812B_backend *out, const uint32_t *frame);
+void     __real_LEDSC_capture_done(const T_WS2812B_stat *ws);
+
+/*-----------------------------------------------------------------------------------------------------
+      (  --wrap).
+         ,      
+-----------------------------------------------------------------------------------------------------*/
+uint32_t __wrap_LEDSC_capture_frame(const T_WS2812B_backend *out, const uint32_t *frame)
+{
+  uint32_t t = Get_cycles_counter();
+
+  Host_wave_expect(frame, WS2812B_get_stat()->encoded_leds);
+  Host_sched_frame(frame);
+  capture_pending = 1;
+  t = Get_cycles_counter() - t;
+  return __real_LEDSC_capture_frame(out, frame) + t; //       
+}
+
+/*-----------------------------------------------------------------------------------------------------
+    :           
+-----------------------------------------------------------------------------------------------------*/
+void __wrap_LEDSC_capture_done(const T_WS2812B_stat *ws)
+{
+  if (capture_pending)
+  {
+    Host_wave_render_time(ws->render_cycles);
+    capture_pending = 0;
+  }
+  Host_sched_render(ws);
+  __real_LEDSC_capture_done(ws);
+}
+
+static int Host_frames_done(void)
+{
+  return host_wave_stat.frames >= opts.frames;
+}
+
+/*-----------------------------------------------------------------------------------------------------
+    .  0  
+-----------------------------------------------------------------------------------------------------*/
+static uint32_t Host_parse_opts(int argc, char **argv)
+{
+  int i;
+
+  opts.names = argv;
+  for (i = 0; i < argc; i++)
+  {
+    if (argv[i][0] != '-')
+    {
+      opts.names[opts.names_num++] = argv[i]; //       
+      continue;
+    }
+    if (i + 1 >= argc) return 0;
+    if (strcmp(argv[i], "-n") == 0) opts.frames = strtoul(argv[++i], 0, 0);
+    else if (strcmp(argv[i], "-o") == 0) opts.dir = argv[++i];
+    else if (strcmp(argv[i], "-leds") == 0) opts.leds = strtol(argv[++i], 0, 0);
+    else if (strcmp(argv[i], "-strips") == 0) opts.strips = strtol(argv[++i], 0, 0);
+    else if (strcmp(argv[i], "-order") == 0) opts.order = strtol(argv[++i], 0, 0);
+    else if (strcmp(argv[i], "-fps") == 0) opts.fps = strtol(argv[++i], 0, 0);
+    else if (strcmp(argv[i], "-lat") == 0) opts.lat_us = strtoul(argv[++i], 0, 0);
+    else if (strcmp(argv[i], "-jit") == 0) opts.jit_us = strtoul(argv[++i], 0, 0);
+    else if (strcmp(argv[i], "-isr") == 0) opts.refill = strtoul(argv[++i], 0, 0);
+    else return 0;
+  }
+  return 1;
+}
+
+/*-----------------------------------------------------------------------------------------------------
+      ,    LEDSC_task
+-----------------------------------------------------------------------------------------------------*/
+static void Host_ledsc_start(void)
+{
+  static const uint32_t blank[WS2812B_LEDS_MAX];
+
+  Host_sim_init();
+  Return_def_params();
+  if (opts.leds >= 0) wvar.ws2812b_leds_num = opts.leds;
+  if (opts.strips >= 0) wvar.ws2812b_strips_num = opts.strips;
+  if (opts.order >= 0) wvar.ws2812b_color_order = opts.order;
+  if (opts.fps >= 0) wvar.ws2812b_fps = opts.fps;
+  host_isr_latency = (uint32_t)HOST_US(opts.lat_us);
+  host_isr_jitter  = (uint32_t)HOST_US(opts.jit_us);
+  host_refill_cycles = opts.refill;
+  host_disk_dir    = opts.dir;
+
+  Host_wave_init();
+  FTM_init_PWM_DMA(FTM0_BASE_PTR);
+  WS2812B_Demo_DMA();
+  Host_wave_expect(blank, 0); //       
+  _task_create(0, WS2812B_RENDER_IDX, 0);
+  enable_led_strip = 1;
+}
+
+/*-----------------------------------------------------------------------------------------------------
+       opts.frames .
+       :    ,  , 2 -    
+-----------------------------------------------------------------------------------------------------*/
+static uint32_t Host_render_run(void)
+{
+  uint32_t err;
+
+  if (Host_wave_open(opts.dir) == 0)
+  {
+    fprintf(stderr, "Unable to create output files in %s\n", opts.dir);
+    return 2;
+  }
+  Host_ledsc_start();
+  Host_run(HOST_US(200000ull) * (opts.frames + 10), Host_frames_done);
+  Host_wave_close();
+
+  err = host_wave_stat.bad_leds + host_wave_stat.sym_errs + host_wave_stat.unexpected + host_wave_stat.lost + host_wave_stat.gap_errs;
+  if (host_wave_stat.frames < opts.frames) err++;
+  return err;
+}
+
+/*-----------------------------------------------------------------------------------------------------
+       
+-----------------------------------------------------------------------------------------------------*/
+static int Host_render(void)
+{
+  const T_WS2812B_stat *ws = WS2812B_get_stat();
+  uint32_t              err;
+
+  err = Host_render_run();
+  if (err == 2) return 2;
+
+  printf("Frames decoded           : %u of %u\n", host_wave_stat.frames, opts.frames);
+  printf("Mismatched LEDs          : %u\n", host_wave_stat.bad_leds);
+  printf("Symbol errors            : %u\n", host_wave_stat.sym_errs);
+  printf("Unexpected/lost frames   : %u/%u\n", host_wave_stat.unexpected, host_wave_stat.lost);
+  printf("Reset gap min            : %u bits, %u shorter than %u\n", (host_wave_stat.frames > 1) ? host_wave_stat.gap_min : 0, host_wave_stat.gap_errs, WS2812B_RESET_BITS);
+  printf("Driver underruns         : %u\n", ws->underruns);
+  printf("Dropped/skipped renders  : %u/%u\n", ws->dropped_frames, ws->skipped_frames);
+  printf("Render CPU time          : %.1f us avg, %.1f us max per task run\n",
+         host_sim_stat.render_runs ? host_sim_stat.render_ns / 1000.0 / host_sim_stat.render_runs : 0.0, host_sim_stat.render_max_ns / 1000.0);
+  printf("ISR max delay            : %.2f us\n", host_sim_stat.isr_max_delay / (double)(HOST_BUS_HZ / 1000000ull));
+  printf("Simulated time           : %.3f s\n", host_now / (double)HOST_BUS_HZ);
+  return (err != 0) ? 1 : 0;
+}
+
+/*-----------------------------------------------------------------------------------------------------
+       0  -lat   HOST_SWEEP_STEP_US.
+          (-isr  ).
+          ,      .
+        :   
+       ,     .
+   1         
+-----------------------------------------------------------------------------------------------------*/
+static int Host_sweep(void)
+{
+  uint32_t lat_max = (opts.lat_us != 0) ? opts.lat_us : HOST_SWEEP_LAT_US;
+  uint32_t lat;
+  uint32_t err;
+  uint32_t und;
+  uint32_t mism = 0;
+  uint32_t strips = (opts.strips > 0) ? opts.strips : 1; //    -  
+  pid_t    pid;
+  int      status;
+
+  printf("Half buffer transfer time: %.1f us\n", WS2812B_STREAM_LEDS * WS2812B_BITS_PER_LED * (FTM_WS2812B_MOD + 1) / (double)(HOST_BUS_HZ / 1000000ull));
+  printf("Refill ISR budget        : %u + %u cycles per strip, %.2f us for %d strips\n", HOST_ISR_ENTRY_CYCLES, opts.refill,
+         (HOST_ISR_ENTRY_CYCLES + opts.refill * strips) / (double)(BSP_CORE_CLOCK / 1000000ul), strips);
+  printf("%6s %6s %10s %10s %10s %10s %8s %s\n", "lat", "jit", "underruns", "frames", "bad LEDs", "sym errs", "gap errs", "output / counter");
+  fflush(stdout);
+  for (lat = 0; lat <= lat_max; lat += HOST_SWEEP_STEP_US)
+  {
+    pid = fork();
+    if (pid < 0) return 2;
+    if (pid == 0)
+    {
+      opts.lat_us = lat;
+      err = Host_render_run();
+      und = WS2812B_get_stat()->underruns;
+      printf("%6u %6u %10u %10u %10u %10u %8u %s / %s\n", lat, opts.jit_us, und, host_wave_stat.frames,
+             host_wave_stat.bad_leds, host_wave_stat.sym_errs, host_wave_stat.gap_errs,
+             (err != 0) ? "FAIL" : "ok  ", (und != 0) ? "underrun" : "ok");
+      fflush(stdout);
+      exit(((err != 0) == (und != 0)) ? 0 : 1);
+    }
+    waitpid(pid, &status, 0);
+    if (!WIFEXITED(status) || (WEXITSTATUS(status) != 0)) mism++;
+  }
+  printf("Counter/output mismatches: %u\n", mism);
+  return (mism != 0) ? 1 : 0;
+}
+
+/*-----------------------------------------------------------------------------------------------------
+       .       
+-----------------------------------------------------------------------------------------------------*/
+static int Host_test(void)
+{
+  uint32_t i, k;
+  uint32_t n;
+  uint32_t failed = 0;
+
+  for (k = 0; k < opts.names_num; k++)
+  {
+    for (i = 0; i < HOST_TESTS_NUM; i++)
+    {
+      if (strcmp(opts.names[k], host_tests[i].name) == 0) break;
+    }
+    if (i == HOST_TESTS_NUM)
+    {
+      fprintf(stderr, "Unknown test %s\n", opts.names[k]);
+      return 2;
+    }
+  }
+
+  Host_ledsc_start();
+  Host_run(HOST_US(100000ull), 0); //      
+  LEDSC_test_failures();
+  for (i = 0; i < HOST_TESTS_NUM; i++)
+  {
+    if (opts.names_num != 0)
+    {
+      for (k = 0; k < opts.names_num; k++)
+      {
+        if (strcmp(opts.names[k], host_tests[i].name) == 0) break;
+      }
+      if (k == opts.names_num) continue;
+    }
+    if (host_tests[i].func != 0) host_tests[i].func();
+    n = LEDSC_test_failures();
+    if (host_tests[i].check != 0) n += host_tests[i].check();
+    if (n != 0)
+    {
+      printf("*** %s: %u checks failed\n", host_tests[i].name, n);
+      failed++;
+    }
+  }
+  printf("\nTests failed             : %u\n", failed);
+  return (failed != 0) ? 1 : 0;
+}
+
+static void Host_usage(void)
+{
+  uint32_t i;
+
+  fprintf(stderr,
+          "usage: host_ledsc render [-n frames] [-o dir] [-leds n] [-strips n] [-order n] [-fps n] [-lat us] [-jit us] [-isr cycles]\n"
+          "       host_ledsc sweep [-n frames] [-o dir] [-leds n] [-strips n] [-order n] [-fps n] [-lat max_us] [-jit us] [-isr cycles]\n"
+          "       host_ledsc test [test ...] [-o dir] [-leds n] [-strips n] [-order n] [-fps n] [-lat us] [-jit us]\n"
+          "       host_ledsc stack [-o dir] [-leds n] [-strips n] [-order n] [-fps n]\n"
+          "       host_ledsc bench [bitwise|ftm|spi|gpio|hsv|ramp|compose|noise|rainbow|chase|fire|twinkle|fxnoise|script ...] [-leds n] [-strips n] [-order n]\n"
+          "tests:");
+  for (i = 0; i < HOST_TESTS_NUM; i++) fprintf(stderr, " %s", host_tests[i].name);
+  fputc('\n', stderr);
+}
+
+int main(int argc, char **argv)
+{
+  if (argc < 2)
+  {
+    Host_usage();
+    return 2;
+  }
+  if (Host_parse_opts(argc - 2, argv + 2) == 0)
+  {
+    Host_usage();
+    return 2;
+  }
+  if ((strcmp(argv[1], "render") == 0) && (opts.names_num == 0)) return Host_render();
+  if ((strcmp(argv[1], "sweep") == 0) && (opts.names_num == 0)) return Host_sweep();
+  if (strcmp(argv[1], "test") == 0) return Host_test();
+  if ((strcmp(argv[1], "stack") == 0) && (opts.names_num == 0))
+  {
+    Host_ledsc_start();
+    return Host_stack(HOST_STACK_TICKS);
+  }
+  if (strcmp(argv[1], "bench") == 0)
+  {
+    Host_ledsc_start();
+    return Host_bench(opts.names, opts.names_num);
+  }
+  Host_usage();
+  return 2;
+}
@@ -0,0 +1,88 @@
+#ifndef HOST_MQX_H
+  #define HOST_MQX_H
+
+//  MQX    .   Host_rtos.c.
+//    ,  RTOS     Host_sim.c
+
+typedef unsigned int    _mqx_uint;
+typedef int             _mqx_int;
+typedef void           *_task_id;
+typedef void           *MQX_FILE_PTR;
+typedef void          (*INT_ISR_FPTR)(void *);
+typedef void          (*INT_KERNEL_ISR_FPTR)(void);
+
+#define MQX_OK                    0
+#define MQX_ERROR                 1
+#define MQX_INVALID_PARAMETER     0x0C
+#define LWEVENT_WAIT_TIMEOUT      0x10A
+#define MQX_LWEVENT_INVALID       0x103
+
+#define FALSE                     0
+#define TRUE                      1
+
+#define LWEVENT_VALID             0x6C77
+#define LWEVENT_AUTO_CLEAR        1
+
+typedef struct
+{
+  volatile _mqx_uint  VALUE;
+  _mqx_uint           AUTO;
+  _mqx_uint           FLAGS;
+  _mqx_uint           VALID;
+} LWEVENT_STRUCT;
+
+typedef struct
+{
+  _mqx_uint  TICKS[2];
+  uint32_t   HW_TICKS;
+} MQX_TICK_STRUCT;
+
+typedef struct
+{
+  uint32_t  SECONDS;
+  uint32_t  MILLISECONDS;
+} TIME_STRUCT;
+
+typedef void *MUTEX_STRUCT_PTR;
+
+//  ,   K66BLEZ1_CAN.h
+typedef struct
+{
+  uint16_t  SIZE;
+  uint16_t  TARGET_QID;
+  uint16_t  SOURCE_QID;
+  uint8_t   CONTROL;
+  uint8_t   RESERVED;
+} MESSAGE_HEADER_STRUCT;
+
+#define BSP_DEFAULT_MQX_HARDWARE_INTERRUPT_LEVEL_MAX 2
+
+void         _int_disable(void);
+void         _int_enable(void);
+
+_mqx_uint    _lwevent_create(LWEVENT_STRUCT *ev, _mqx_uint flags);
+_mqx_uint    _lwevent_set(LWEVENT_STRUCT *ev, _mqx_uint mask);
+_mqx_uint    _lwevent_clear(LWEVENT_STRUCT *ev, _mqx_uint mask);
+_mqx_uint    _lwevent_wait_ticks(LWEVENT_STRUCT *ev, _mqx_uint mask, bool all, _mqx_uint ticks);
+_mqx_uint    _lwevent_get_signalled(void);
+
+void        *_mem_alloc(uint32_t sz);
+void        *_mem_alloc_zero(uint32_t sz);
+void        *_mem_alloc_system_zero(uint32_t sz);
+_mqx_uint    _mem_free(void *p);
+
+void         _time_get_elapsed_ticks(MQX_TICK_STRUCT *tk);
+_mqx_uint    _time_get_ticks_per_sec(void);
+uint32_t     _time_get_hwticks_per_tick(void);
+void         _time_delay_ticks(uint32_t ticks);
+
+_task_id     _task_create(_mqx_uint proc, _mqx_uint idx, uint32_t param);
+_task_id     _task_get_id(void);
+void        *_task_get_environment(_task_id id);
+
+MQX_FILE_PTR _io_fopen(const char *name, const char *mode);
+_mqx_int     _io_read(MQX_FILE_PTR f, void *buf, _mqx_int len);
+_mqx_int     _io_write(MQX_FILE_PTR f, void *buf, _mqx_int len);
+_mqx_int     _io_fclose(MQX_FILE_PTR f);
+
+#endif
@@ -0,0 +1,98 @@
+#ifndef HOST_REGS_H
+  #define HOST_REGS_H
+
+//      Linux.
+//  DMA, DMAMUX, FTM0, PIT  . -     ,      Host_sim.c.
+//    PIE,       32-   DMA.
+//
+// ,     , :     
+//       Host_reg_access().      ,
+//             .
+//     FTM->CNT ,   SERQ/SSRT     
+
+//     MK65F18.h ,   
+#define DMA_MemMap        Host_hw_DMA_MemMap
+#define DMA_MemMapPtr     Host_hw_DMA_MemMapPtr
+#define FTM_MemMap        Host_hw_FTM_MemMap
+#define FTM_MemMapPtr     Host_hw_FTM_MemMapPtr
+#define PIT_MemMap        Host_hw_PIT_MemMap
+#define PIT_MemMapPtr     Host_hw_PIT_MemMapPtr
+
+#include "MK65F18.h"
+
+#undef  DMA_MemMap
+#undef  DMA_MemMapPtr
+#undef  FTM_MemMap
+#undef  FTM_MemMapPtr
+#undef  PIT_MemMap
+#undef  PIT_MemMapPtr
+
+#define HOST_INT_MARK  0x80000000u //     DMA->INT.     ,   
+
+typedef struct DMA_MemMap
+{
+  struct Host_hw_DMA_MemMap;  //    , TCD[]   
+  uint8_t   cerq[1];
+  uint8_t   serq[1];
+  uint8_t   cdne[1];
+  uint8_t   ssrt[1];
+  uint8_t   cint[1];
+  uint32_t  intr[1];
+} volatile *DMA_MemMapPtr;
+
+typedef struct FTM_MemMap
+{
+  struct Host_hw_FTM_MemMap;
+  uint32_t  cnt[1];
+} volatile *FTM_MemMapPtr;
+
+typedef struct PIT_MemMap
+{
+  uint32_t  MCR;
+  struct
+  {
+    uint32_t  LDVAL;
+    uint32_t  CVAL;
+    uint32_t  tctrl[1];
+    uint32_t  TFLG;
+  } CHANNEL[4];
+} volatile *PIT_MemMapPtr;
+
+uint32_t Host_reg_access(void);
+
+#define CERQ    cerq[Host_reg_access()]
+#define SERQ    serq[Host_reg_access()]
+#define CDNE    cdne[Host_reg_access()]
+#define SSRT    ssrt[Host_reg_access()]
+#define CINT    cint[Host_reg_access()]
+#define INT     intr[Host_reg_access()]
+#define CNT     cnt[Host_reg_access()]
+#define TCTRL   tctrl[Host_reg_access()]
+
+extern struct DMA_MemMap     host_dma;
+extern struct FTM_MemMap     host_ftm0;
+extern struct PIT_MemMap     host_pit;
+extern struct DMAMUX_MemMap  host_dmamux;
+extern struct SIM_MemMap     host_sim;
+extern struct GPIO_MemMap    host_ptd;
+extern struct SPI_MemMap     host_spi0;
+extern struct PORT_MemMap    host_porta;
+
+#undef  DMA_BASE_PTR
+#undef  FTM0_BASE_PTR
+#undef  PIT_BASE_PTR
+#undef  DMAMUX_BASE_PTR
+#undef  SIM_BASE_PTR
+#undef  PTD_BASE_PTR
+#undef  SPI0_BASE_PTR
+#undef  PORTA_BASE_PTR
+#define DMA_BASE_PTR     (&host_dma)
+#define FTM0_BASE_PTR    (&host_ftm0)
+#define PIT_BASE_PTR     (&host_pit)
+#define DMAMUX_BASE_PTR  (&host_dmamux)
+#define SIM_BASE_PTR     (&host_sim)
+#define PTD_BASE_PTR     (&host_ptd)
+#define SPI0_BASE_PTR    (&host_spi0)
+#define PORTA_BASE_PTR   (&host_porta)
+
+#endif
@@ -0,0 +1,302 @@
+//  MQX           Linux
+#include   "App.h"
+#include   <stdarg.h>
+
+#define HOST_ARENA_SZ   (8 * 1024 * 1024) //  _mem_alloc. ,      32-   DMA
+
+static uint8_t          host_arena[HOST_ARENA_SZ] __attribute__((aligned(32)));
+static uint32_t         host_arena_pos;
+
+const char             *host_disk_dir = ".";  //    DISK_NAME
+uint32_t                host_verbose  = 1;    //      stdout
+
+static int              Host_mon_printf(const char *fmt, ...);
+static int              Host_mon_wait_char(unsigned char *b, int ticks);
+static int              Host_mon_send_buf(const void *buf, unsigned int len);
+
+static T_monitor_cbl    host_monitor =
+{
+  ._send_buf  = Host_mon_send_buf,
+  ._wait_char = Host_mon_wait_char,
+  ._printf    = Host_mon_printf,
+};
+
+/*-----------------------------------------------------------------------------------------------------
+  
+-----------------------------------------------------------------------------------------------------*/
+void _int_disable(void)
+{
+  //          ,  
+}
+
+void _int_enable(void)
+{
+}
+
+void Install_and_enable_isr(int num, int pri, INT_ISR_FPTR isr_ptr)
+{
+  Host_isr_install(num, pri, isr_ptr);
+}
+
+void Install_and_enable_kernel_isr(int num, int pri, INT_KERNEL_ISR_FPTR isr_ptr)
+{
+  Host_isr_install(num, pri, (INT_ISR_FPTR)isr_ptr);
+}
+
+/*-----------------------------------------------------------------------------------------------------
+  
+-----------------------------------------------------------------------------------------------------*/
+_mqx_uint _lwevent_create(LWEVENT_STRUCT *ev, _mqx_uint flags)
+{
+  ev->VALUE = 0;
+  ev->AUTO  = flags & LWEVENT_AUTO_CLEAR;
+  ev->FLAGS = flags;
+  ev->VALID = LWEVENT_VALID;
+  return MQX_OK;
+}
+
+_mqx_uint _lwevent_set(LWEVENT_STRUCT *ev, _mqx_uint mask)
+{
+  if (ev->VALID != LWEVENT_VALID) return MQX_LWEVENT_INVALID;
+  ev->VALUE |= mask;
+  Host_task_yield_check();
+  return MQX_OK;
+}
+
+_mqx_uint _lwevent_clear(LWEVENT_STRUCT *ev, _mqx_uint mask)
+{
+  if (ev->VALID != LWEVENT_VALID) return MQX_LWEVENT_INVALID;
+  ev->VALUE &= ~mask;
+  return MQX_OK;
+}
+
+_mqx_uint _lwevent_wait_ticks(LWEVENT_STRUCT *ev, _mqx_uint mask, bool all, _mqx_uint ticks)
+{
+  if (ev->VALID != LWEVENT_VALID) return MQX_LWEVENT_INVALID;
+  return Host_task_wait(ev, mask, all, ticks);
+}
+
+_mqx_uint _lwevent_get_signalled(void)
+{
+  return Host_task_signalled();
+}
+
+/*-----------------------------------------------------------------------------------------------------
+  .   ,       
+-----------------------------------------------------------------------------------------------------*/
+void* _mem_alloc(uint32_t sz)
+{
+  void *p;
+
+  sz = (sz + 7) & ~7u;
+  if (host_arena_pos + sz > HOST_ARENA_SZ) return 0;
+  p = &host_arena[host_arena_pos];
+  host_arena_pos += sz;
+  return p;
+}
+
+void* _mem_alloc_zero(uint32_t sz)
+{
+  void *p = _mem_alloc(sz);
+
+  if (p != 0) memset(p, 0, sz);
+  return p;
+}
+
+void* _mem_alloc_system_zero(uint32_t sz)
+{
+  return _mem_alloc_zero(sz);
+}
+
+_mqx_uint _mem_free(void *p)
+{
+  return MQX_OK;
+}
+
+/*-----------------------------------------------------------------------------------------------------
+  
+-----------------------------------------------------------------------------------------------------*/
+void _time_get_elapsed_ticks(MQX_TICK_STRUCT *tk)
+{
+  tk->TICKS[0] = Host_ticks();
+  tk->TICKS[1] = 0;
+  tk->HW_TICKS = (uint32_t)(host_now % HOST_TICK_CNT);
+}
+
+_mqx_uint _time_get_ticks_per_sec(void)
+{
+  return HOST_TICKS_PER_SEC;
+}
+
+/*-----------------------------------------------------------------------------------------------------
+   HW_TICKS       
+-----------------------------------------------------------------------------------------------------*/
+uint32_t _time_get_hwticks_per_tick(void)
+{
+  return HOST_TICK_CNT;
+}
+
+void _time_delay_ticks(uint32_t ticks)
+{
+  if (ticks == 0) ticks = 1;
+  Host_task_wait(0, 0, FALSE, ticks);
+}
+
+uint32_t Conv_ms_to_ticks(uint32_t ms)
+{
+  uint32_t ticks;
+
+  ticks = (_time_get_ticks_per_sec() * ms) / 1000;
+  if (ticks == 0) ticks = 1;
+  return ticks;
+}
+
+void Cycles_counter_init(void)
+{
+  //      Linux, . Host_cycles
+}
+
+/*-----------------------------------------------------------------------------------------------------
+  .       ,      main
+-----------------------------------------------------------------------------------------------------*/
+_task_id _task_create(_mqx_uint proc, _mqx_uint idx, uint32_t param)
+{
+  if (idx != WS2812B_RENDER_IDX) return 0;
+  Host_task_start(HOST_TASK_RENDER, Task_WS2812B_render, param);
+  return (_task_id)(uintptr_t)idx;
+}
+
+_task_id _task_get_id(void)
+{
+  return (_task_id)(uintptr_t)(Host_task_current() + 1);
+}
+
+void* _task_get_environment(_task_id id)
+{
+  return &host_monitor;
+}
+
+/*-----------------------------------------------------------------------------------------------------
+   :   stdout,  
+-----------------------------------------------------------------------------------------------------*/
+static int Host_mon_printf(const char *fmt, ...)
+{
+  va_list ap;
+  char    str[512];
+  char   *s;
+  char   *d;
+  int     n;
+
+  va_start(ap, fmt);
+  n = vsnprintf(str, sizeof(str), fmt, ap);
+  va_end(ap);
+  if (host_verbose == 0) return n;
+
+  //     "\r\n"
+  for (s = str, d = str; *s != 0; s++)
+  {
+    if (*s != '\r') *d++ = *s;
+  }
+  *d = 0;
+  fputs(str, stdout);
+  return n;
+}
+
+/*-----------------------------------------------------------------------------------------------------
+   .      ,   
+-----------------------------------------------------------------------------------------------------*/
+static int Host_mon_wait_char(unsigned char *b, int ticks)
+{
+  _time_delay_ticks(ticks);
+  return MQX_ERROR;
+}
+
+static int Host_mon_send_buf(const void *buf, unsigned int len)
+{
+  if (host_verbose != 0) fwrite(buf, 1, len, stdout);
+  return MQX_OK;
+}
+
+/*-----------------------------------------------------------------------------------------------------
+  
+-----------------------------------------------------------------------------------------------------*/
+void LOGs(const char *name, unsigned int line_num, unsigned int severity, const char *fmt_ptr, ...)
+{
+  va_list ap;
+
+  fprintf(stderr, "%s:%u: ", name, line_num);
+  va_start(ap, fmt_ptr);
+  vfprintf(stderr, fmt_ptr, ap);
+  va_end(ap);
+  fputc('\n', stderr);
+}
+
+/*-----------------------------------------------------------------------------------------------------
+  .    DISK_NAME    host_disk_dir
+-----------------------------------------------------------------------------------------------------*/
+MQX_FILE_PTR _io_fopen(const char *name, const char *mode)
+{
+  char path[512];
+
+  if (strncmp(name, DISK_NAME, strlen(DISK_NAME)) == 0) name += strlen(DISK_NAME);
+  snprintf(path, sizeof(path), "%s/%s", host_disk_dir, name);
+  return fopen(path, mode);
+}
+
+_mqx_int _io_read(MQX_FILE_PTR f, void *buf, _mqx_int len)
+{
+  return (_mqx_int)fread(buf, 1, len, (FILE *)f);
+}
+
+_mqx_int _io_write(MQX_FILE_PTR f, void *buf, _mqx_int len)
+{
+  return (_mqx_int)fwrite(buf, 1, len, (FILE *)f);
+}
+
+_mqx_int _io_fclose(MQX_FILE_PTR f)
+{
+  return fclose((FILE *)f);
+}
+
+/*-----------------------------------------------------------------------------------------------------
+    ,   Parameters.c
+-----------------------------------------------------------------------------------------------------*/
+WVAR_TYPE                  wvar;
+extern const T_work_params dwvar[];
+
+void Return_def_params(void)
+{
+  uint16_t  i;
+
+  for (i = 0; i < DWVAR_SIZE; i++)
+  {
+    if ((dwvar[i].attr & VAL_NOINIT) != 0) continue;
+    switch (dwvar[i].vartype)
+    {
+    case tint8u:
+      *(uint8_t *)dwvar[i].val = (uint8_t)dwvar[i].defval;
+      break;
+    case tint16u:
+      *(uint16_t *)dwvar[i].val = (uint16_t)dwvar[i].defval;
+      break;
+    case tint32u:
+      *(uint32_t *)dwvar[i].val = (uint32_t)dwvar[i].defval;
+      break;
+    case tint32s:
+      *(int32_t *)dwvar[i].val = (int32_t)dwvar[i].defval;
+      break;
+    case tfloat:
+      *(float *)dwvar[i].val = (float)dwvar[i].defval;
+      break;
+    case tstring:
+      strncpy(dwvar[i].val, (const char *)dwvar[i].pdefval, dwvar[i].varlen - 1);
+      ((uint8_t *)dwvar[i].val)[dwvar[i].varlen - 1] = 0;
+      break;
+    case tarrofbyte:
+      memcpy(dwvar[i].val, dwvar[i].pdefval, dwvar[i].varlen);
+      break;
+    default:
+      break;
+    }
+  }
+}
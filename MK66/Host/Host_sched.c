@@ -0,0 +1,600 @@
+//          Linux.
+//         :        
+//  ,       .  main   
+//       ,        
+//      .     : ,      0,
+//   ,  WS2812B_P_FOREVER, ,   
+#include   "App.h"
+
+#define SCHED_TICKS      20000 //    
+#define SCHED_PATTERNS   24    //   .      WS2812B_PATTERNS_MAX
+#define SCHED_PAT_SZ     64    //     
+#define SCHED_ITEMS_MAX  7     //        
+#define SCHED_SEED       0x5EED2026
+
+//   
+typedef struct
+{
+  const uint8_t  *chain;     //  , 0 -     
+  const uint8_t  *ip;        //  
+  uint32_t        phase;
+  uint32_t        tscale;
+  uint32_t        wait;      //    
+  uint32_t        left;      //    
+  uint32_t        prev_hsv;
+  uint32_t        hsv;
+  uint32_t        data;      //      
+  uint32_t        loop_cnt;
+  uint32_t        ramp_on;
+  uint32_t        start;     //    
+  uint32_t        duration;  //    
+  T_WS2812B_ramp  ramp;
+  uint32_t        rgb;       //  
+} T_sched_led;
+
+//    
+typedef struct
+{
+  const uint8_t  *pattern;
+  uint32_t        phase;
+  uint32_t        tscale;
+  uint32_t        valid;
+} T_sched_req;
+
+//    
+typedef struct
+{
+  uint32_t  holds;
+  uint32_t  ramps;
+  uint32_t  forever;
+  uint32_t  jumps;
+  uint32_t  loops;
+  uint32_t  stops;
+  uint32_t  offs;
+} T_sched_cnt;
+
+static uint8_t      sched_pat[SCHED_PATTERNS][SCHED_PAT_SZ];
+static T_sched_led  sched_led[WS2812B_LEDS_MAX];
+static T_sched_req  sched_slot[WS2812B_LEDS_MAX];   //   
+static T_sched_req  sched_batch[WS2812B_LEDS_MAX];  //  
+static T_sched_req  sched_last[WS2812B_LEDS_MAX];   //    :     
+static uint32_t     sched_batch_pub;                //       
+static uint32_t     sched_frame[WS2812B_LEDS_MAX];  //     
+static uint32_t     sched_leds;
+static uint32_t     sched_colrs;
+static uint32_t     sched_on;                       //  
+static uint32_t     sched_tick;                     //      
+static uint32_t     sched_done_tick;                //     
+static uint32_t     sched_tick0;
+static uint32_t     sched_rnd;
+static T_sched_cnt  sched_cnt;
+
+//  
+static uint32_t     sched_renders;
+static uint32_t     sched_bad_frames;
+static uint32_t     sched_bad_leds;
+static uint32_t     sched_bad_tick;
+static uint32_t     sched_bad_led;
+static uint32_t     sched_bad_got;
+static uint32_t     sched_bad_exp;
+static uint32_t     sched_singles;
+static uint32_t     sched_batched;
+
+static uint32_t Sched_rand(void)
+{
+  sched_rnd = sched_rnd * 1103515245u + 12345u;
+  return sched_rnd >> 8;
+}
+
+/*-----------------------------------------------------------------------------------------------------
+      
+-----------------------------------------------------------------------------------------------------*/
+static uint32_t Sched_frame_colr(uint32_t rgb)
+{
+  uint32_t w;
+
+  if (sched_colrs <= 3) return rgb;
+  w = (rgb >> 16) & 0xFF;
+  if (((rgb >> 8) & 0xFF) < w) w = (rgb >> 8) & 0xFF;
+  if ((rgb & 0xFF) < w) w = rgb & 0xFF;
+  return (w << 24) | (rgb - w * 0x010101);
+}
+
+static void Sched_set(T_sched_led *l, uint32_t hue, uint32_t sat, uint32_t val)
+{
+  l->rgb = (val == 0) ? 0 : Convert_H_S_V_to_RGB(hue, sat, val);
+}
+
+/*-----------------------------------------------------------------------------------------------------
+        tick
+-----------------------------------------------------------------------------------------------------*/
+static void Sched_assign(T_sched_led *l, const T_sched_req *r)
+{
+  if ((r->pattern != 0) && (l->chain == r->pattern) && (l->phase == r->phase) && (l->tscale == r->tscale)) return;
+  l->chain    = r->pattern;
+  l->ip       = r->pattern;
+  l->phase    = r->phase;
+  l->tscale   = r->tscale;
+  l->prev_hsv = HSV_NONE;
+  l->hsv      = HSV_NONE;
+  l->data     = 0;
+  l->loop_cnt = 0;
+  l->ramp_on  = 0;
+  l->wait     = 1;
+  l->left     = r->phase;
+}
+
+/*-----------------------------------------------------------------------------------------------------
+         tick
+-----------------------------------------------------------------------------------------------------*/
+static void Sched_item(T_sched_led *l, uint32_t tick)
+{
+  const uint8_t *ip = l->ip;
+  uint32_t       op;
+  uint32_t       hsv;
+  int32_t        rel;
+
+  l->left = 1; // ,      
+  if (l->chain == 0)
+  {
+    Sched_set(l, 0, 0, 0);
+    l->wait = 0;
+    sched_cnt.offs++;
+    return;
+  }
+
+  op = *ip++;
+  switch (op & WS2812B_OP_MASK)
+  {
+  case WS2812B_OP_JMP:
+    rel = (int16_t)(ip[0] | (ip[1] << 8));
+    l->ip = ip + 2 + rel;
+    l->ramp_on = 0;
+    sched_cnt.jumps++;
+    return;
+  case WS2812B_OP_LOOP:
+    rel = (int16_t)(ip[1] | (ip[2] << 8));
+    if (l->loop_cnt == 0) l->loop_cnt = ip[0];
+    if (l->loop_cnt != 0) l->loop_cnt--;
+    l->ip = ip + 3 + ((l->loop_cnt != 0) ? rel : 0);
+    l->ramp_on = 0;
+    sched_cnt.loops++;
+    return;
+  case WS2812B_OP_HOLD:
+  case WS2812B_OP_RAMP:
+    hsv = (WS2812B_HUE_DEG(ip[0]) << 16) | (ip[1] << 8) | ip[2];
+    ip += 3;
+    break;
+  case WS2812B_OP_HOLDS:
+  case WS2812B_OP_RAMPS:
+    hsv = (WS2812B_HUE_DEG(ip[0]) << 16) | (0xFF << 8) | ip[1];
+    ip += 2;
+    break;
+  default:
+    l->chain   = 0;
+    l->ramp_on = 0;
+    sched_cnt.stops++;
+    return;
+  }
+
+  if ((op & WS2812B_OPF_SAME_DUR) == 0)
+  {
+    l->data = ip[0] | (ip[1] << 8);
+    ip += 2;
+  }
+  l->ip       = ip;
+  l->prev_hsv = l->hsv;
+  l->hsv      = hsv;
+  l->ramp_on  = 0;
+
+  if (l->data == WS2812B_P_FOREVER)
+  {
+    Sched_set(l, (hsv >> 16) & 0x1FF, (hsv >> 8) & 0xFF, hsv & 0xFF);
+    l->wait = 0;
+    sched_cnt.forever++;
+    return;
+  }
+
+  l->duration = Conv_ms_to_ticks(l->data);
+  if (l->tscale != 0x10000) l->duration = (uint32_t)(((uint64_t)l->duration * l->tscale) >> 16);
+  l->start = tick;
+  l->left  = l->duration + 1;
+  if ((op & WS2812B_OPF_RAMP) == 0)
+  {
+    Sched_set(l, (hsv >> 16) & 0x1FF, (hsv >> 8) & 0xFF, hsv & 0xFF);
+    sched_cnt.holds++;
+  }
+  else
+  {
+    if (l->duration != 0)
+    {
+      WS2812B_ramp_init(&l->ramp, l->prev_hsv, l->hsv, l->duration);
+      l->ramp_on = 1;
+    }
+    else
+    {
+      Sched_set(l, (hsv >> 16) & 0x1FF, (hsv >> 8) & 0xFF, hsv & 0xFF);
+    }
+    sched_cnt.ramps++;
+  }
+}
+
+/*-----------------------------------------------------------------------------------------------------
+       ,      .
+       
+-----------------------------------------------------------------------------------------------------*/
+static void Sched_batch_accept(void)
+{
+  uint32_t n;
+
+  if (sched_batch_pub == 0) return;
+  for (n = 0; n < sched_leds; n++)
+  {
+    if (sched_batch[n].valid == 0) continue;
+    sched_slot[n].valid = 0;
+    Sched_assign(&sched_led[n], &sched_batch[n]);
+  }
+  sched_batch_pub = 0;
+}
+
+/*-----------------------------------------------------------------------------------------------------
+   .         
+-----------------------------------------------------------------------------------------------------*/
+static void Sched_tick(void)
+{
+  T_sched_led *l;
+  uint32_t     n;
+  uint32_t     k;
+  uint32_t     hsv;
+
+  sched_tick++;
+  for (n = 0; n < sched_leds; n++)
+  {
+    if (sched_slot[n].valid)
+    {
+      sched_slot[n].valid = 0;
+      Sched_assign(&sched_led[n], &sched_slot[n]);
+    }
+  }
+
+  for (n = 0; n < sched_leds; n++)
+  {
+    l = &sched_led[n];
+    if (l->wait)
+    {
+      if (l->left == 0) Sched_item(l, sched_tick);
+      l->left--;
+    }
+    if (l->ramp_on == 0) continue;
+    k = sched_tick - l->start;
+    if (k == 0) continue;
+    hsv = (k >= l->duration) ? l->hsv : WS2812B_ramp_value(&l->ramp, k);
+    k = (hsv >> 16) & 0x1FF;
+    if (k >= 360) k -= 360;
+    Sched_set(l, k, (hsv >> 8) & 0xFF, hsv & 0xFF);
+  }
+}
+
+/*-----------------------------------------------------------------------------------------------------
+       .      
+-----------------------------------------------------------------------------------------------------*/
+static void Sched_frac(uint32_t frac)
+{
+  T_sched_led *l;
+  uint32_t     n;
+  uint32_t     k;
+  uint32_t     hsv;
+
+  if (frac == 0) return;
+  for (n = 0; n < sched_leds; n++)
+  {
+    l = &sched_led[n];
+    if (l->ramp_on == 0) continue;
+    k = sched_tick - l->start;
+    if (k >= l->duration) continue;
+    hsv = WS2812B_ramp_value_frac(&l->ramp, k, frac);
+    k = (hsv >> 16) & 0x1FF;
+    if (k >= 360) k -= 360;
+    Sched_set(l, k, (hsv >> 8) & 0xFF, hsv & 0xFF);
+  }
+}
+
+/*-----------------------------------------------------------------------------------------------------
+     .        
+-----------------------------------------------------------------------------------------------------*/
+void Host_sched_frame(const uint32_t *frame)
+{
+  memcpy(sched_frame, frame, WS2812B_get_geometry()->leds_num * sizeof(uint32_t));
+}
+
+/*-----------------------------------------------------------------------------------------------------
+   .           
+-----------------------------------------------------------------------------------------------------*/
+void Host_sched_render(const T_WS2812B_stat *ws)
+{
+  uint32_t n;
+  uint32_t c;
+  uint32_t bad = 0;
+
+  sched_done_tick = ws->sm_ticks;
+  if (sched_on == 0) return;
+
+  Sched_batch_accept();
+  while (sched_tick != sched_done_tick) Sched_tick();
+  Sched_frac(ws->sm_frac);
+
+  for (n = 0; n < sched_leds; n++)
+  {
+    c = Sched_frame_colr(sched_led[n].rgb);
+    if (sched_frame[n] == c) continue;
+    if ((bad == 0) && (sched_bad_frames == 0))
+    {
+      sched_bad_tick = sched_tick;
+      sched_bad_led  = n;
+      sched_bad_got  = sched_frame[n];
+      sched_bad_exp  = c;
+    }
+    bad++;
+  }
+  sched_renders++;
+  sched_bad_leds += bad;
+  if (bad != 0) sched_bad_frames++;
+}
+
+/*-----------------------------------------------------------------------------------------------------
+   .    
+-----------------------------------------------------------------------------------------------------*/
+static uint32_t Sched_gen(uint8_t *p)
+{
+  uint32_t offs[SCHED_ITEMS_MAX];
+  uint32_t items;
+  uint32_t loop = 0;
+  uint32_t pos  = 0;
+  uint32_t i;
+  uint32_t r;
+  uint32_t op;
+  uint32_t ms;
+  int32_t  rel;
+
+  items = 1 + Sched_rand() % SCHED_ITEMS_MAX;
+  for (i = 0; i < items; i++)
+  {
+    offs[i] = pos;
+    r = Sched_rand();
+    if ((i > 0) && (loop == 0) && ((r % 5) == 0))
+    {
+      //       ,  0  1 -  
+      loop = 1;
+      rel  = (int32_t)offs[Sched_rand() % i] - (int32_t)(pos + 4);
+      p[pos++] = WS2812B_OP_LOOP;
+      p[pos++] = Sched_rand() % 5;
+      p[pos++] = WS2812B_P_LO(rel);
+      p[pos++] = WS2812B_P_HI(rel);
+      continue;
+    }
+    op = WS2812B_OP_HOLD + ((r >> 4) % 4) * 0x10;
+    if ((i > 0) && ((r >> 8) % 4) == 0) op |= WS2812B_OPF_SAME_DUR;
+    p[pos++] = op;
+    //    0 ,     0
+    p[pos++] = ((r >> 10) % 2) ? (uint8_t)(Sched_rand() % 24 - 12) : (uint8_t)Sched_rand();
+    if ((op & 0xE0) == WS2812B_OP_HOLD) p[pos++] = Sched_rand();
+    p[pos++] = ((r >> 12) % 8) ? (uint8_t)Sched_rand() : 0;
+    if ((op & WS2812B_OPF_SAME_DUR) == 0)
+    {
+      r = Sched_rand() % 32;
+      if (r == 0) ms = WS2812B_P_FOREVER;
+      else if (r < 6) ms = 0;
+      else if (r < 20) ms = Sched_rand() % 60;
+      else ms = Sched_rand() % 1500;
+      p[pos++] = WS2812B_P_LO(ms);
+      p[pos++] = WS2812B_P_HI(ms);
+    }
+  }
+  if (Sched_rand() % 4 == 0)
+  {
+    p[pos++] = WS2812B_OP_STOP;
+  }
+  else
+  {
+    rel = (int32_t)offs[Sched_rand() % items] - (int32_t)(pos + 3);
+    p[pos++] = WS2812B_OP_JMP;
+    p[pos++] = WS2812B_P_LO(rel);
+    p[pos++] = WS2812B_P_HI(rel);
+  }
+  return pos;
+}
+
+/*-----------------------------------------------------------------------------------------------------
+    
+-----------------------------------------------------------------------------------------------------*/
+static const uint8_t* Sched_pick_pattern(void)
+{
+  return sched_pat[Sched_rand() % SCHED_PATTERNS];
+}
+
+static uint32_t Sched_pick_rate(void)
+{
+  static const uint32_t rates[] = { WS2812B_RATE_1X, WS2812B_RATE_1X, WS2812B_RATE_1X / 2, WS2812B_RATE_1X * 2, 300, WS2812B_RATE_1X * 8 };
+
+  return rates[Sched_rand() % (sizeof(rates) / sizeof(rates[0]))];
+}
+
+static void Sched_req(T_sched_req *r, const uint8_t *pattern, uint32_t phase_ms, uint32_t rate)
+{
+  r->pattern = pattern;
+  r->phase   = Conv_ms_to_ticks(phase_ms);
+  r->tscale  = (WS2812B_RATE_1X << 16) / rate;
+  r->valid   = 1;
+}
+
+/*-----------------------------------------------------------------------------------------------------
+     .     ,    
+-----------------------------------------------------------------------------------------------------*/
+static void Sched_singles(void)
+{
+  uint32_t     i;
+  uint32_t     n;
+  uint32_t     num;
+  T_sched_req *r;
+
+  num = 1 + Sched_rand() % 8;
+  for (i = 0; i < num; i++)
+  {
+    n = Sched_rand() % sched_leds;
+    r = &sched_last[n];
+    if ((r->valid == 0) || (Sched_rand() % 4 != 0))
+    {
+      r->pattern = Sched_pick_pattern();
+      r->phase   = Sched_rand() % 300;
+      r->tscale  = Sched_pick_rate();
+      r->valid   = 1;
+    }
+    if (WS2812B_Set_shared_pattern(r->pattern, n, r->phase, r->tscale) == 0) sched_bad_frames++; //  ,   
+    Sched_req(&sched_slot[n], r->pattern, r->phase, r->tscale);
+    sched_singles++;
+  }
+}
+
+/*-----------------------------------------------------------------------------------------------------
+   :       .  0  
+-----------------------------------------------------------------------------------------------------*/
+static void Sched_batch(uint32_t all)
+{
+  uint16_t       leds[16];
+  uint32_t       first, num, i, n;
+  uint32_t       phase_ms, step_ms, rate;
+  const uint8_t *pattern;
+
+  if (WS2812B_Batch_begin() != (sched_batch_pub == 0)) sched_bad_frames++; //       
+  if (sched_batch_pub)
+  {
+    //     ,    ,  
+    WS2812B_Batch_range(Sched_pick_pattern(), 0, sched_leds, 0, 0, WS2812B_RATE_1X);
+    WS2812B_Batch_publish();
+    return;
+  }
+  for (n = 0; n < sched_leds; n++) sched_batch[n].valid = 0;
+
+  pattern  = ((all == 0) && (Sched_rand() % 6 == 0)) ? 0 : Sched_pick_pattern();
+  phase_ms = Sched_rand() % 200;
+  rate     = Sched_pick_rate();
+  if (all || (Sched_rand() % 2))
+  {
+    first   = all ? 0 : Sched_rand() % sched_leds;
+    num     = all ? sched_leds : 1 + Sched_rand() % 64;
+    step_ms = Sched_rand() % 40;
+    WS2812B_Batch_range(pattern, first, num, phase_ms, step_ms, rate);
+    if (num > sched_leds - first) num = sched_leds - first;
+    for (n = first; n < first + num; n++)
+    {
+      Sched_req(&sched_batch[n], pattern, phase_ms, rate);
+      phase_ms += step_ms;
+    }
+    sched_batched += num;
+  }
+  else
+  {
+    num = 1 + Sched_rand() % 16;
+    for (i = 0; i < num; i++) leds[i] = Sched_rand() % (sched_leds + 4); //    
+    WS2812B_Batch_set(pattern, leds, num, phase_ms, rate);
+    for (i = 0; i < num; i++)
+    {
+      if (leds[i] >= sched_leds) continue;
+      Sched_req(&sched_batch[leds[i]], pattern, phase_ms, rate);
+      sched_batched++;
+    }
+  }
+  WS2812B_Batch_publish();
+  sched_batch_pub = 1;
+}
+
+/*-----------------------------------------------------------------------------------------------------
+     .  LEDSC        .
+    
+-----------------------------------------------------------------------------------------------------*/
+uint32_t Host_test_sched(void)
+{
+  uint32_t i;
+  uint32_t n;
+  uint32_t t0;
+  uint32_t len;
+  uint32_t bytes = 0;
+  uint32_t bad_checks = 0;
+  uint8_t  tmp[SCHED_PAT_SZ];
+
+  printf("\n--------- WS2812B pattern scheduler reference test ---------\n");
+
+  sched_rnd   = SCHED_SEED;
+  sched_leds  = WS2812B_get_geometry()->leds_num;
+  sched_colrs = WS2812B_get_geometry()->colrs;
+  for (i = 0; i < SCHED_PATTERNS; i++)
+  {
+    len    = Sched_gen(sched_pat[i]);
+    bytes += len;
+    //   ,       
+    memcpy(tmp, sched_pat[i], len);
+    if (WS2812B_pattern_check(tmp, len - 1) != 0) bad_checks++;
+    if (tmp[len - 1] != WS2812B_OP_STOP) //   -  ,     
+    {
+      tmp[len - 2] = 1;
+      tmp[len - 1] = 0;
+      if (WS2812B_pattern_check(tmp, len) != 0) bad_checks++;
+    }
+    if (WS2812B_pattern_check(sched_pat[i], len) == 0) bad_checks++;
+  }
+  memset(&sched_cnt, 0, sizeof(sched_cnt));
+  sched_renders = sched_bad_frames = sched_bad_leds = sched_singles = sched_batched = 0;
+
+  WS2812B_set_source(WS2812B_SRC_PATTERNS);
+  while (WS2812B_Batch_pending()) _time_delay_ticks(1);
+  _time_delay_ticks(2);
+
+  //      ,       
+  memset(sched_led, 0, sizeof(sched_led));
+  memset(sched_slot, 0, sizeof(sched_slot));
+  memset(sched_last, 0, sizeof(sched_last));
+  for (n = 0; n < sched_leds; n++)
+  {
+    sched_led[n].rgb = sched_frame[n];
+    if (sched_colrs > 3) sched_led[n].rgb = (sched_frame[n] & 0xFFFFFF) + (sched_frame[n] >> 24) * 0x010101; //    
+  }
+  sched_tick      = sched_done_tick;
+  sched_tick0     = sched_tick;
+  sched_batch_pub = 0;
+  sched_on        = 1;
+  Sched_batch(1);
+
+  t0 = Host_ticks();
+  while ((Host_ticks() - t0) < SCHED_TICKS)
+  {
+    switch (Sched_rand() % 8)
+    {
+    case 0:
+    case 1:
+    case 2:
+      Sched_singles();
+      break;
+    case 3:
+    case 4:
+      Sched_batch(0);
+      break;
+    default:
+      break;
+    }
+    _time_delay_ticks(1 + Sched_rand() % 12);
+  }
+  sched_on = 0;
+
+  printf("Patterns                 : %u, %u bytes, %u check errors\n", SCHED_PATTERNS, bytes, bad_checks);
+  printf("Assignments              : %u single, %u in batches\n", sched_singles, sched_batched);
+  printf("Items                    : %u holds, %u ramps, %u forever, %u jumps, %u loops, %u stops, %u offs\n",
+         sched_cnt.holds, sched_cnt.ramps, sched_cnt.forever, sched_cnt.jumps, sched_cnt.loops, sched_cnt.stops, sched_cnt.offs);
+  printf("Renders checked          : %u, %u ticks\n", sched_renders, sched_tick - sched_tick0);
+  printf("Mismatched frames        : %u\n", sched_bad_frames);
+  printf("Mismatched LEDs          : %u\n", sched_bad_leds);
+  if (sched_bad_frames != 0)
+  {
+    printf("First mismatch           : tick %u LED %u: %08X, expected %08X\n", sched_bad_tick, sched_bad_led, sched_bad_got, sched_bad_exp);
+  }
+  return sched_bad_frames + bad_checks;
+}
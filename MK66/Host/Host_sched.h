@@ -0,0 +1,10 @@
+#ifndef HOST_SCHED_H
+  #define HOST_SCHED_H
+
+//        
+
+void      Host_sched_frame(const uint32_t *frame);
+void      Host_sched_render(const T_WS2812B_stat *ws);
+uint32_t  Host_test_sched(void);
+
+#endif
@@ -0,0 +1,738 @@
+//           Linux
+#define _GNU_SOURCE
+#include   "App.h"
+#include   <ucontext.h>
+#include   <time.h>
+
+//      
+#undef  CERQ
+#undef  SERQ
+#undef  CDNE
+#undef  SSRT
+#undef  CINT
+#undef  INT
+#undef  CNT
+#undef  TCTRL
+
+#define HOST_NONE          UINT64_MAX
+#define HOST_RENDER_STACK  (256 * 1024) //   .     
+#define HOST_STACK_FILL    0xA5
+
+struct DMA_MemMap     host_dma;
+struct FTM_MemMap     host_ftm0;
+struct PIT_MemMap     host_pit;
+struct DMAMUX_MemMap  host_dmamux;
+struct SIM_MemMap     host_sim;
+struct GPIO_MemMap    host_ptd;
+struct SPI_MemMap     host_spi0;
+struct PORT_MemMap    host_porta;
+
+volatile uint64_t     host_now;
+uint32_t              host_isr_latency;
+uint32_t              host_isr_jitter;
+uint32_t              host_refill_cycles = HOST_REFILL_CYCLES;
+T_host_sim_stat       host_sim_stat;
+void                (*host_ftm_period)(uint32_t ch, uint32_t cnv, uint32_t outmask, uint64_t t);
+
+// FTM0
+static uint32_t       ftm_on;
+static uint64_t       ftm_next;           //    
+static uint64_t       ftm_match[8];       //     CnV    
+
+// DMA
+static uint32_t       dma_req[32];        //      
+
+// PIT
+static uint64_t       pit_next[4];        //    
+static uint32_t       pit_tctrl[4];       //    TCTRL
+
+//  
+static uint64_t       tick_next;
+static uint32_t       host_ticks;
+
+//    
+static uint32_t       acc_open;           //   ,    
+static uint32_t       acc_int;            //     DMA->INT
+
+// 
+typedef struct
+{
+  INT_ISR_FPTR  isr;
+  int           prio;
+  uint32_t      pend;
+  uint64_t      pend_t; //  
+  uint64_t      run_t;  //     
+  uint32_t      body;   //    ,     run_t
+} T_host_vector;
+
+static T_host_vector  vectors[HOST_VECTORS];
+static uint32_t       in_isr;             //   
+static uint64_t       isr_end;            //    
+static int            isr_prio;           //   
+static uint32_t       rnd = 1;
+
+// 
+typedef struct
+{
+  ucontext_t       uc;
+  uint32_t         used;
+  uint32_t         waiting;
+  LWEVENT_STRUCT  *ev;
+  _mqx_uint        mask;
+  bool             all;
+  uint32_t         has_deadline;
+  uint32_t         deadline;  //   
+  _mqx_uint        result;
+  _mqx_uint        signalled;
+  void           (*entry)(uint32_t);
+  uint32_t         param;
+} T_host_task;
+
+static T_host_task    tasks[HOST_TASKS];
+static uint32_t       cur_task = HOST_TASK_MAIN;
+static uint8_t        render_stack[HOST_RENDER_STACK];
+static uint64_t       task_last_ns;
+
+static void Host_hw_advance(uint64_t t);
+static void Host_reg_commit(void);
+
+/*-----------------------------------------------------------------------------------------------------
+    Linux    
+-----------------------------------------------------------------------------------------------------*/
+uint64_t Host_cpu_ns(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+/*-----------------------------------------------------------------------------------------------------
+     DWT:   Linux    180 
+-----------------------------------------------------------------------------------------------------*/
+uint32_t Host_cycles(void)
+{
+  return (uint32_t)(Host_cpu_ns() * (BSP_CORE_CLOCK / 1000000ul) / 1000ull);
+}
+
+uint32_t Host_ticks(void)
+{
+  return host_ticks;
+}
+
+/*-----------------------------------------------------------------------------------------------------
+      
+-----------------------------------------------------------------------------------------------------*/
+void Host_sim_init(void)
+{
+  uint32_t i;
+
+  memset(&host_dma, 0, sizeof(host_dma));
+  memset(&host_ftm0, 0, sizeof(host_ftm0));
+  memset(&host_pit, 0, sizeof(host_pit));
+  memset(&host_dmamux, 0, sizeof(host_dmamux));
+  memset(vectors, 0, sizeof(vectors));
+  memset(dma_req, 0, sizeof(dma_req));
+  memset(&host_sim_stat, 0, sizeof(host_sim_stat));
+  for (i = 0; i < 8; i++) ftm_match[i] = HOST_NONE;
+  for (i = 0; i < 4; i++)
+  {
+    pit_next[i]  = HOST_NONE;
+    pit_tctrl[i] = 0;
+  }
+  ftm_on     = 0;
+  isr_end    = 0;
+  host_now   = 0;
+  host_ticks = 0;
+  tick_next  = HOST_TICK_CNT;
+  acc_open   = 0;
+  memset(render_stack, HOST_STACK_FILL, sizeof(render_stack));
+}
+
+/*-----------------------------------------------------------------------------------------------------
+    
+-----------------------------------------------------------------------------------------------------*/
+void Host_isr_install(int num, int prio, INT_ISR_FPTR isr)
+{
+  if ((num < 0) || (num >= HOST_VECTORS)) return;
+  vectors[num].isr  = isr;
+  vectors[num].prio = prio;
+}
+
+/*-----------------------------------------------------------------------------------------------------
+   .       ,   NVIC
+-----------------------------------------------------------------------------------------------------*/
+static void Host_isr_pend(uint32_t num)
+{
+  T_host_vector *v = &vectors[num];
+
+  if (v->isr == 0) return;
+  if (v->pend) return;
+  v->pend   = 1;
+  v->pend_t = host_now;
+  v->run_t  = host_now + host_isr_latency;
+  if (host_isr_jitter != 0)
+  {
+    rnd = rnd * 1103515245u + 12345u;
+    v->run_t += (rnd >> 8) % (host_isr_jitter + 1);
+  }
+}
+
+/*-----------------------------------------------------------------------------------------------------
+       .  DMA      
+     ,      
+-----------------------------------------------------------------------------------------------------*/
+static uint64_t Host_isr_cost(uint32_t num)
+{
+  uint64_t n;
+
+  if ((num < INT_DMA0_DMA16) || (num >= INT_DMA0_DMA16 + 16)) return 0;
+  n = __builtin_popcount(host_dma.INT);
+  return (HOST_ISR_ENTRY_CYCLES + n * host_refill_cycles) * HOST_BUS_HZ / BSP_CORE_CLOCK;
+}
+
+/*-----------------------------------------------------------------------------------------------------
+     DMA.  N  N+16   
+-----------------------------------------------------------------------------------------------------*/
+static void Host_dma_int(uint32_t ch)
+{
+  host_dma.INT |= 1u << ch;
+  Host_isr_pend(INT_DMA0_DMA16 + (ch & 0x0F));
+}
+
+static uint32_t Host_mem_read(uint32_t addr, uint32_t sz)
+{
+  switch (sz)
+  {
+  case 1: return *(volatile uint8_t *)(uintptr_t)addr;
+  case 2: return *(volatile uint16_t *)(uintptr_t)addr;
+  default: return *(volatile uint32_t *)(uintptr_t)addr;
+  }
+}
+
+static void Host_mem_write(uint32_t addr, uint32_t sz, uint32_t v)
+{
+  switch (sz)
+  {
+  case 1: *(volatile uint8_t *)(uintptr_t)addr = v; break;
+  case 2: *(volatile uint16_t *)(uintptr_t)addr = v; break;
+  default: *(volatile uint32_t *)(uintptr_t)addr = v; break;
+  }
+}
+
+/*-----------------------------------------------------------------------------------------------------
+     DMA ,    ,   .
+       
+-----------------------------------------------------------------------------------------------------*/
+static void Host_dma_transfer(uint32_t ch)
+{
+  uint32_t  ssz, dsz, i, n, v;
+  uint32_t  citer, biter, csr;
+
+  dma_req[ch] = 0;
+  host_sim_stat.dma_transfers++;
+
+  ssz = 1u << ((host_dma.TCD[ch].ATTR >> 8) & 7);
+  dsz = 1u << (host_dma.TCD[ch].ATTR & 7);
+  n   = host_dma.TCD[ch].NBYTES_MLNO;
+  for (i = 0; i < n; i += dsz)
+  {
+    v = Host_mem_read(host_dma.TCD[ch].SADDR, ssz);
+    Host_mem_write(host_dma.TCD[ch].DADDR, dsz, v);
+    host_dma.TCD[ch].SADDR += (int16_t)host_dma.TCD[ch].SOFF;
+    host_dma.TCD[ch].DADDR += (int16_t)host_dma.TCD[ch].DOFF;
+  }
+
+  citer = (host_dma.TCD[ch].CITER_ELINKNO & 0x7FFF) - 1;
+  biter = host_dma.TCD[ch].BITER_ELINKNO & 0x7FFF;
+  csr   = host_dma.TCD[ch].CSR;
+  host_dma.TCD[ch].CITER_ELINKNO = citer;
+  if ((csr & BIT(2)) && (citer == biter / 2) && (citer != 0)) Host_dma_int(ch); // INTHALF
+  if (citer != 0) return;
+
+  //   
+  host_dma.TCD[ch].SADDR += host_dma.TCD[ch].SLAST;
+  if (csr & BIT(4))
+  {
+    memcpy((void *)&host_dma.TCD[ch], (const void *)(uintptr_t)host_dma.TCD[ch].DLAST_SGA, sizeof(host_dma.TCD[ch])); // ESG
+  }
+  else
+  {
+    host_dma.TCD[ch].DADDR += host_dma.TCD[ch].DLAST_SGA;
+    host_dma.TCD[ch].CITER_ELINKNO = biter;
+    host_dma.TCD[ch].CSR |= BIT(7); // DONE
+  }
+  if (csr & BIT(1)) Host_dma_int(ch); // INTMAJOR
+  if (csr & BIT(3)) host_dma.ERQ &= ~(1u << ch); // DREQ
+}
+
+/*-----------------------------------------------------------------------------------------------------
+   DMA  .      
+-----------------------------------------------------------------------------------------------------*/
+static void Host_dma_request(uint32_t ch)
+{
+  if (host_dma.ERQ & (1u << ch))
+  {
+    Host_dma_transfer(ch);
+  }
+  else
+  {
+    if (dma_req[ch]) host_sim_stat.dma_lost_req++;
+    dma_req[ch] = 1;
+  }
+}
+
+/*-----------------------------------------------------------------------------------------------------
+   DMA    CERQ, SERQ, CDNE, SSRT, CINT.
+   6  -    
+-----------------------------------------------------------------------------------------------------*/
+static void Host_dma_cmd(uint32_t reg, uint32_t v)
+{
+  uint32_t ch = v & 0x1F;
+  uint32_t m  = (v & BIT(6)) ? 0xFFFFFFFFu : (1u << ch);
+
+  switch (reg)
+  {
+  case 0: // CERQ
+    host_dma.ERQ &= ~m;
+    break;
+  case 1: // SERQ
+    host_dma.ERQ |= m;
+    for (ch = 0; ch < 32; ch++)
+    {
+      if ((m & (1u << ch)) && dma_req[ch]) Host_dma_transfer(ch);
+    }
+    break;
+  case 2: // CDNE
+    for (ch = 0; ch < 32; ch++)
+    {
+      if (m & (1u << ch)) host_dma.TCD[ch].CSR &= ~BIT(7);
+    }
+    break;
+  case 3: // SSRT
+    Host_dma_transfer(ch);
+    break;
+  case 4: // CINT
+    host_dma.INT &= ~m;
+    break;
+  }
+}
+
+/*-----------------------------------------------------------------------------------------------------
+   TCTRL  PIT.    LDVAL
+-----------------------------------------------------------------------------------------------------*/
+static void Host_pit_ctrl(uint32_t n, uint32_t v)
+{
+  if ((v & BIT(0)) == 0)
+  {
+    pit_next[n] = HOST_NONE;
+  }
+  else if ((pit_tctrl[n] & BIT(0)) == 0)
+  {
+    pit_next[n] = host_now + host_pit.CHANNEL[n].LDVAL + 1;
+  }
+  pit_tctrl[n] = v;
+}
+
+/*-----------------------------------------------------------------------------------------------------
+       
+-----------------------------------------------------------------------------------------------------*/
+static void Host_reg_commit(void)
+{
+  uint32_t n;
+
+  if (acc_open == 0) return;
+  acc_open = 0;
+
+  if (host_dma.cerq[0] != 0xFF) Host_dma_cmd(0, host_dma.cerq[0]);
+  if (host_dma.serq[0] != 0xFF) Host_dma_cmd(1, host_dma.serq[0]);
+  if (host_dma.cdne[0] != 0xFF) Host_dma_cmd(2, host_dma.cdne[0]);
+  if (host_dma.ssrt[0] != 0xFF) Host_dma_cmd(3, host_dma.ssrt[0]);
+  if (host_dma.cint[0] != 0xFF) Host_dma_cmd(4, host_dma.cint[0]);
+  if (host_dma.intr[0] != acc_int) host_dma.INT &= ~host_dma.intr[0]; //    
+  for (n = 0; n < 4; n++)
+  {
+    if (host_pit.CHANNEL[n].tctrl[0] != pit_tctrl[n]) Host_pit_ctrl(n, host_pit.CHANNEL[n].tctrl[0]);
+  }
+}
+
+/*-----------------------------------------------------------------------------------------------------
+     FTM0
+-----------------------------------------------------------------------------------------------------*/
+static uint32_t Host_ftm_cnt(void)
+{
+  uint32_t p = host_ftm0.MOD + 1;
+
+  if (ftm_on == 0) return 0;
+  return p - (uint32_t)(ftm_next - host_now);
+}
+
+/*-----------------------------------------------------------------------------------------------------
+     .   ,     
+     :   -   , INT  CNT -  
+
+    
+-----------------------------------------------------------------------------------------------------*/
+uint32_t Host_reg_access(void)
+{
+  Host_reg_commit();
+  host_now++;
+  Host_hw_advance(host_now);
+
+  host_dma.cerq[0] = 0xFF;
+  host_dma.serq[0] = 0xFF;
+  host_dma.cdne[0] = 0xFF;
+  host_dma.ssrt[0] = 0xFF;
+  host_dma.cint[0] = 0xFF;
+  acc_int          = host_dma.INT | HOST_INT_MARK;
+  host_dma.intr[0] = acc_int;
+  host_ftm0.cnt[0] = Host_ftm_cnt();
+  acc_open = 1;
+  return 0;
+}
+
+/*-----------------------------------------------------------------------------------------------------
+    FTM0.  CnV   ,     .
+   CnV = 0  :       DMA 
+-----------------------------------------------------------------------------------------------------*/
+static void Host_ftm_boundary(uint64_t t)
+{
+  uint32_t c;
+  uint32_t cnv;
+
+  for (c = 0; c < 8; c++)
+  {
+    cnv = host_ftm0.CONTROLS[c].CnV & 0xFFFF;
+    if (host_ftm_period != 0) host_ftm_period(c, cnv, (host_ftm0.OUTMASK >> c) & 1, t);
+    ftm_match[c] = ((cnv != 0) && (cnv <= host_ftm0.MOD)) ? t + cnv : HOST_NONE;
+  }
+  ftm_next = t + host_ftm0.MOD + 1;
+}
+
+/*-----------------------------------------------------------------------------------------------------
+     CnV  c.     DMA  ,
+      DMA,      
+-----------------------------------------------------------------------------------------------------*/
+static void Host_ftm_match(uint32_t c)
+{
+  uint32_t ch;
+  uint32_t sc = host_ftm0.CONTROLS[c].CnSC;
+
+  ftm_match[c] = HOST_NONE;
+  host_ftm0.CONTROLS[c].CnSC |= BIT(7); // CHF
+  if ((sc & BIT(0)) == 0 || (sc & BIT(6)) == 0) return;
+  for (ch = 0; ch < 32; ch++)
+  {
+    if (host_dmamux.CHCFG[ch] == (BIT(7) | (DMUX_SRC_FTM0_CH0 + c))) Host_dma_request(ch);
+  }
+}
+
+/*-----------------------------------------------------------------------------------------------------
+     
+-----------------------------------------------------------------------------------------------------*/
+static uint64_t Host_hw_next(void)
+{
+  uint64_t t = tick_next;
+  uint32_t i;
+
+  if (ftm_on && (ftm_next < t)) t = ftm_next;
+  for (i = 0; i < 8; i++) if (ftm_match[i] < t) t = ftm_match[i];
+  for (i = 0; i < 4; i++) if (pit_next[i] < t) t = pit_next[i];
+  return t;
+}
+
+/*-----------------------------------------------------------------------------------------------------
+       t 
+-----------------------------------------------------------------------------------------------------*/
+static void Host_hw_advance(uint64_t t)
+{
+  uint64_t tn;
+  uint32_t i;
+
+  if ((ftm_on == 0) && (host_ftm0.SC & (3u << 3)))
+  {
+    ftm_on   = 1;  //      CLKS
+    ftm_next = host_now + host_ftm0.MOD + 1;
+  }
+  for (;;)
+  {
+    tn = Host_hw_next();
+    if (tn > t) break;
+    if (ftm_on && (ftm_next == tn))
+    {
+      Host_ftm_boundary(tn);
+      continue;
+    }
+    for (i = 0; i < 8; i++)
+    {
+      if (ftm_match[i] == tn) break;
+    }
+    if (i < 8)
+    {
+      Host_ftm_match(i);
+      continue;
+    }
+    for (i = 0; i < 4; i++)
+    {
+      if (pit_next[i] == tn) break;
+    }
+    if (i < 4)
+    {
+      host_pit.CHANNEL[i].TFLG = 1;
+      pit_next[i] = tn + host_pit.CHANNEL[i].LDVAL + 1;
+      if (pit_tctrl[i] & BIT(1)) Host_isr_pend(INT_PIT0 + i);
+      continue;
+    }
+    host_ticks++;
+    tick_next += HOST_TICK_CNT;
+  }
+}
+
+/*-----------------------------------------------------------------------------------------------------
+  
+-----------------------------------------------------------------------------------------------------*/
+static uint32_t Host_task_cond(T_host_task *t)
+{
+  _mqx_uint v;
+
+  if (t->ev == 0) return 0;
+  v = t->ev->VALUE & t->mask;
+  return t->all ? (v == t->mask) : (v != 0);
+}
+
+static uint32_t Host_task_ready(T_host_task *t)
+{
+  if (t->waiting == 0) return 0;
+  if (Host_task_cond(t)) return 1;
+  return t->has_deadline && ((int32_t)(host_ticks - t->deadline) >= 0);
+}
+
+static void Host_task_wake(T_host_task *t)
+{
+  if (Host_task_cond(t))
+  {
+    t->signalled = t->ev->VALUE & t->mask;
+    if (t->ev->AUTO) t->ev->VALUE &= ~t->signalled;
+    t->result = MQX_OK;
+  }
+  else
+  {
+    t->signalled = 0;
+    t->result = LWEVENT_WAIT_TIMEOUT;
+  }
+  t->waiting = 0;
+}
+
+static void Host_task_entry(void)
+{
+  T_host_task *t = &tasks[cur_task];
+
+  t->entry(t->param);
+  t->used = 0; //  
+  swapcontext(&t->uc, &tasks[HOST_TASK_MAIN].uc);
+}
+
+/*-----------------------------------------------------------------------------------------------------
+         .    main
+-----------------------------------------------------------------------------------------------------*/
+static void Host_task_resume(uint32_t n)
+{
+  uint64_t t0;
+
+  cur_task = n;
+  t0 = Host_cpu_ns();
+  swapcontext(&tasks[HOST_TASK_MAIN].uc, &tasks[n].uc);
+  cur_task = HOST_TASK_MAIN;
+  task_last_ns = Host_cpu_ns() - t0;
+  host_sim_stat.render_runs++;
+  host_sim_stat.render_ns += task_last_ns;
+  if (task_last_ns > host_sim_stat.render_max_ns) host_sim_stat.render_max_ns = task_last_ns;
+  Host_reg_commit();
+}
+
+void Host_task_start(uint32_t n, void (*entry)(uint32_t), uint32_t param)
+{
+  T_host_task *t = &tasks[n];
+
+  memset(t, 0, sizeof(*t));
+  getcontext(&t->uc);
+  t->uc.uc_stack.ss_sp   = render_stack;
+  t->uc.uc_stack.ss_size = sizeof(render_stack);
+  t->uc.uc_link          = 0;
+  makecontext(&t->uc, Host_task_entry, 0);
+  t->entry = entry;
+  t->param = param;
+  t->used  = 1;
+  Host_task_resume(n); //   main   
+}
+
+uint32_t Host_task_current(void)
+{
+  return cur_task;
+}
+
+_mqx_uint Host_task_signalled(void)
+{
+  return tasks[cur_task].signalled;
+}
+
+uint64_t Host_task_last_ns(void)
+{
+  return task_last_ns;
+}
+
+/*-----------------------------------------------------------------------------------------------------
+           
+-----------------------------------------------------------------------------------------------------*/
+uint32_t Host_task_stack_used(uint32_t n)
+{
+  uint32_t i;
+
+  if (n != HOST_TASK_RENDER) return 0;
+  for (i = 0; i < sizeof(render_stack); i++)
+  {
+    if (render_stack[i] != HOST_STACK_FILL) break;
+  }
+  return sizeof(render_stack) - i;
+}
+
+/*-----------------------------------------------------------------------------------------------------
+         ,      .
+     main,  n          
+-----------------------------------------------------------------------------------------------------*/
+void Host_task_stack_mark(uint32_t n)
+{
+  uintptr_t sp;
+
+  if ((n != HOST_TASK_RENDER) || (tasks[n].used == 0)) return;
+  sp = (uintptr_t)tasks[n].uc.uc_mcontext.gregs[REG_RSP] - 128; //   ABI x86-64     
+  if ((sp <= (uintptr_t)render_stack) || (sp > (uintptr_t)render_stack + sizeof(render_stack))) return;
+  memset(render_stack, HOST_STACK_FILL, sp - (uintptr_t)render_stack);
+}
+
+/*-----------------------------------------------------------------------------------------------------
+      
+
+  ticks -     , 0 -  
+-----------------------------------------------------------------------------------------------------*/
+_mqx_uint Host_task_wait(LWEVENT_STRUCT *ev, _mqx_uint mask, bool all, _mqx_uint ticks)
+{
+  T_host_task *t = &tasks[cur_task];
+
+  t->ev           = ev;
+  t->mask         = mask;
+  t->all          = all;
+  t->has_deadline = (ticks != 0);
+  t->deadline     = host_ticks + ticks;
+  t->waiting      = 1;
+  if (Host_task_cond(t))
+  {
+    Host_task_wake(t);
+    return t->result;
+  }
+  if (cur_task != HOST_TASK_MAIN)
+  {
+    swapcontext(&t->uc, &tasks[HOST_TASK_MAIN].uc);
+  }
+  else
+  {
+    Host_run(HOST_NONE, 0);
+  }
+  return t->result;
+}
+
+/*-----------------------------------------------------------------------------------------------------
+    main         main
+-----------------------------------------------------------------------------------------------------*/
+void Host_task_yield_check(void)
+{
+  T_host_task *t = &tasks[HOST_TASK_RENDER];
+
+  if ((cur_task != HOST_TASK_MAIN) || in_isr) return; //        
+  if (t->used && Host_task_ready(t))
+  {
+    Host_task_wake(t);
+    Host_task_resume(HOST_TASK_RENDER);
+  }
+}
+
+/*-----------------------------------------------------------------------------------------------------
+   .    main:  ,     
+       .
+         ,     
+     .
+      main  ,   t_end  done()   0
+-----------------------------------------------------------------------------------------------------*/
+void Host_run(uint64_t t_end, int (*done)(void))
+{
+  T_host_vector *v;
+  T_host_vector *sel;
+  uint64_t       tn;
+  uint64_t       cost;
+  uint32_t       i;
+
+  for (;;)
+  {
+    Host_reg_commit();
+
+    sel = 0;
+    tn  = HOST_NONE;
+    for (i = 0; i < HOST_VECTORS; i++)
+    {
+      v = &vectors[i];
+      if (v->pend == 0) continue;
+      if ((host_now < isr_end) && (v->prio >= isr_prio) && (v->body == 0)) continue;
+      if (v->run_t < tn) tn = v->run_t;
+      if (v->run_t > host_now) continue;
+      if ((sel == 0) || (v->prio < sel->prio) || ((v->prio == sel->prio) && (v->run_t < sel->run_t))) sel = v;
+    }
+    if (sel != 0)
+    {
+      cost = Host_isr_cost(sel - vectors);
+      if ((cost != 0) && (sel->body == 0))
+      {
+        sel->body  = 1;
+        sel->run_t = host_now + cost;
+        isr_end    = sel->run_t;
+        isr_prio   = sel->prio;
+        continue;
+      }
+      sel->body = 0;
+      sel->pend = 0;
+      if (host_now - sel->pend_t > host_sim_stat.isr_max_delay) host_sim_stat.isr_max_delay = host_now - sel->pend_t;
+      host_sim_stat.isr_calls++;
+      in_isr = 1;
+      sel->isr(0);
+      in_isr = 0;
+      continue;
+    }
+
+    if (host_now >= isr_end) //       
+    {
+      if (tasks[HOST_TASK_RENDER].used && Host_task_ready(&tasks[HOST_TASK_RENDER]))
+      {
+        Host_task_wake(&tasks[HOST_TASK_RENDER]);
+        Host_task_resume(HOST_TASK_RENDER);
+        continue;
+      }
+      if (tasks[HOST_TASK_MAIN].waiting)
+      {
+        if (Host_task_ready(&tasks[HOST_TASK_MAIN]))
+        {
+          Host_task_wake(&tasks[HOST_TASK_MAIN]);
+          return;
+        }
+      }
+      else
+      {
+        if ((done != 0) && done()) return;
+        if (host_now >= t_end) return;
+      }
+    }
+
+    if (Host_hw_next() < tn) tn = Host_hw_next();
+    if ((tasks[HOST_TASK_MAIN].waiting == 0) && (t_end < tn) && (t_end > host_now)) tn = t_end;
+    if (tn > host_now) host_now = tn;
+    Host_hw_advance(host_now);
+  }
+}
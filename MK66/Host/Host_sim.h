@@ -0,0 +1,61 @@
+#ifndef HOST_SIM_H
+  #define HOST_SIM_H
+
+//         Linux.
+//       60 .     FTM0,  DMA  ,
+//  PIT,        .
+//    ,       .
+//  DMA            :  
+//    ,              
+
+#define HOST_BUS_HZ         60000000ull
+#define HOST_TICK_CNT       (HOST_BUS_HZ / HOST_TICKS_PER_SEC) //      
+#define HOST_TICKS_PER_SEC  200
+#define HOST_US(us)         ((uint64_t)(us) * (HOST_BUS_HZ / 1000000ull)) //     
+#define HOST_VECTORS        128
+#define HOST_TASKS          2   //  main   
+#define HOST_ISR_ENTRY_CYCLES 250 //      MQX       
+#define HOST_REFILL_CYCLES  400 //      WS2812B_STREAM_LEDS    
+
+#define HOST_TASK_MAIN      0
+#define HOST_TASK_RENDER    1
+
+//  
+typedef struct
+{
+  uint64_t  dma_transfers;    //    DMA
+  uint64_t  dma_lost_req;     //  DMA      
+  uint64_t  isr_calls;        //   
+  uint64_t  isr_max_delay;    //           
+  uint64_t  render_runs;      //    
+  uint64_t  render_ns;        //    Linux     
+  uint64_t  render_max_ns;    //        
+} T_host_sim_stat;
+
+extern volatile uint64_t  host_now;          //      
+extern uint32_t           host_isr_latency;  //      
+extern uint32_t           host_isr_jitter;   //        
+extern uint32_t           host_refill_cycles; //         
+extern T_host_sim_stat    host_sim_stat;
+
+//     FTM0.       CnV   .
+// outmask - 1    
+extern void             (*host_ftm_period)(uint32_t ch, uint32_t cnv, uint32_t outmask, uint64_t t);
+
+void      Host_sim_init(void);
+uint32_t  Host_cycles(void);
+uint64_t  Host_cpu_ns(void);
+void      Host_isr_install(int num, int prio, INT_ISR_FPTR isr);
+void      Host_run(uint64_t t_end, int (*done)(void));
+uint32_t  Host_ticks(void);
+
+void      Host_task_start(uint32_t task, void (*entry)(uint32_t), uint32_t param);
+uint32_t  Host_task_current(void);
+_mqx_uint Host_task_wait(LWEVENT_STRUCT *ev, _mqx_uint mask, bool all, _mqx_uint ticks);
+_mqx_uint Host_task_signalled(void);
+void      Host_task_yield_check(void);
+uint32_t  Host_task_stack_used(uint32_t task);
+void      Host_task_stack_mark(uint32_t task);
+uint64_t  Host_task_last_ns(void);
+
+#endif
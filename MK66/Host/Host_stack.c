@@ -0,0 +1,181 @@
+//       Linux.
+//        .      
+//  ,   ticks        .
+//      main,     
+#include   "App.h"
+
+//      : 16 ,     3-  
+static const uint8_t   stack_vm_deep[] =
+{
+  WS2812B_VM_P_PARAM(0), WS2812B_VM_P_PARAM(1), WS2812B_VM_P_PARAM(2), WS2812B_VM_P_PARAM(3),
+  WS2812B_VM_P_PARAM(4), WS2812B_VM_P_PARAM(5), WS2812B_VM_LED, WS2812B_VM_NUM, WS2812B_VM_TIME,
+  WS2812B_VM_LED, WS2812B_VM_TIME, WS2812B_VM_LED, WS2812B_VM_NUM, WS2812B_VM_TIME, WS2812B_VM_LED, WS2812B_VM_TIME,
+  WS2812B_VM_SIN, WS2812B_VM_MULQ, WS2812B_VM_RND, WS2812B_VM_XOR, WS2812B_VM_DIV, WS2812B_VM_MOD, WS2812B_VM_ADD,
+  WS2812B_VM_TRI, WS2812B_VM_SUB, WS2812B_VM_MIN, WS2812B_VM_MAX, WS2812B_VM_LT, WS2812B_VM_SEL, WS2812B_VM_OR,
+  WS2812B_VM_AND,
+  WS2812B_VM_HSV
+};
+
+static T_WS2812B_vm_prog stack_prog;
+static uint32_t          stack_layer[WS2812B_LEDS_MAX];
+static uint32_t          stack_capture;   //    
+
+static void Stack_fx(uint32_t id)
+{
+  T_WS2812B_fx_params p;
+
+  p.id      = id;
+  p.speed   = 200;
+  p.hue     = 30;
+  p.sat     = 240;
+  p.val     = 255;
+  p.density = 128;
+  p.width   = 40;
+  WS2812B_Set_effect(&p);
+}
+
+static void Stack_patterns(void)
+{
+  WS2812B_set_source(WS2812B_SRC_PATTERNS);
+}
+
+static void Stack_capture(void)
+{
+  stack_capture = 1;
+}
+
+static void Stack_palette(void)
+{
+  uint32_t i;
+
+  for (i = 0; i < 256; i++) WS2812B_pal_set_hsv(i, WS2812B_HUE_DEG(i), 255, 255);
+  WS2812B_set_source(WS2812B_SRC_PALETTE);
+}
+
+static void Stack_rainbow(void)
+{
+  Stack_fx(WS2812B_FX_RAINBOW);
+}
+
+static void Stack_chase(void)
+{
+  Stack_fx(WS2812B_FX_CHASE);
+}
+
+static void Stack_fire(void)
+{
+  Stack_fx(WS2812B_FX_FIRE);
+}
+
+static void Stack_twinkle(void)
+{
+  Stack_fx(WS2812B_FX_TWINKLE);
+}
+
+static void Stack_noise(void)
+{
+  Stack_fx(WS2812B_FX_NOISE);
+}
+
+static void Stack_script(void)
+{
+  if (WS2812B_vm_load(&stack_prog, stack_vm_deep, sizeof(stack_vm_deep)) != WS2812B_VM_OK)
+  {
+    printf("Deep effect program is rejected\n");
+    return;
+  }
+  printf("Effect program stack depth: %u of %u\n", stack_prog.depth, WS2812B_VM_STACK_MAX);
+  WS2812B_Set_script(&stack_prog);
+  Stack_fx(WS2812B_FX_SCRIPT);
+}
+
+static void Stack_particles(void)
+{
+  T_WS2812B_pt_spawn s;
+
+  memset(&s, 0, sizeof(s));
+  s.speed      = 16 * 60;
+  s.jitter     = 60;
+  s.count      = 64;
+  s.hue        = 20;
+  s.hue_jitter = 40;
+  s.sat        = 255;
+  s.val        = 255;
+  s.life       = 50;
+  s.tail       = 4;
+  WS2812B_Spawn_particles(&s);
+  WS2812B_Set_emitter(&s, WS2812B_get_geometry()->leds_num, 4000);
+  WS2812B_pt_level(255);
+}
+
+//     :  , ,    
+static void Stack_all(void)
+{
+  uint32_t i;
+
+  for (i = 0; i < WS2812B_LEDS_MAX; i++) stack_layer[i] = i * 0x010203;
+  WS2812B_layer_set(0, stack_layer, WS2812B_BLEND_ADD, 77);
+  Stack_script();
+  Stack_particles();
+  stack_capture = 1;
+}
+
+typedef struct
+{
+  const char *name;
+  void      (*setup)(void);
+} T_stack_phase;
+
+static const T_stack_phase stack_phases[] =
+{
+  { "Patterns",                Stack_patterns  },
+  { "Patterns + capture",      Stack_capture   },
+  { "Palette",                 Stack_palette   },
+  { "Effect rainbow",          Stack_rainbow   },
+  { "Effect chase",            Stack_chase     },
+  { "Effect fire",             Stack_fire      },
+  { "Effect twinkle",          Stack_twinkle   },
+  { "Effect noise",            Stack_noise     },
+  { "Effect script, VM depth", Stack_script    },
+  { "Script + particles",      Stack_particles },
+  { "All + layer + capture",   Stack_all       },
+};
+
+/*-----------------------------------------------------------------------------------------------------
+         .
+   LEDSC   .
+
+  ticks -      
+     
+-----------------------------------------------------------------------------------------------------*/
+int Host_stack(uint32_t ticks)
+{
+  T_LEDSC_capture_stat cs;
+  uint32_t             i, k;
+  uint32_t             used;
+  uint32_t             max = 0;
+  uint32_t             frames;
+
+  _time_delay_ticks(ticks); //    
+  printf("%-26s %10s %8s\n", "Render task mode", "stack", "frames");
+  for (i = 0; i < sizeof(stack_phases) / sizeof(stack_phases[0]); i++)
+  {
+    stack_capture = 0;
+    stack_phases[i].setup();
+    _time_delay_ticks(1); //      
+    if (stack_capture != 0) LEDSC_capture_open(ticks);
+    Host_task_stack_mark(HOST_TASK_RENDER);
+    frames = WS2812B_get_stat()->frames;
+    for (k = 0; k < ticks; k++)
+    {
+      _time_delay_ticks(1);
+      if (stack_capture != 0) LEDSC_capture_write();
+    }
+    if (stack_capture != 0) LEDSC_capture_close(&cs);
+    used = Host_task_stack_used(HOST_TASK_RENDER);
+    if (used > max) max = used;
+    printf("%-26s %10u %8u\n", stack_phases[i].name, used, WS2812B_get_stat()->frames - frames);
+  }
+  printf("Max render stack         : %u bytes (x86-64)\n", max);
+  return 0;
+}
@@ -0,0 +1,8 @@
+#ifndef HOST_STACK_H
+  #define HOST_STACK_H
+
+//        
+
+int       Host_stack(uint32_t ticks);
+
+#endif
@@ -0,0 +1,332 @@
+//      FTM0   RGB,         
+#include   "App.h"
+
+#define HOST_WAVE_SLOTS   8 //      
+
+//   
+typedef struct
+{
+  uint32_t  in_frame;  //    
+  uint32_t  idle;      //     
+  uint32_t  bits;      //    
+  uint32_t  word;      //   
+  uint32_t  leds;      //      
+  uint32_t  errs;      //      
+  uint32_t  gap;       //       
+  uint64_t  t0;        //    
+  uint32_t  frames;    //   
+} T_wave_strip;
+
+//   ,     
+typedef struct
+{
+  uint32_t  rgb[WS2812B_LEDS_MAX];
+  uint32_t  leds[WS2812B_STRIPS_MAX];
+  uint32_t  errs;
+  uint32_t  gap;
+  uint64_t  t0;
+} T_wave_frame;
+
+//  
+typedef struct
+{
+  uint32_t  rgb[WS2812B_LEDS_MAX];
+  uint32_t  encoded;
+  uint32_t  cycles;    //     180 
+} T_wave_expect;
+
+T_host_wave_stat        host_wave_stat;
+
+//    FTM0    ,    LEDSC_WS2812B.c
+static const uint8_t    wave_ch_strip[8] = { 1, 2, 0, 3, 4, 5, 6, 7 };
+
+static T_wave_strip     wstrips[WS2812B_STRIPS_MAX];
+static T_wave_frame     wframes[HOST_WAVE_SLOTS];
+static uint32_t         wframes_done;
+static T_wave_expect    wexp[HOST_WAVE_SLOTS];
+static uint32_t         wexp_wr;
+static uint32_t         wexp_rd;
+static FILE            *f_rgb;
+static FILE            *f_csv;
+static char             wave_dir[256];
+
+static void Host_wave_period(uint32_t ch, uint32_t cnv, uint32_t outmask, uint64_t t);
+
+/*-----------------------------------------------------------------------------------------------------
+      FTM0.    
+-----------------------------------------------------------------------------------------------------*/
+void Host_wave_init(void)
+{
+  memset(wstrips, 0, sizeof(wstrips));
+  memset(&host_wave_stat, 0, sizeof(host_wave_stat));
+  host_wave_stat.gap_min = 0xFFFFFFFF;
+  wframes_done = 0;
+  wexp_wr = 0;
+  wexp_rd = 0;
+  host_ftm_period = Host_wave_period;
+}
+
+/*-----------------------------------------------------------------------------------------------------
+        dir:
+  frames.rgb -    3  R, G, B  , frames.csv -      .
+     frames.rgb   frames.ppm,   
+-----------------------------------------------------------------------------------------------------*/
+uint32_t Host_wave_open(const char *dir)
+{
+  char path[512];
+
+  snprintf(wave_dir, sizeof(wave_dir), "%s", dir);
+  snprintf(path, sizeof(path), "%s/frames.rgb", dir);
+  f_rgb = fopen(path, "wb");
+  snprintf(path, sizeof(path), "%s/frames.csv", dir);
+  f_csv = fopen(path, "w");
+  if ((f_rgb == 0) || (f_csv == 0)) return 0;
+  fprintf(f_csv, "frame,start_us,render_us,encoded_leds,bad_leds,sym_errs,gap_bits\n");
+  return 1;
+}
+
+/*-----------------------------------------------------------------------------------------------------
+         
+-----------------------------------------------------------------------------------------------------*/
+void Host_wave_close(void)
+{
+  const T_WS2812B_geometry *g = WS2812B_get_geometry();
+  char      path[512];
+  uint8_t  *buf;
+  FILE     *f;
+  uint32_t  n;
+
+  if (f_csv != 0) fclose(f_csv);
+  if (f_rgb == 0) return;
+  fclose(f_rgb);
+  f_rgb = 0;
+  f_csv = 0;
+  if ((g->leds_num == 0) || (wframes_done == 0)) return;
+
+  snprintf(path, sizeof(path), "%s/frames.rgb", wave_dir);
+  f = fopen(path, "rb");
+  if (f == 0) return;
+  n   = g->leds_num * 3 * wframes_done;
+  buf = malloc(n);
+  if ((buf != 0) && (fread(buf, 1, n, f) == n))
+  {
+    fclose(f);
+    snprintf(path, sizeof(path), "%s/frames.ppm", wave_dir);
+    f = fopen(path, "wb");
+    if (f != 0)
+    {
+      fprintf(f, "P6\n%u %u\n255\n", g->leds_num, wframes_done);
+      fwrite(buf, 1, n, f);
+    }
+  }
+  if (f != 0) fclose(f);
+  free(buf);
+}
+
+/*-----------------------------------------------------------------------------------------------------
+      .     ,
+          ,   WS2812B_encode_rgb
+-----------------------------------------------------------------------------------------------------*/
+void Host_wave_expect(const uint32_t *frame, uint32_t encoded)
+{
+  const T_WS2812B_geometry *g = WS2812B_get_geometry();
+  T_wave_expect *e;
+  uint32_t       n, c, sh, rgb;
+
+  if (wexp_wr - wexp_rd >= HOST_WAVE_SLOTS)
+  {
+    //      ,       
+    if (host_wave_stat.lost++ == 0) LOGs(__FUNCTION__, __LINE__, SEVERITY_RED, "Rendered frames do not appear on the strips output.");
+    return;
+  }
+  e = &wexp[wexp_wr % HOST_WAVE_SLOTS];
+  for (n = 0; n < g->leds_num; n++)
+  {
+    rgb = 0;
+    for (c = 0; c < g->colrs; c++)
+    {
+      sh   = g->shift[c];
+      rgb |= (uint32_t)ws2812b_out_lut[sh >> 3][(frame[n] >> sh) & 0xFF] << sh;
+    }
+    e->rgb[n] = rgb;
+  }
+  e->encoded = encoded;
+  e->cycles  = 0;
+  wexp_wr++;
+}
+
+/*-----------------------------------------------------------------------------------------------------
+        
+-----------------------------------------------------------------------------------------------------*/
+void Host_wave_render_time(uint32_t cycles)
+{
+  if (wexp_wr != wexp_rd) wexp[(wexp_wr - 1) % HOST_WAVE_SLOTS].cycles = cycles;
+}
+
+/*-----------------------------------------------------------------------------------------------------
+         
+-----------------------------------------------------------------------------------------------------*/
+uint32_t Host_wave_pending(void)
+{
+  return wexp_wr - wexp_rd;
+}
+
+/*-----------------------------------------------------------------------------------------------------
+             
+-----------------------------------------------------------------------------------------------------*/
+static void Host_wave_frame_done(void)
+{
+  const T_WS2812B_geometry *g = WS2812B_get_geometry();
+  T_wave_frame  *f = &wframes[wframes_done % HOST_WAVE_SLOTS];
+  T_wave_expect *e = 0;
+  uint32_t       n, s, len;
+  uint32_t       bad = 0;
+  uint8_t        px[3];
+
+  if (wexp_rd != wexp_wr) e = &wexp[wexp_rd++ % HOST_WAVE_SLOTS];
+  else host_wave_stat.unexpected++;
+
+  for (s = 0; s < g->strips_num; s++)
+  {
+    len = g->leds_num - s * g->strip_leds;
+    if (len > g->strip_leds) len = g->strip_leds;
+    for (n = 0; n < len; n++)
+    {
+      if (n >= f->leds[s])
+      {
+        f->rgb[s * g->strip_leds + n] = 0;
+        bad++; //    
+      }
+      else if ((e != 0) && (f->rgb[s * g->strip_leds + n] != e->rgb[s * g->strip_leds + n]))
+      {
+        bad++;
+      }
+    }
+  }
+  if (e == 0) bad = g->leds_num;
+
+  host_wave_stat.frames++;
+  host_wave_stat.bad_leds += bad;
+  host_wave_stat.sym_errs += f->errs;
+  if (wframes_done != 0)
+  {
+    //           
+    if (f->gap < host_wave_stat.gap_min) host_wave_stat.gap_min = f->gap;
+    if (f->gap < WS2812B_RESET_BITS) host_wave_stat.gap_errs++;
+  }
+
+  if (f_rgb != 0)
+  {
+    for (n = 0; n < g->leds_num; n++)
+    {
+      px[0] = (f->rgb[n] >> 16) & 0xFF;
+      px[1] = (f->rgb[n] >> 8) & 0xFF;
+      px[2] = f->rgb[n] & 0xFF;
+      fwrite(px, 1, 3, f_rgb);
+    }
+  }
+  if (f_csv != 0)
+  {
+    fprintf(f_csv, "%u,%.1f,%.2f,%u,%u,%u,%u\n", wframes_done, (double)f->t0 / (HOST_BUS_HZ / 1000000ull),
+            (e != 0) ? e->cycles / (BSP_CORE_CLOCK / 1000000.0) : 0.0, (e != 0) ? e->encoded : 0, bad, f->errs,
+            (wframes_done != 0) ? f->gap : 0);
+  }
+  memset(f, 0, sizeof(*f));
+  wframes_done++;
+}
+
+/*-----------------------------------------------------------------------------------------------------
+     s.    ,     
+-----------------------------------------------------------------------------------------------------*/
+static void Host_wave_strip_end(uint32_t s)
+{
+  const T_WS2812B_geometry *g = WS2812B_get_geometry();
+  T_wave_strip *w = &wstrips[s];
+  T_wave_frame *f;
+  uint32_t      i;
+
+  if (w->frames - wframes_done >= HOST_WAVE_SLOTS)
+  {
+    LOGs(__FUNCTION__, __LINE__, SEVERITY_RED, "Strip %d is %d frames ahead of others.", s, HOST_WAVE_SLOTS);
+    return;
+  }
+  f = &wframes[w->frames % HOST_WAVE_SLOTS];
+  if (w->bits != 0) w->errs++; //  
+  f->leds[s] = w->leds;
+  f->errs   += w->errs;
+  if ((s == 0) || (w->gap < f->gap)) f->gap = w->gap;
+  if ((s == 0) || (w->t0 < f->t0)) f->t0 = w->t0;
+  w->in_frame = 0;
+  w->frames++;
+
+  for (;;)
+  {
+    for (i = 0; i < g->strips_num; i++)
+    {
+      if (wstrips[i].frames == wframes_done) return;
+    }
+    Host_wave_frame_done();
+  }
+}
+
+/*-----------------------------------------------------------------------------------------------------
+     FTM0    CnV
+-----------------------------------------------------------------------------------------------------*/
+static void Host_wave_period(uint32_t ch, uint32_t cnv, uint32_t outmask, uint64_t t)
+{
+  const T_WS2812B_geometry *g = WS2812B_get_geometry();
+  T_wave_strip *w;
+  T_wave_frame *f;
+  uint32_t      s = wave_ch_strip[ch];
+  uint32_t      b;
+  uint32_t      i;
+  uint32_t      n;
+
+  if (s >= g->strips_num) return;
+  w = &wstrips[s];
+
+  if ((cnv == 0) || outmask)
+  {
+    if (w->in_frame) Host_wave_strip_end(s);
+    w->idle++;
+    return;
+  }
+
+  if (cnv == FTM_WS2812B_1) b = 1;
+  else
+  {
+    b = 0;
+    if (cnv != FTM_WS2812B_0) w->errs++;
+  }
+  if (w->in_frame == 0)
+  {
+    w->in_frame = 1;
+    w->gap      = w->idle;
+    w->t0       = t;
+    w->bits     = 0;
+    w->word     = 0;
+    w->leds     = 0;
+    w->errs     = (cnv == FTM_WS2812B_1 || cnv == FTM_WS2812B_0) ? 0 : 1;
+  }
+  w->idle = 0;
+  w->word = (w->word << 1) | b;
+  w->bits++;
+  if ((w->bits & 7) != 0) return;
+
+  //        
+  f = &wframes[w->frames % HOST_WAVE_SLOTS];
+  i = (w->bits >> 3) - 1;
+  n = s * g->strip_leds + w->leds;
+  if ((w->leds < g->strip_leds) && (n < g->leds_num))
+  {
+    if (i == 0) f->rgb[n] = 0;
+    f->rgb[n] |= (w->word & 0xFF) << g->shift[i];
+  }
+  w->word = 0;
+  if (w->bits == g->bits_per_led)
+  {
+    w->bits = 0;
+    w->leds++;
+    if ((w->leds > g->strip_leds) || (n >= g->leds_num)) w->errs++; //  
+  }
+}
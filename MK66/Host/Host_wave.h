@@ -0,0 +1,30 @@
+#ifndef HOST_WAVE_H
+  #define HOST_WAVE_H
+
+//    FTM0         .
+//       CnV: FTM_WS2812B_1 -  1, FTM_WS2812B_0 -  0,
+// 0 -  ,   -  .   -     .
+//   -          
+
+//  
+typedef struct
+{
+  uint32_t  frames;      //   
+  uint32_t  bad_leds;    //       ,  
+  uint32_t  sym_errs;    //      
+  uint32_t  gap_errs;    //      WS2812B_RESET_BITS  
+  uint32_t  gap_min;     //       
+  uint32_t  unexpected;  //        
+  uint32_t  lost;        //         -  
+} T_host_wave_stat;
+
+extern T_host_wave_stat host_wave_stat;
+
+void     Host_wave_init(void);
+uint32_t Host_wave_open(const char *dir);
+void     Host_wave_close(void);
+void     Host_wave_expect(const uint32_t *frame, uint32_t encoded);
+void     Host_wave_render_time(uint32_t cycles);
+uint32_t Host_wave_pending(void);
+
+#endif
@@ -0,0 +1,61 @@
+#ifndef HOST_INTRINSICS_H
+  #define HOST_INTRINSICS_H
+
+//    SIMD Cortex-M4    LEDSC  Linux   __ARM_MEDIA__.
+//       ARMv7-M Architecture Reference Manual    ,
+//           SIMD
+
+#include   <stdint.h>
+
+/*-----------------------------------------------------------------------------------------------------
+  UQADD8:        255
+-----------------------------------------------------------------------------------------------------*/
+static inline uint32_t __UQADD8(uint32_t a, uint32_t b)
+{
+  uint32_t k;
+  uint32_t c;
+  uint32_t res = 0;
+
+  for (k = 0; k < 32; k += 8)
+  {
+    c = ((a >> k) & 0xFF) + ((b >> k) & 0xFF);
+    if (c > 255) c = 255;
+    res |= c << k;
+  }
+  return res;
+}
+
+/*-----------------------------------------------------------------------------------------------------
+  UQSUB8:        0
+-----------------------------------------------------------------------------------------------------*/
+static inline uint32_t __UQSUB8(uint32_t a, uint32_t b)
+{
+  uint32_t k;
+  int32_t  c;
+  uint32_t res = 0;
+
+  for (k = 0; k < 32; k += 8)
+  {
+    c = (int32_t)((a >> k) & 0xFF) - (int32_t)((b >> k) & 0xFF);
+    if (c < 0) c = 0;
+    res |= (uint32_t)c << k;
+  }
+  return res;
+}
+
+/*-----------------------------------------------------------------------------------------------------
+  UHADD8:     
+-----------------------------------------------------------------------------------------------------*/
+static inline uint32_t __UHADD8(uint32_t a, uint32_t b)
+{
+  uint32_t k;
+  uint32_t res = 0;
+
+  for (k = 0; k < 32; k += 8)
+  {
+    res |= ((((a >> k) & 0xFF) + ((b >> k) & 0xFF)) >> 1) << k;
+  }
+  return res;
+}
+
+#endif